@@ -16,6 +16,9 @@ public:
 	float GetSensitivity() const { return m_ySensitivity; }
 	void SetSensitivity(float sensitivity) { m_ySensitivity = sensitivity; }
 
+	// 업데이트는 입력을 읽어 자기 회전만 갱신
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override { return {}; }
+
 private:
 	void Initialize() override;
 	void Update() override;
@@ -8,6 +8,13 @@ public:
 	bool NeedsUpdate() const override { return true; }
 	bool NeedsRender() const override { return true; }
 
+	// 업데이트에서 사운드 매니저에 노드 생성 콜백 등록 // 렌더링은 소유 플레이어 상태만 읽음
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override
+	{
+		if (phase == FramePhase::Update) return { .write = FrameAccess::Audio };
+		return {};
+	}
+
 	void Initialize() override;
 	void Update() override;
 	void Render() override;
@@ -4,6 +4,7 @@
 
 #include "SkinnedModelComponent.h"
 #include "ColliderComponent.h"
+#include "CharacterControllerComponent.h"
 #include "FSMComponentEnemy.h"
 #include "TimeManager.h"
 #include "Player.h"
@@ -21,14 +22,19 @@ REGISTER_TYPE(Enemy)
 using namespace std;
 using namespace DirectX;
 
-vector<Enemy*> Enemy::s_enemies = {};
+SpatialHashGrid Enemy::s_separationGrid = SpatialHashGrid(SEPARATION_RADIUS, true);
+
+constexpr size_t MAX_SEPARATION_NEIGHBORS = 32; // 분리 계산에 쓰는 이웃 수 상한 // 반경 안에 이보다 많으면 나머지 무시
 
 void Enemy::Initialize()
 {
 	m_fsm = GetComponent<FSMComponentEnemy>();
 	m_collider = GetComponent<ColliderComponent>();
+	m_characterController = GetComponent<CharacterControllerComponent>();
+	// 예약 이동은 업데이트 단계가 끝난 뒤 반영되므로 해결된 위치로 분리 격자 갱신
+	if (m_characterController) m_characterController->SetOnMoveResolved([this]() { if (m_separationHandle != SpatialHashGrid::INVALID_HANDLE) s_separationGrid.Move(m_separationHandle, GetPosition()); });
 
-	s_enemies.push_back(this);
+	AddToEnemies();
 
 	m_player = static_cast<Player*>(SceneManager::GetInstance().GetCurrentScene()->GetGameObjectRecursive("Player"));
 	if (!m_player) cout << "Enemy 초기화 오류: Player 게임 오브젝트를 찾을 수 없습니다." << endl;
@@ -47,6 +53,8 @@ void Enemy::Die()
 	m_deathTimer = 0.0f;
 
 	if (m_collider) m_collider->SetAlive(false);
+	// 분리 계산은 격자에 남은 적만 보므로 다른 적의 상태를 읽지 않아도 됨
+	RemoveFromEnemies();
 
 	if (m_fsm) m_fsm->ChangeState(FSMComponentEnemy::EDead);
 	
@@ -137,7 +145,7 @@ void Enemy::MoveAlongPath(float dt)
 		SetRotation(XMVectorSet(0.0f, nextYawDeg, 0.0f, 0.0f));
 
 		XMVECTOR deltaPosition = XMVectorScale(direction, m_moveSpeedSquared * TimeManager::GetInstance().GetDeltaTime());
-		MovePosition(deltaPosition);
+		Move(deltaPosition);
 	}
 }
 
@@ -154,27 +162,42 @@ void Enemy::OnAttackFinished()
 
 void Enemy::Finalize()
 {
-	auto it = find(s_enemies.begin(), s_enemies.end(), this);
-	if (it != s_enemies.end()) s_enemies.erase(it);
+	RemoveFromEnemies();
+}
+
+void Enemy::Reactivate()
+{
+	// 풀에서 재사용될 때 이전 생애의 상태 초기화
+	m_isTutorialDummy = false;
+	m_state = AIState::Chase;
+	m_deathTimer = 0.0f;
+	m_path.clear();
+
+	Initialize();
 }
 
 void Enemy::ApplySeparation(float dt)
 {
 	if (m_state == AIState::Dead || !GetAlive()) return;
-	if (s_enemies.size() <= 1) return;
 
-	const float radius = m_separationRadius;
+	const float radius = SEPARATION_RADIUS;
 	const float radiusSq = radius * radius;
 
 	XMVECTOR myPos = GetPosition();
 	XMVECTOR push = XMVectorZero();
 
-	for (Enemy* other : s_enemies)
-	{
-		if (!other || other == this) continue;
-		if (!other->GetAlive()) continue;
-		if (other->m_state == AIState::Dead) continue;
+	// 반경 안 적만 후보로 검색 // 거리는 현재 위치로 다시 계산
+	// 컨트롤러가 있으면 위치와 격자 모두 이동 해결 직후에만 바뀌므로 단계 중에는 읽기만 함 // 없으면 이번 프레임 이동을 먼저 반영
+	if (!m_characterController) s_separationGrid.Move(m_separationHandle, myPos);
+	if (s_separationGrid.GetCount() <= 1) return;
+
+	array<SpatialHashGrid::Neighbor, MAX_SEPARATION_NEIGHBORS> neighbors = {};
+	const size_t neighborCount = s_separationGrid.QueryRadius(myPos, radius, neighbors, m_separationHandle);
 
+	for (const SpatialHashGrid::Neighbor& neighbor : span(neighbors.data(), neighborCount))
+	{
+		// 죽은 적은 Die에서 격자에서 빠지므로 이웃은 모두 살아 있음
+		const Enemy* other = static_cast<const Enemy*>(s_separationGrid.GetUserData(neighbor.handle));
 		XMVECTOR diff = XMVectorSubtract(myPos, other->GetPosition());
 		diff = XMVectorSetY(diff, 0.0f);
 
@@ -202,5 +225,40 @@ void Enemy::ApplySeparation(float dt)
 	}
 
 	delta = XMVectorSet(XMVectorGetX(delta), 0.0f, XMVectorGetZ(delta), 0.0f);
-	MovePosition(delta);
+	Move(delta);
+	// 컨트롤러가 있으면 아직 예약만 된 상태 // 격자는 이동 해결 직후 갱신
+	if (!m_characterController) s_separationGrid.Move(m_separationHandle, GetPosition());
+}
+
+FrameAccessSet Enemy::GetFrameAccess(FramePhase phase) const
+{
+	if (phase != FramePhase::Update) return {};
+
+	// 컨트롤러가 있으면 이동 예약과 분리 격자 갱신을 단계가 끝난 뒤 반영하므로 읽기만 함
+	// 없으면 업데이트 중에 직접 이동하므로 다른 적이 읽는 위치와 분리 격자를 씀
+	FrameAccessSet access = { .read = FrameAccess::Transform | FrameAccess::Navigation | FrameAccess::Gameplay };
+	if (!m_characterController) access.write = FrameAccess::Transform | FrameAccess::Gameplay;
+
+	return access;
+}
+
+void Enemy::Move(const XMVECTOR& displacement)
+{
+	if (m_characterController) m_characterController->QueueMove(displacement);
+	else MovePosition(displacement);
+}
+
+void Enemy::AddToEnemies()
+{
+	if (m_separationHandle != SpatialHashGrid::INVALID_HANDLE) return;
+
+	m_separationHandle = s_separationGrid.Insert(GetPosition(), this);
+}
+
+void Enemy::RemoveFromEnemies()
+{
+	if (m_separationHandle == SpatialHashGrid::INVALID_HANDLE) return;
+
+	s_separationGrid.Remove(m_separationHandle);
+	m_separationHandle = SpatialHashGrid::INVALID_HANDLE;
 }
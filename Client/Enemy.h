@@ -1,9 +1,12 @@
 #pragma once
 #include "GameObjectBase.h"
+#include "SpatialHashGrid.h"
 
 class Enemy : public GameObjectBase
 {
-	static std::vector<Enemy*> s_enemies;
+	static constexpr float SEPARATION_RADIUS = 0.8f;
+	static SpatialHashGrid s_separationGrid; // 활성 적 위치 평면 격자 // 셀 크기는 분리 반경
+	uint32_t m_separationHandle = SpatialHashGrid::INVALID_HANDLE; // s_separationGrid 내 핸들
 
 	bool m_isTutorialDummy = false;
 
@@ -17,12 +20,12 @@ class Enemy : public GameObjectBase
 
 	class FSMComponentEnemy* m_fsm = nullptr;
 	class ColliderComponent* m_collider = nullptr;
+	class CharacterControllerComponent* m_characterController = nullptr; // 없으면 충돌 없이 바로 이동
 
 	float m_deathTimer = 0.0f;
 	const float m_deathDuration = 2.0f;
 	const float m_attackRangeSquare = 5.0f;
 	float m_rotationSpeed = 10.0f;
-	const float m_separationRadius = 0.8f;
 	const float m_separationStrength = 3.5f;
 	const float m_separationMaxPush = 2.0f;
 
@@ -49,11 +52,27 @@ public:
 
 	void SetAsTutorialDummy();
 
+	// 업데이트에서 플레이어, 이웃 적 위치와 상태, 분리 격자, 네비게이션 메시 읽기
+	// 이동은 캐릭터 컨트롤러에 예약만 하므로 위치와 분리 격자는 업데이트 단계가 끝난 뒤 바뀜
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override;
+
 private:
 	void Initialize() override;
 	void Update() override;
 	void Finalize() override;
+	void Reactivate() override;
+
+	// 비활성화 동안 분리(separation) 계산 대상에서 제외
+	void OnEnable() override { AddToEnemies(); }
+	void OnDisable() override { RemoveFromEnemies(); }
 
 	void MoveAlongPath(float dt);
 	void ApplySeparation(float dt);
+	// 캐릭터 컨트롤러에 이동 예약 // 업데이트 단계가 끝난 뒤 모든 적의 이동을 한 번에 해결
+	void Move(const DirectX::XMVECTOR& displacement);
+
+	// 분리 격자에 등록 // 이미 등록되어 있으면 무시
+	void AddToEnemies();
+	// 분리 격자에서 해제
+	void RemoveFromEnemies();
 };
@@ -26,6 +26,13 @@ public:
 
 	void SetModelComponent(class SkinnedModelComponent* model) { model_ = model; }
 
+	// 공격 상태에서만 플레이어 피격 처리 // 나머지 상태는 자기 모델만 갱신
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override
+	{
+		if (phase == FramePhase::Update && current_state_ == EAttack) return { .write = FrameAccess::Gameplay };
+		return {};
+	}
+
 protected:
 	void OnEnterState(StateID state) override;
 	void OnUpdateState(StateID state) override;
@@ -24,6 +24,9 @@ public:
 	void Fire();
 	void Reload();
 
+	// 업데이트는 소유 게임 오브젝트(총) 회전만 갱신
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override { return {}; }
+
 protected:
 	void OnEnterState(StateID state) override;
 	void OnUpdateState(StateID state) override;
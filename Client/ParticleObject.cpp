@@ -10,6 +10,12 @@ void ParticleObject::Initialize()
 	SetIgnoreParentTransform(true);
 }
 
+void ParticleObject::Reactivate()
+{
+	m_lifetime = 1.0f;
+	Initialize();
+}
+
 void ParticleObject::Update()
 {
 	m_lifetime -= TimeManager::GetInstance().GetDeltaTime();
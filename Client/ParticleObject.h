@@ -15,7 +15,11 @@ public:
 
 	void SetLifetime(float lifetime) { m_lifetime = lifetime; }
 
+	// 업데이트는 자기 수명만 줄임 // 제거 예약은 제거 대기열이 잠금으로 보호
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override { return {}; }
+
 private:
 	void Initialize() override;
 	void Update() override;
+	void Reactivate() override;
 };
\ No newline at end of file
@@ -2,10 +2,12 @@
 #include "Player.h"
 
 #include "Renderer.h"
+#include "RenderBackend.h"
 #include "SoundManager.h"
 #include "TimeManager.h"
 #include "InputManager.h"
 #include "ColliderComponent.h"
+#include "CharacterControllerComponent.h"
 #include "CameraComponent.h"
 #include "ResourceManager.h"
 #include "ModelComponent.h"
@@ -38,6 +40,25 @@ void Player::TakeHit()
 	m_invincibilityTimer = m_invincibilityDuration;
 }
 
+FrameAccessSet Player::GetFrameAccess(FramePhase phase) const
+{
+	switch (phase)
+	{
+	case FramePhase::Update:
+		return
+		{
+			.read = FrameAccess::Collider | FrameAccess::Navigation | FrameAccess::Camera,
+			.write = FrameAccess::Transform | FrameAccess::Gameplay | FrameAccess::Audio | FrameAccess::Scene
+		};
+
+	case FramePhase::Render:
+		return { .read = FrameAccess::Transform | FrameAccess::Camera };
+
+	default:
+		return {};
+	}
+}
+
 void Player::Initialize()
 {
 	XMStoreFloat3(&m_playerRotation, GetRotation());
@@ -48,6 +69,7 @@ void Player::Initialize()
 
 	m_cameraComponent = GetComponent<CameraComponent>();
 	m_cameraComponent->SetAsMainCamera();
+	m_characterController = GetComponent<CharacterControllerComponent>();
 	m_gunObject = GetChildGameObject("Gun");
 
 	m_playerHitPointTextureAndOffset = resourceManager.GetTextureAndOffset("UI_HitPoint.png");
@@ -83,7 +105,7 @@ void Player::Update()
 	
 	if (m_isDeadEyeActive)				PlayerDeadEye(deltaTime, input);	
 	if (m_isDashing)					PlayerDash(deltaTime);
-	else if (m_ControlState.CanMove)	MovePosition(m_normalizedMoveDirection * m_moveSpeed * deltaTime);
+	else if (m_ControlState.CanMove)	Move(m_normalizedMoveDirection * m_moveSpeed * deltaTime);
 	
 	XMVECTOR previousPosition = GetPosition();
 	// 만약 이동한 위치가 네비게이션 메시 밖이면 이전 위치로 되돌림 // 월드 좌표계는 나중에 업데이트 됨으로 로컬 좌표계로 해햐함
@@ -244,10 +266,16 @@ void Player::PlayerTriggerDash()
 	SoundManager::GetInstance().SFX_Shot(GetPosition(), Config::Player_Dash);
 }
 
+void Player::Move(const XMVECTOR& displacement)
+{
+	if (m_characterController) m_characterController->Move(displacement);
+	else MovePosition(displacement);
+}
+
 void Player::PlayerDash(float deltaTime)
 {
 	m_dashTimer -= deltaTime;
-	MovePosition(m_dashDirection * m_kDashSpeed * deltaTime);
+	Move(m_dashDirection * m_kDashSpeed * deltaTime);
 	if (m_dashTimer <= 0.0f) m_isDashing = false;
 
 	float t = 1.0f - (m_dashTimer / m_kDashDuration); // 0->1
@@ -350,26 +378,41 @@ void Player::PlayerAutoReload(int cnt)
 
 void Player::PlayerDeadEyeStart()
 {
-	vector<GameObjectBase*> hits = ColliderComponent::CheckCollision(m_cameraComponent->GetBoundingFrustum());
+	// 적 레이어만 조회 // 레벨 지오메트리는 브로드페이즈에서 건너뜀 // 지난 조회 이후 넓힌 상자가 그대로이고 절두체 평면에서 멀리 있는 적은 다시 검사하지 않음
+	const FrameVector<GameObjectBase*> hits = ColliderComponent::CheckCollision(m_cameraComponent->GetBoundingFrustum(), m_deadEyeVisibilityCache, ToLayerMask(CollisionLayer::Enemy));
 	if (hits.empty()) return;
 
 	bool hasEnemy = false;
 
+	// 적 후보마다 시야 광선을 만들어 4개씩 묶어 검사
+	const XMVECTOR& origin = GetPosition();
+	FrameVector<Enemy*> candidates;
+	FrameVector<Ray> rays;
 	for (GameObjectBase* hit : hits)
 	{
 		if (Enemy* enemy = dynamic_cast<Enemy*>(hit))
 		{
-			// ?��?��?�� ?��?��물이 ?��?���? ?��?��
-			float distance = 0.0f;
-			const XMVECTOR& origin = GetPosition();
 			const XMVECTOR& targetPos = XMVectorAdd(enemy->GetWorldPosition(), { 0.0f, 1.0f, 0.0f, 0.0f }); // ?�� 충심?�� y = 0.0f?��?�� ?���? ?���?
-			if (!dynamic_cast<Enemy*>(ColliderComponent::CheckCollision(origin, XMVectorSubtract(targetPos, origin), distance))) continue;
-
-			hasEnemy = true;
-			XMFLOAT2 distancePair = Renderer::GetInstance().ToUIPosition(m_cameraComponent->WorldToScreenPosition(targetPos));
-			m_deadEyeTargets.emplace_back(powf(distancePair.x - 0.5f, 2) + powf(distancePair.y - 0.5f, 2), enemy);
+			candidates.push_back(enemy);
+			rays.push_back({ .origin = origin, .direction = XMVectorSubtract(targetPos, origin) });
 		}
 	}
+
+	FrameVector<ColliderComponent::RaycastHit> rayHits(rays.size());
+	// 시야는 플레이어 외 모든 레이어가 가림
+	ColliderComponent::RaycastBatch(rays, rayHits, ~ToLayerMask(CollisionLayer::Player));
+
+	for (size_t i = 0; i < candidates.size(); ++i)
+	{
+		// ?��?��?�� ?��?��물이 ?��?���? ?��?��
+		if (!dynamic_cast<Enemy*>(rayHits[i].object)) continue;
+
+		Enemy* enemy = candidates[i];
+		const XMVECTOR& targetPos = XMVectorAdd(enemy->GetWorldPosition(), { 0.0f, 1.0f, 0.0f, 0.0f });
+		hasEnemy = true;
+		XMFLOAT2 distancePair = Renderer::GetInstance().ToUIPosition(m_cameraComponent->WorldToScreenPosition(targetPos));
+		m_deadEyeTargets.emplace_back(powf(distancePair.x - 0.5f, 2) + powf(distancePair.y - 0.5f, 2), enemy);
+	}
 	if (hasEnemy)
 	{
 		m_isDeadEyeActive = true;
@@ -503,6 +546,7 @@ void Player::RenderLineBuffers(Renderer& renderer)
 		{
 			ResourceManager& resourceManager = ResourceManager::GetInstance();
 			com_ptr<ID3D11DeviceContext> deviceContext = Renderer::GetInstance().GetDeviceContext();
+			RenderBackend& renderBackend = RenderBackend::GetInstance();
 
 			deviceContext->IASetInputLayout(m_lineVertexBufferAndShader.second.Get());
 			deviceContext->VSSetShader(m_lineVertexBufferAndShader.first.Get(), nullptr, 0);
@@ -513,8 +557,8 @@ void Player::RenderLineBuffers(Renderer& renderer)
 
 			for (const auto& [lineBuffer, time] : m_lineBuffers)
 			{
-				deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBuffer, 0, 0);
-				deviceContext->Draw(2, 0);
+				renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBuffer);
+				renderBackend.Draw(deviceContext.Get(), 2, 0);
 			}
 		}
 	);
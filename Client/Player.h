@@ -1,5 +1,6 @@
 #pragma once
 #include "GameObjectBase.h"
+#include "VisibilityCache.h"
 
 enum class Action
 {
@@ -40,6 +41,7 @@ class Player : public GameObjectBase
 
 	std::pair<com_ptr<ID3D11ShaderResourceView>, DirectX::XMFLOAT2> m_deadEyeTextureAndOffset = {};
 	std::vector<std::pair<float, class Enemy*>> m_deadEyeTargets = {};
+	VisibilityCache m_deadEyeVisibilityCache = {}; // 데드아이 후보 적 절두체 검사 결과 // 해제된 적의 주소를 재사용해 결과가 틀려도 시야 광선으로 다시 거름
 	DirectX::XMFLOAT2 m_prevDeadEyePos = {};
 	DirectX::XMFLOAT2 m_nextDeadEyePos = {};
 	float m_deadEyeMoveTimer = 0.0f;
@@ -57,6 +59,7 @@ class Player : public GameObjectBase
 	float m_moveSpeed = 5.0f;
 
 	class CameraComponent* m_cameraComponent = nullptr;
+	class CharacterControllerComponent* m_characterController = nullptr; // 없으면 충돌 없이 바로 이동
 	float m_cameraSensitivity = 0.1f;
 	GameObjectBase* m_gunObject = nullptr;
 	class FSMComponentGun* m_gunFSM = nullptr;
@@ -101,6 +104,10 @@ public:
 
 	void TakeHit();
 
+	// 업데이트에서 자기 위치, 적 상태와 분리 격자(적 처치), 게임 매니저, 사운드 매니저, 씬 전환을 쓰고 콜라이더, 네비게이션 메시를 읽음
+	// 렌더링은 데드아이 대상 적 위치와 카메라 읽기
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override;
+
 private:
 	void Initialize() override;
 	void Update() override;
@@ -114,6 +121,8 @@ private:
 	void UpdateMoveDirection(class InputManager& input);
 	void PlayerTriggerDash();
 	void PlayerDash(float deltaTime);
+	// 캐릭터 컨트롤러로 바로 이동 // 벽을 따라 미끄러지고 대시 속도에서도 얇은 벽을 지나치지 않음
+	void Move(const DirectX::XMVECTOR& displacement);
 	void PlayerShoot();
 	void PlayerReload(int cnt);
 	void PlayerAutoReload(int cnt);
@@ -14,6 +14,9 @@ public:
 
 	// FPS 모드에서는 Forward 벡터가 중요하므로 유지
 	void GetCameraBasis(DirectX::XMVECTOR& outRight, DirectX::XMVECTOR& outUp, DirectX::XMVECTOR& outForward);
+
+	// 업데이트는 입력을 읽어 자기 변환만 갱신 // 카메라 행렬은 카메라 컴포넌트가 선언
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override { return {}; }
 private:
 	void Initialize() override;
 	void Update() override;
@@ -24,6 +24,10 @@ REGISTER_TYPE(TestScene)
 using namespace std;
 using namespace DirectX;
 
+constexpr float SPAWN_ACTIVE_DISTANCE = 10.0f; // 플레이어와 이 거리 안의 생성 지점에서만 적 생성
+constexpr float SPAWN_ACTIVE_DISTANCE_SQ = SPAWN_ACTIVE_DISTANCE * SPAWN_ACTIVE_DISTANCE;
+constexpr size_t MAX_ACTIVE_SPAWN_POINTS = 64; // 한 번에 고려하는 생성 지점 수 상한
+
 void TestScene::Initialize()
 {
 	ShowCursor(FALSE);
@@ -75,9 +79,19 @@ void TestScene::RenderImGui()
 {
 	if (ImGui::TreeNode("Spawn Points"))
 	{
-		for (XMVECTOR& point : m_spawnPoints) ImGui::DragFloat3(("Point " + to_string(&point - &m_spawnPoints[0])).c_str(), &point.m128_f32[0], 0.1f);
-		if (ImGui::Button("Add Point")) m_spawnPoints.push_back(XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f));
-		if (!m_spawnPoints.empty() && ImGui::Button("Remove Last Point")) m_spawnPoints.pop_back();
+		bool isChanged = false;
+		for (XMVECTOR& point : m_spawnPoints) isChanged |= ImGui::DragFloat3(("Point " + to_string(&point - &m_spawnPoints[0])).c_str(), &point.m128_f32[0], 0.1f);
+		if (ImGui::Button("Add Point"))
+		{
+			m_spawnPoints.push_back(XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f));
+			isChanged = true;
+		}
+		if (!m_spawnPoints.empty() && ImGui::Button("Remove Last Point"))
+		{
+			m_spawnPoints.pop_back();
+			isChanged = true;
+		}
+		if (isChanged) RebuildSpawnPointGrid();
 
 		ImGui::TreePop();
 	}
@@ -119,6 +133,8 @@ void TestScene::Deserialize(const nlohmann::json& jsonData)
 			m_spawnPoints.emplace_back(point);
 		}
 	}
+
+	RebuildSpawnPointGrid();
 }
 
 void TestScene::TutorialStep()
@@ -136,7 +152,12 @@ void TestScene::TutorialStep()
 	}
 }
 
-constexpr float SPAWN_ACTIVE_DISTANCE_SQ = 100.0f;
+void TestScene::RebuildSpawnPointGrid()
+{
+	m_spawnPointGrid.Clear();
+	m_spawnPointGrid.SetCellSize(SPAWN_ACTIVE_DISTANCE);
+	for (const XMVECTOR& point : m_spawnPoints) m_spawnPointGrid.Insert(point, nullptr);
+}
 
 void TestScene::SpawnEnemy(float deltaTime)
 {
@@ -145,18 +166,13 @@ void TestScene::SpawnEnemy(float deltaTime)
 
 	if (spawnTime > m_spawnInterval)
 	{
-		vector<XMVECTOR> validSpawnPoints = {};
-		copy_if
-		(
-			m_spawnPoints.begin(),
-			m_spawnPoints.end(),
-			back_inserter(validSpawnPoints),
-			[&](const XMVECTOR& point) { return XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(GetRootGameObject("Player")->GetWorldPosition(), point))) < SPAWN_ACTIVE_DISTANCE_SQ; }
-		);
-
-		if (!validSpawnPoints.empty())
+		// 플레이어 주변 셀의 생성 지점만 검사
+		array<SpatialHashGrid::Neighbor, MAX_ACTIVE_SPAWN_POINTS> validSpawnPoints = {};
+		const size_t validSpawnPointCount = m_spawnPointGrid.QueryRadius(GetRootGameObject("Player")->GetWorldPosition(), SPAWN_ACTIVE_DISTANCE, validSpawnPoints);
+
+		if (validSpawnPointCount > 0)
 		{
-			XMVECTOR spawnPoint = validSpawnPoints[RNG::GetInstance().Range(0, static_cast<int>(validSpawnPoints.size()) - 1)];
+			const XMVECTOR spawnPoint = XMVectorSetW(m_spawnPointGrid.GetPosition(validSpawnPoints[RNG::GetInstance().Range(0, static_cast<int>(validSpawnPointCount) - 1)].handle), 1.0f);
 			CreatePrefabRootGameObject("Enemy.json")->SetPosition(spawnPoint);
 
 			spawnTime = 0.0f;
@@ -173,18 +189,17 @@ void TestScene::RenderSpawnPoints()
 			pair<com_ptr<ID3D11ShaderResourceView>, XMFLOAT2> spawnPointTextureAndOffset = {};
 			spawnPointTextureAndOffset = ResourceManager::GetInstance().GetTextureAndOffset("Crosshair.png");
 
-			vector<XMVECTOR> insideViewFrustumSpawnPoints = {};
-			copy_if
-			(
-				m_spawnPoints.begin(),
-				m_spawnPoints.end(),
-				back_inserter(insideViewFrustumSpawnPoints),
-				[](const XMVECTOR& point)
-				{
-					BoundingFrustum frustum = CameraComponent::GetMainCamera().GetBoundingFrustum();
-					return frustum.Contains(point) != DirectX::DISJOINT;
-				}
-			);
+			// 생성 지점은 움직이지 않으므로 절두체 평면 근처 지점만 다시 검사
+			const BoundingFrustum& frustum = CameraComponent::GetMainCamera().GetBoundingFrustum();
+			FrameVector<XMVECTOR> insideViewFrustumSpawnPoints = {};
+			m_spawnPointVisibilityCache.BeginQuery(frustum);
+			for (const XMVECTOR& point : m_spawnPoints)
+			{
+				BoundingSphere bounds = {};
+				XMStoreFloat3(&bounds.Center, point);
+				if (m_spawnPointVisibilityCache.IsVisible(&point, bounds, 0, [&]() { return frustum.Contains(point) != DirectX::DISJOINT; })) insideViewFrustumSpawnPoints.push_back(point);
+			}
+			m_spawnPointVisibilityCache.EndQuery();
 
 			for (const XMVECTOR& point : insideViewFrustumSpawnPoints)
 			{
@@ -1,6 +1,8 @@
 // TestScene.h의 시작
 #pragma once
 #include "SceneBase.h"
+#include "SpatialHashGrid.h"
+#include "VisibilityCache.h"
 
 class TestScene : public SceneBase
 {
@@ -10,6 +12,8 @@ class TestScene : public SceneBase
 
 	float m_spawnInterval = 3.0f;
 	std::vector<DirectX::XMVECTOR> m_spawnPoints = {};
+	SpatialHashGrid m_spawnPointGrid = {}; // 플레이어 주변 생성 지점 검색용 // 생성 지점이 바뀌면 다시 구성
+	VisibilityCache m_spawnPointVisibilityCache = {}; // 생성 지점 표시용 절두체 검사 결과
 
 public:
 	TestScene() = default;
@@ -33,6 +37,7 @@ private:
 
 	void TutorialStep();
 
+	void RebuildSpawnPointGrid();
 	void SpawnEnemy(float deltaTime);
 
 	void RenderSpawnPoints();
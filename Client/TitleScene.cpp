@@ -79,6 +79,13 @@ void TitleScene::Update()
 	float dt = TimeManager::GetInstance().GetDeltaTime();
 
 	MovingPanel(dt);
+
+	SceneManager& sceneManager = SceneManager::GetInstance();
+	if (loadingText && sceneManager.IsLoading())
+	{
+		loadingText->SetActive(true);
+		loadingText->SetText("Loading... " + std::to_string(static_cast<int>(sceneManager.GetLoadingProgress() * 100.0f)) + "%");
+	}
 }
 
 void TitleScene::BindUIActions()
@@ -92,6 +99,7 @@ void TitleScene::BindUIActions()
 			else if (panel->GetName() == "Titles") Titles = panel;
 		} else if (auto* text = dynamic_cast<Text*>(uiPtr.get())) {
 			//if (text->GetName() == "result_time") resultTime = text;
+			if (text->GetName() == "loading") loadingText = text;
 		}
 	}
 
@@ -104,7 +112,7 @@ void TitleScene::BindUIActions()
 			std::string key = btn->GetActionKey();
 
 			if (key == "start_game") {
-				btn->SetOnClick([this]() { SceneManager::GetInstance().ChangeScene("TestScene");  });
+				btn->SetOnClick([this]() { if (!SceneManager::GetInstance().IsLoading()) SceneManager::GetInstance().ChangeSceneAsync("TestScene");  });
 			} else if (key == "quit_game") {
 				btn->SetOnClick([]() { PostQuitMessage(0); });
 			} else if (key == "open_option") {
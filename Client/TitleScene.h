@@ -9,6 +9,7 @@ class TitleScene : public SceneBase
 	class Panel* Titles = nullptr;
 	class Panel* Title_letterrbox_down = nullptr;
 	class Panel* Title_letterrbox_up = nullptr;
+	class Text* loadingText = nullptr; // 비동기 씬 전환 진행률 표시 // 씬에 "loading" 텍스트가 있을 때만 사용
 
 	float m_time4MovingPanel = 0;
 	const float kTime4MovingPanel = 2.0f;
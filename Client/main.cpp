@@ -5,6 +5,17 @@
 #include "NavigationManager.h"
 #include "RNG.h"
 #include "SoundManager.h"
+#include "JobSystem.h"
+#include "Microbenchmark.h"
+#include "FrameScheduler.h"
+#include "RenderBackend.h"
+#include "TimeManager.h"
+#include "InputRecorder.h"
+#include "Profiler.h"
+#include "Telemetry.h"
+#include "Benchmark.h"
+#include "MemoryTracker.h"
+#include "BinarySerializer.h"
 
 #include "TestScene.h"
 #include "HyojeTestScene.h"
@@ -13,13 +24,80 @@
 
 using namespace std;
 
-int main()
+int main(int argc, char* argv[])
 {
+	const auto hasArgument = [&](const string& name) { return any_of(argv + 1, argv + argc, [&](const char* argument) { return name == argument; }); };
+	// 인자 다음 값 얻기 // 없으면 nullptr
+	const auto getArgumentValue = [&](const string& name) -> const char*
+		{
+			for (int i = 1; i + 1 < argc; ++i) if (name == argv[i]) return argv[i + 1];
+			return nullptr;
+		};
+
+	#if PROFILER_ENABLED
+	// 메인 스레드 등록 // --trace를 주면 종료 시 링 버퍼에 남은 구역을 Chrome 트레이스로 저장
+	Profiler& profiler = Profiler::GetInstance();
+	profiler.Initialize();
+	const char* tracePath = getArgumentValue("--trace");
+	#endif
+
+	JobSystem& jobSystem = JobSystem::GetInstance();
+	jobSystem.Initialize();
+
+	// 등록된 마이크로벤치마크만 실행하고 종료
+	if (hasArgument("--microbench"))
+	{
+		Microbenchmarks::GetInstance().Run();
+		jobSystem.Finalize();
+
+		return 0;
+	}
+
+	// 씬, 프리팹 JSON을 모두 바이너리로 변환하고 종료 // 빌드 구성과 관계없이 배포 전에 실행
+	if (hasArgument("--cook"))
+	{
+		const bool isCooked = BinarySerializer::GetInstance().CookAll();
+		jobSystem.Finalize();
+
+		return isCooked ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	// 프레임 단계를 메인 스레드에서만 같은 순서로 실행 // 병렬 실행 문제 디버깅용
+	FrameScheduler::GetInstance().SetDeterministic(hasArgument("--deterministic"));
+
+	// 헤드리스 모드 // GPU, 창 없이 고정 델타 타임으로 정해진 프레임 수만큼 실행 후 단계별 CPU 시간 출력
+	// --warp를 함께 주면 Null 대신 소프트웨어 래스터라이저 사용
+	RenderBackend& renderBackend = RenderBackend::GetInstance();
+	const bool isHeadless = hasArgument("--headless");
+	size_t headlessFrameCount = 600;
+	if (const char* frames = getArgumentValue("--frames")) headlessFrameCount = static_cast<size_t>(max(1, atoi(frames)));
+	if (isHeadless)
+	{
+		renderBackend.SetHeadless(true);
+		renderBackend.SetType(RenderBackendType::Null);
+		TimeManager::GetInstance().SetFixedDeltaTime(1.0f / 60.0f);
+	}
+	if (hasArgument("--warp")) renderBackend.SetType(RenderBackendType::Warp);
+
+	// 벤치마크 모드 // 시나리오의 씬, 프리팹 수, 카메라 경로, 입력 재생으로 정해진 프레임 수만큼 실행 후 기준 결과와 비교
+	// --update-baseline을 함께 주면 이번 결과를 기준 결과로 저장
+	Benchmark& benchmark = Benchmark::GetInstance();
+	if (const char* scenarioPath = getArgumentValue("--benchmark"))
+	{
+		if (!benchmark.LoadScenario(scenarioPath))
+		{
+			jobSystem.Finalize();
+			return EXIT_FAILURE;
+		}
+	}
+
 	#ifdef _DEBUG
 	IMGUI_CHECKVERSION();
 	ImGui::CreateContext();
 	ImGuiIO& io = ImGui::GetIO();
-	io.ConfigFlags |= ImGuiConfigFlags_DockingEnable | ImGuiConfigFlags_ViewportsEnable;
+	io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+	// 헤드리스 모드는 별도 창을 만들지 않음
+	if (!isHeadless) io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
 	#endif
 
 	// 윈도우 매니저 초기화 // 렌더러, 인풋 매니저도 내부에서 초기화됨
@@ -30,27 +108,92 @@ int main()
 
 	SceneManager& sceneManager = SceneManager::GetInstance();
 	sceneManager.Initialize();
-	sceneManager.ChangeScene("TestScene");
+
+	// 씬별 JSON, 바이너리 로드 시간 비교만 실행하고 종료
+	if (hasArgument("--compare-scene-load"))
+	{
+		BinarySerializer::GetInstance().CompareSceneLoadTimes(10);
+
+		windowManager.Finalize();
+		sceneManager.Finalize();
+		jobSystem.Finalize();
+
+		#ifdef _DEBUG
+		ImGui::DestroyContext();
+		#endif
+
+		return EXIT_SUCCESS;
+	}
+
+	sceneManager.ChangeScene(benchmark.IsRunning() ? benchmark.GetScenario().sceneName : "TestScene");
 
 	RNG::GetInstance().Initialize();
 
+	// 입력 기록, 재생 // 재생 중에는 기록된 입력, 델타 타임, 난수 시드로 같은 실행을 재현하고 마지막 프레임에서 종료
+	InputRecorder& inputRecorder = InputRecorder::GetInstance();
+	if (const char* replayPath = getArgumentValue("--replay")) inputRecorder.StartReplay(replayPath);
+	else if (const char* recordPath = getArgumentValue("--record")) inputRecorder.StartRecording(recordPath);
+
+	// 시나리오의 시드, 고정 델타 타임, 입력 재생이 위 설정보다 우선
+	if (benchmark.IsRunning()) benchmark.Start();
+
+	// 프레임별 엔진 카운터 수집 // 종료 시 CSV 또는 JSON으로 저장
+	Telemetry& telemetry = Telemetry::GetInstance();
+	if (const char* telemetryPath = getArgumentValue("--telemetry")) telemetry.StartCapture(telemetryPath);
+
+	// 태그별 메모리 예산 // 넘으면 경고
+	if (const char* budgetPath = getArgumentValue("--memory-budgets")) MemoryTracker::GetInstance().LoadBudgets(budgetPath);
+
 	SoundManager& soundManager = SoundManager::GetInstance();
 	soundManager.Initialize();
 
 	GameManager& gameManager = GameManager::GetInstance();
 	gameManager.Initialize();
 
+	size_t frameCount = 0;
 	while (windowManager.ProcessMessages())
 	{
 		soundManager.Update();
 		sceneManager.Run();
+
+		if (benchmark.IsRunning())
+		{
+			if (benchmark.EndFrame()) break;
+		}
+		else if (inputRecorder.IsReplaying())
+		{
+			if (inputRecorder.IsReplayFinished()) break;
+		}
+		else if (isHeadless && ++frameCount >= headlessFrameCount) break;
+	}
+
+	inputRecorder.Finalize();
+	telemetry.Finalize();
+
+	// 기준 결과 대비 회귀가 있으면 실패 코드로 종료
+	int exitCode = EXIT_SUCCESS;
+	if (benchmark.IsRunning() && !benchmark.Finalize(hasArgument("--update-baseline"))) exitCode = EXIT_FAILURE;
+
+	#if PROFILER_ENABLED
+	if (tracePath) profiler.ExportChromeTrace(tracePath);
+	#endif
+
+	if (isHeadless || inputRecorder.GetReplayFrameCount() > 0)
+	{
+		sceneManager.PrintFrameTimings();
+		FrameScheduler::GetInstance().PrintStats();
+		renderBackend.PrintStats();
 	}
 
 	windowManager.Finalize();
 
 	sceneManager.Finalize();
 
+	jobSystem.Finalize();
+
 	#ifdef _DEBUG
 	ImGui::DestroyContext();
 	#endif
+
+	return exitCode;
 }
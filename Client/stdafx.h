@@ -5,18 +5,28 @@
 
 // STL 헤더
 #include <array>
+#include <bit>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <functional>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <typeindex>
 #include <unordered_map>
+#include <unordered_set>
 #include <queue>
 #include <optional>
 #include <cstdint>
 #include <algorithm>
 #include <random>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <span>
+#include <sstream>
 
 // 윈도우 헤더
 #include <winsock2.h>
@@ -1,6 +1,17 @@
 #pragma once
 
 #include "TypeRegistry.h"
+#include "Profiler.h"
+
+class ColliderComponent;
+
+// 충돌 쌍 상태 변화 // 고정 업데이트마다 겹치는 콜라이더 쌍을 이전 단계와 비교해 구함
+enum class CollisionEvent
+{
+	Enter, // 이번 단계에 겹치기 시작
+	Stay, // 이전 단계에 이어 계속 겹침
+	Exit // 이번 단계에 떨어짐
+};
 
 class IBase
 {
@@ -21,20 +32,33 @@ public:
 	#endif
 	virtual void BaseFinalize() = 0;
 
+	// 오브젝트 풀 반환 시 호출
+	virtual void BaseReset() = 0;
+	// 오브젝트 풀에서 재사용 시 호출
+	virtual void BaseReactivate() = 0;
+
+	// 자신 또는 부모가 다시 활성화되어 업데이트, 렌더링 대상이 될 때 호출
+	virtual void BaseEnable() = 0;
+	// 자신 또는 부모가 비활성화되어 업데이트, 렌더링 대상에서 빠질 때 호출
+	virtual void BaseDisable() = 0;
+
+	// 소유 콜라이더가 다른 콜라이더와 겹치기 시작, 유지, 종료될 때 호출 // other는 상대 콜라이더
+	virtual void BaseCollision(CollisionEvent event, ColliderComponent* other) = 0;
+
 	virtual nlohmann::json BaseSerialize() = 0;
 	virtual void BaseDeserialize(const nlohmann::json& jsonData) = 0;
-
-	// 소유한 객체나 자원 중 제거 대기중인 항목이 있으면 모두 제거
-	virtual void RemovePending() = 0;
 };
 
 class Base : public IBase
 {
-	bool m_isActive = true; // 활성화 여부 // TODO: 기능 추가
-	bool m_isAlive = true; // 생존 여부
+	bool m_isActive = true; // 활성화 여부 // 비활성이면 자신과 하위 트리가 업데이트, 렌더링, 충돌 대상에서 빠짐
+	bool m_isAlive = true; // 생존 여부 // false가 되면 게임 오브젝트, 컴포넌트는 다음 프레임 시작 시 제거
 
 protected:
 	std::string m_type = "Base"; // 타입 이름
+	#if PROFILER_ENABLED
+	const char* m_profileName = "Base"; // 생명 주기 프로파일 구역 이름 // 초기화 시 타입 이름을 인턴한 문자열로 설정
+	#endif
 
 public:
 	Base() = default;
@@ -46,9 +70,11 @@ public:
 
 	std::string GetType() const { return m_type; }
 
-	void SetActive(bool isActive) { m_isActive = isActive; }
+	// 활성화 여부 설정 // 게임 오브젝트, 컴포넌트는 활성 목록 갱신 및 활성화, 비활성화 처리
+	virtual void SetActive(bool isActive) { m_isActive = isActive; }
 	bool GetActive() const { return m_isActive; }
-	void SetAlive(bool isAlive) { m_isAlive = isAlive; }
+	// 생존 여부 설정 // 게임 오브젝트, 컴포넌트는 제거 대기열 등록, 취소
+	virtual void SetAlive(bool isAlive) { m_isAlive = isAlive; }
 	bool GetAlive() const { return m_isAlive; }
 
 protected:
@@ -67,6 +93,31 @@ protected:
 	// 파생 클래스의 종료
 	virtual void Finalize() {}
 
+	// 파생 클래스의 풀 반환 처리 // 기본은 종료와 동일
+	virtual void Reset() { Finalize(); }
+	// 파생 클래스의 풀 재사용 처리 // 기본은 초기화와 동일
+	virtual void Reactivate() { Initialize(); }
+
+	// 파생 클래스의 활성화 처리 // 비활성화 때 해제한 전역 목록 등록 복원
+	virtual void OnEnable() {}
+	// 파생 클래스의 비활성화 처리 // 충돌, 선택 등 전역 목록에서 해제
+	virtual void OnDisable() {}
+
+	// 파생 클래스의 충돌 처리 // 고정 업데이트 단계가 끝난 뒤 메인 스레드에서 호출 // other는 상대 콜라이더
+	virtual void OnCollisionEnter(ColliderComponent* other) {}
+	virtual void OnCollisionStay(ColliderComponent* other) {}
+	virtual void OnCollisionExit(ColliderComponent* other) {}
+	// 충돌 상태 변화에 맞는 처리 함수 호출
+	void DispatchCollision(CollisionEvent event, ColliderComponent* other)
+	{
+		switch (event)
+		{
+		case CollisionEvent::Enter: OnCollisionEnter(other); break;
+		case CollisionEvent::Stay: OnCollisionStay(other); break;
+		case CollisionEvent::Exit: OnCollisionExit(other); break;
+		}
+	}
+
 	// 파생 클래스의 직렬화
 	virtual nlohmann::json Serialize() { return nlohmann::json(); }
 	// 파생 클래스의 역직렬화
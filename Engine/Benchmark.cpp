@@ -0,0 +1,276 @@
+#include "stdafx.h"
+#include "Benchmark.h"
+
+#include "SceneBase.h"
+#include "GameObjectBase.h"
+#include "CameraComponent.h"
+#include "TimeManager.h"
+#include "InputRecorder.h"
+#include "RNG.h"
+
+using namespace std;
+using namespace DirectX;
+
+namespace
+{
+	XMFLOAT3 ReadFloat3(const nlohmann::json& jsonData)
+	{
+		return { jsonData[0].get<float>(), jsonData[1].get<float>(), jsonData[2].get<float>() };
+	}
+
+	// 최근접 순위 백분위수 // values는 정렬된 상태
+	double GetPercentile(const vector<double>& values, double percentile)
+	{
+		if (values.empty()) return 0.0;
+
+		const size_t rank = static_cast<size_t>(ceil(percentile * 0.01 * values.size()));
+		return values[min(values.size() - 1, rank > 0 ? rank - 1 : 0)];
+	}
+}
+
+bool Benchmark::LoadScenario(const filesystem::path& filePath)
+{
+	ifstream file(filePath);
+	if (!file)
+	{
+		cerr << "벤치마크 시나리오 파일 열기 실패: " << filePath.string() << endl;
+		return false;
+	}
+
+	const nlohmann::json jsonData = nlohmann::json::parse(file, nullptr, false);
+	if (jsonData.is_discarded() || !jsonData.is_object())
+	{
+		cerr << "벤치마크 시나리오 파싱 실패: " << filePath.string() << endl;
+		return false;
+	}
+
+	m_scenario = {};
+	m_scenario.name = jsonData.value("name", filePath.stem().string());
+	m_scenario.sceneName = jsonData.value("scene", m_scenario.sceneName);
+	m_scenario.frameCount = max<size_t>(1, jsonData.value("frames", m_scenario.frameCount));
+	m_scenario.warmupFrameCount = jsonData.value("warmupFrames", m_scenario.warmupFrameCount);
+	m_scenario.fixedDeltaTime = jsonData.value("fixedDeltaTime", m_scenario.fixedDeltaTime);
+	m_scenario.seed = jsonData.value("seed", m_scenario.seed);
+
+	if (jsonData.contains("spawns"))
+	{
+		for (const nlohmann::json& spawnData : jsonData["spawns"])
+		{
+			BenchmarkSpawn& spawn = m_scenario.spawns.emplace_back();
+			spawn.prefabFileName = spawnData.value("prefab", "");
+			spawn.count = spawnData.value("count", spawn.count);
+			if (spawnData.contains("center")) spawn.center = ReadFloat3(spawnData["center"]);
+			spawn.radius = spawnData.value("radius", spawn.radius);
+		}
+	}
+
+	if (jsonData.contains("cameraPath"))
+	{
+		for (const nlohmann::json& keyData : jsonData["cameraPath"])
+		{
+			m_scenario.cameraPath.push_back
+			(
+				{
+					.time = keyData.value("time", 0.0f),
+					.position = ReadFloat3(keyData["position"]),
+					.target = ReadFloat3(keyData["target"])
+				}
+			);
+		}
+		sort(m_scenario.cameraPath.begin(), m_scenario.cameraPath.end(), [](const auto& a, const auto& b) { return a.time < b.time; });
+	}
+
+	m_scenario.inputReplayPath = jsonData.value("inputReplay", "");
+	m_scenario.baselinePath = jsonData.value("baseline", "");
+	m_scenario.minimumRegressionMs = jsonData.value("minimumRegressionMs", m_scenario.minimumRegressionMs);
+
+	if (jsonData.contains("thresholds"))
+	{
+		for (const auto& [metricName, threshold] : jsonData["thresholds"].items())
+		{
+			if (metricName == "default") m_scenario.defaultThreshold = threshold.get<float>();
+			else m_scenario.thresholds[metricName] = threshold.get<float>();
+		}
+	}
+
+	m_isRunning = true;
+
+	return true;
+}
+
+void Benchmark::Start()
+{
+	TimeManager::GetInstance().SetFixedDeltaTime(m_scenario.fixedDeltaTime);
+	RNG::GetInstance().Initialize(m_scenario.seed);
+
+	if (!m_scenario.inputReplayPath.empty()) InputRecorder::GetInstance().StartReplay(m_scenario.inputReplayPath);
+
+	m_frameIndex = 0;
+	m_frameTimes.clear();
+	m_frameTimes.reserve(m_scenario.frameCount);
+	m_phaseTimings.clear();
+	m_phaseTimings.reserve(m_scenario.frameCount);
+
+	cout << "[벤치마크] " << m_scenario.name << ": " << m_scenario.sceneName << ", 워밍업 " << m_scenario.warmupFrameCount << "프레임, 측정 " << m_scenario.frameCount << "프레임" << endl;
+}
+
+bool Benchmark::EndFrame()
+{
+	const chrono::steady_clock::time_point now = chrono::steady_clock::now();
+
+	// 첫 프레임에 씬이 초기화되므로 이후 생성 // 생성 비용은 워밍업에 포함
+	if (m_frameIndex == 0) Spawn();
+	else if (m_frameIndex > m_scenario.warmupFrameCount)
+	{
+		m_frameTimes.push_back(chrono::duration<double, milli>(now - m_frameEndTime).count());
+		m_phaseTimings.push_back(SceneManager::GetInstance().GetFrameTimings());
+	}
+
+	m_frameIndex++;
+	ApplyCameraPath();
+	m_frameEndTime = chrono::steady_clock::now();
+
+	return m_frameTimes.size() >= m_scenario.frameCount;
+}
+
+bool Benchmark::Finalize(bool updateBaseline)
+{
+	m_isRunning = false;
+	CameraComponent::ClearViewOverride();
+
+	const vector<pair<string, double>> metrics = ComputeMetrics();
+
+	cout << "[벤치마크 결과] " << m_scenario.name << " (" << m_frameTimes.size() << "프레임)" << endl;
+	for (const auto& [metricName, value] : metrics) cout << setw(20) << left << metricName << fixed << setprecision(3) << value << " ms" << endl;
+	cout << defaultfloat;
+
+	if (m_scenario.baselinePath.empty()) return true;
+
+	// 기준 결과 교체
+	if (updateBaseline)
+	{
+		nlohmann::json baselineData = {};
+		baselineData["scenario"] = m_scenario.name;
+		for (const auto& [metricName, value] : metrics) baselineData["metrics"][metricName] = value;
+
+		filesystem::create_directories(m_scenario.baselinePath.parent_path());
+		ofstream baselineFile(m_scenario.baselinePath);
+		if (!baselineFile)
+		{
+			cerr << "벤치마크 기준 결과 파일 열기 실패: " << m_scenario.baselinePath.string() << endl;
+			return false;
+		}
+		baselineFile << baselineData.dump(4);
+
+		cout << "기준 결과 저장: " << m_scenario.baselinePath.string() << endl;
+		return true;
+	}
+
+	ifstream baselineFile(m_scenario.baselinePath);
+	if (!baselineFile)
+	{
+		cout << "기준 결과 없음: " << m_scenario.baselinePath.string() << " // --update-baseline으로 생성" << endl;
+		return true;
+	}
+
+	const nlohmann::json baselineData = nlohmann::json::parse(baselineFile, nullptr, false);
+	if (baselineData.is_discarded() || !baselineData.contains("metrics"))
+	{
+		cerr << "벤치마크 기준 결과 파싱 실패: " << m_scenario.baselinePath.string() << endl;
+		return false;
+	}
+
+	// 허용 증가율과 최소 증가량을 모두 넘으면 회귀
+	bool isPassed = true;
+	const nlohmann::json& baselineMetrics = baselineData["metrics"];
+	for (const auto& [metricName, value] : metrics)
+	{
+		if (!baselineMetrics.contains(metricName)) continue;
+
+		const double baselineValue = baselineMetrics[metricName].get<double>();
+		const auto thresholdIt = m_scenario.thresholds.find(metricName);
+		const double threshold = thresholdIt != m_scenario.thresholds.end() ? thresholdIt->second : m_scenario.defaultThreshold;
+
+		const bool isRegressed = value > baselineValue * (1.0 + threshold) && value - baselineValue > m_scenario.minimumRegressionMs;
+		if (isRegressed)
+		{
+			cerr << "성능 회귀: " << metricName << " " << baselineValue << " ms -> " << value << " ms (허용 " << threshold * 100.0 << "%)" << endl;
+			isPassed = false;
+		}
+	}
+
+	cout << (isPassed ? "기준 결과 대비 통과" : "기준 결과 대비 실패") << endl;
+
+	return isPassed;
+}
+
+void Benchmark::Spawn()
+{
+	SceneBase* scene = SceneManager::GetInstance().GetCurrentScene();
+	if (!scene) return;
+
+	RNG& rng = RNG::GetInstance();
+	for (const BenchmarkSpawn& spawn : m_scenario.spawns)
+	{
+		for (size_t i = 0; i < spawn.count; ++i)
+		{
+			// 원 안 균일 분포
+			const float angle = rng.Range(0.0f, XM_2PI);
+			const float distance = spawn.radius * sqrtf(rng.Range(0.0f, 1.0f));
+
+			GameObjectBase* gameObject = scene->CreatePrefabRootGameObject(spawn.prefabFileName);
+			if (!gameObject) continue;
+			gameObject->SetPosition(XMVectorSet(spawn.center.x + cosf(angle) * distance, spawn.center.y, spawn.center.z + sinf(angle) * distance, 1.0f));
+		}
+	}
+}
+
+void Benchmark::ApplyCameraPath()
+{
+	const vector<BenchmarkCameraKey>& path = m_scenario.cameraPath;
+	if (path.empty()) return;
+
+	const float time = static_cast<float>(m_frameIndex) * m_scenario.fixedDeltaTime;
+
+	// 경로 끝에서는 마지막 키 유지
+	size_t nextIndex = 0;
+	while (nextIndex < path.size() && path[nextIndex].time <= time) ++nextIndex;
+
+	const BenchmarkCameraKey& previousKey = path[nextIndex > 0 ? nextIndex - 1 : 0];
+	const BenchmarkCameraKey& nextKey = path[min(nextIndex, path.size() - 1)];
+
+	const float duration = nextKey.time - previousKey.time;
+	const float t = duration > 0.0f ? clamp((time - previousKey.time) / duration, 0.0f, 1.0f) : 0.0f;
+
+	const XMVECTOR position = XMVectorLerp(XMLoadFloat3(&previousKey.position), XMLoadFloat3(&nextKey.position), t);
+	const XMVECTOR target = XMVectorLerp(XMLoadFloat3(&previousKey.target), XMLoadFloat3(&nextKey.target), t);
+	CameraComponent::SetViewOverride(XMVectorSetW(position, 1.0f), XMVectorSetW(target, 1.0f));
+}
+
+vector<pair<string, double>> Benchmark::ComputeMetrics() const
+{
+	vector<double> sortedFrameTimes = m_frameTimes;
+	sort(sortedFrameTimes.begin(), sortedFrameTimes.end());
+
+	double frameTimeSum = 0.0;
+	for (double frameTime : m_frameTimes) frameTimeSum += frameTime;
+
+	SceneFrameTimings phaseSum = {};
+	for (const SceneFrameTimings& phaseTimings : m_phaseTimings) phaseSum += phaseTimings;
+
+	const double inverseCount = m_frameTimes.empty() ? 0.0 : 1.0 / static_cast<double>(m_frameTimes.size());
+
+	return
+	{
+		{ "frame.mean", frameTimeSum * inverseCount },
+		{ "frame.p50", GetPercentile(sortedFrameTimes, 50.0) },
+		{ "frame.p90", GetPercentile(sortedFrameTimes, 90.0) },
+		{ "frame.p95", GetPercentile(sortedFrameTimes, 95.0) },
+		{ "frame.p99", GetPercentile(sortedFrameTimes, 99.0) },
+		{ "frame.max", sortedFrameTimes.empty() ? 0.0 : sortedFrameTimes.back() },
+		{ "fixedUpdate.mean", phaseSum.fixedUpdate * inverseCount },
+		{ "update.mean", phaseSum.update * inverseCount },
+		{ "render.mean", phaseSum.render * inverseCount },
+		{ "submit.mean", phaseSum.submit * inverseCount }
+	};
+}
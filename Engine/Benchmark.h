@@ -0,0 +1,85 @@
+#pragma once
+#include "SceneManager.h"
+
+// 벤치마크 시작 시 생성할 프리팹 // 중심 주변 원 안에 무작위 배치
+struct BenchmarkSpawn
+{
+	std::string prefabFileName = {};
+	size_t count = 0;
+	DirectX::XMFLOAT3 center = {};
+	float radius = 10.0f;
+};
+
+// 카메라 경로 키 // 키 사이는 선형 보간
+struct BenchmarkCameraKey
+{
+	float time = 0.0f; // 초 단위
+	DirectX::XMFLOAT3 position = {};
+	DirectX::XMFLOAT3 target = {};
+};
+
+// 벤치마크 시나리오 // JSON 파일에서 읽음
+struct BenchmarkScenario
+{
+	std::string name = {};
+	std::string sceneName = "TestScene";
+	size_t frameCount = 600; // 측정 프레임 수
+	size_t warmupFrameCount = 60; // 측정 전 버리는 프레임 수
+	float fixedDeltaTime = 1.0f / 60.0f; // 고정 델타 타임
+	uint32_t seed = 0; // 난수 시드
+
+	std::vector<BenchmarkSpawn> spawns = {};
+	std::vector<BenchmarkCameraKey> cameraPath = {}; // 비어 있으면 씬 카메라 사용
+	std::filesystem::path inputReplayPath = {}; // 비어 있으면 입력 재생 안 함
+
+	std::filesystem::path baselinePath = {}; // 기준 결과 파일
+	float defaultThreshold = 0.1f; // 기준 대비 허용 증가율
+	std::unordered_map<std::string, float> thresholds = {}; // 지표별 허용 증가율
+	double minimumRegressionMs = 0.05; // 이보다 작은 증가는 측정 오차로 보고 무시
+};
+
+// 자동 벤치마크 실행
+// 시나리오의 씬을 고정 델타 타임, 고정 시드로 열고 프리팹을 생성한 뒤 카메라 경로를 따라 정해진 프레임 수만큼 실행
+// 프레임 시간 백분위수와 단계별 평균 시간을 출력하고 기준 결과와 비교해 허용 증가율을 넘으면 실패
+class Benchmark : public Singleton<Benchmark>
+{
+	friend class Singleton<Benchmark>;
+
+	BenchmarkScenario m_scenario = {};
+	bool m_isRunning = false;
+
+	size_t m_frameIndex = 0; // 종료한 프레임 수 // 워밍업 포함
+	std::chrono::steady_clock::time_point m_frameEndTime = {}; // 직전 프레임 종료 시각
+
+	std::vector<double> m_frameTimes = {}; // 측정 프레임별 전체 시간 // 밀리초 단위
+	std::vector<SceneFrameTimings> m_phaseTimings = {}; // 측정 프레임별 단계 시간
+
+public:
+	~Benchmark() = default;
+	Benchmark(const Benchmark&) = delete;
+	Benchmark& operator=(const Benchmark&) = delete;
+	Benchmark(Benchmark&&) = delete;
+	Benchmark& operator=(Benchmark&&) = delete;
+
+	// 시나리오 파일 읽기 // 실패하면 false
+	bool LoadScenario(const std::filesystem::path& filePath);
+	const BenchmarkScenario& GetScenario() const { return m_scenario; }
+	bool IsRunning() const { return m_isRunning; }
+
+	// 시간, 난수 시드, 입력 재생 설정 // 씬 전환 요청 후 첫 프레임 전에 호출
+	void Start();
+	// 메인 루프 매 프레임 끝에 호출 // 첫 프레임에 프리팹 생성 // 측정이 끝나면 true
+	bool EndFrame();
+	// 결과 출력 및 기준 결과 비교 // updateBaseline이면 기준 결과를 이번 결과로 교체 // 허용치를 넘으면 false
+	bool Finalize(bool updateBaseline);
+
+private:
+	Benchmark() = default;
+
+	void Spawn();
+	// 현재 프레임 시각의 카메라 경로 적용
+	void ApplyCameraPath();
+
+	// 비교 지표 // 이름, 밀리초 값
+	std::vector<std::pair<std::string, double>> ComputeMetrics() const;
+};
@@ -0,0 +1,566 @@
+#include "stdafx.h"
+#include "BinarySerializer.h"
+
+#include "SceneBase.h"
+#include "GameObjectBase.h"
+#include "StreamingSceneLoader.h"
+
+using namespace std;
+using namespace DirectX;
+
+// 게임 오브젝트 공통 키 // 나머지 키는 파생 클래스 데이터
+constexpr array<const char*, 7> GAME_OBJECT_KEYS = { "type", "name", "position", "rotation", "scale", "components", "childGameObjects" };
+
+namespace
+{
+	// 같은 폴더의 임시 파일에 쓴 뒤 교체 // 다른 스레드가 읽는 파일은 이전 내용이나 새 내용 중 하나로만 보임
+	// 읽는 중이라 교체할 수 없으면 false
+	bool ReplaceFileContents(const filesystem::path& filePath, string_view contents, ios::openmode mode)
+	{
+		filesystem::path temporaryFilePath = filePath;
+		temporaryFilePath += ".tmp";
+
+		ofstream file(temporaryFilePath, mode | ios::trunc);
+		if (file) file.write(contents.data(), static_cast<streamsize>(contents.size()));
+		file.close();
+
+		if (!file || !MoveFileExW(temporaryFilePath.c_str(), filePath.c_str(), MOVEFILE_REPLACE_EXISTING))
+		{
+			error_code errorCode = {};
+			filesystem::remove(temporaryFilePath, errorCode);
+			return false;
+		}
+
+		return true;
+	}
+}
+
+class BinarySerializer::BinaryWriter
+{
+	vector<uint8_t> m_buffer = {};
+
+public:
+	const vector<uint8_t>& GetBuffer() const { return m_buffer; }
+
+	template<typename T> requires std::is_trivially_copyable_v<T>
+	void Write(const T& value)
+	{
+		const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+		m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+	}
+	void WriteString(const string& value)
+	{
+		Write(static_cast<uint32_t>(value.size()));
+		m_buffer.insert(m_buffer.end(), value.begin(), value.end());
+	}
+	// 길이 접두 MessagePack 블롭 기록 // 비어 있으면 길이 0만 기록
+	void WriteBlob(const nlohmann::json& jsonData)
+	{
+		if (jsonData.is_null() || jsonData.empty()) { Write(static_cast<uint32_t>(0)); return; }
+
+		const vector<uint8_t> blob = nlohmann::json::to_msgpack(jsonData);
+		Write(static_cast<uint32_t>(blob.size()));
+		m_buffer.insert(m_buffer.end(), blob.begin(), blob.end());
+	}
+};
+
+class BinarySerializer::BinaryReader
+{
+	const uint8_t* m_cursor = nullptr;
+	const uint8_t* m_end = nullptr;
+	bool m_isValid = true; // 범위를 벗어나거나 블롭 해석에 실패하면 false
+
+public:
+	BinaryReader(const uint8_t* data, size_t size) : m_cursor(data), m_end(data + size) {}
+
+	bool IsValid() const { return m_isValid; }
+	void Invalidate() { m_isValid = false; }
+
+	template<typename T> requires std::is_trivially_copyable_v<T>
+	T Read()
+	{
+		T value = {};
+		if (!m_isValid || static_cast<size_t>(m_end - m_cursor) < sizeof(T)) { m_isValid = false; return value; }
+
+		memcpy(&value, m_cursor, sizeof(T));
+		m_cursor += sizeof(T);
+
+		return value;
+	}
+	string ReadString()
+	{
+		const uint32_t length = Read<uint32_t>();
+		if (!m_isValid || static_cast<size_t>(m_end - m_cursor) < length) { m_isValid = false; return {}; }
+
+		string value(reinterpret_cast<const char*>(m_cursor), length);
+		m_cursor += length;
+
+		return value;
+	}
+	// 길이 접두 MessagePack 블롭 해석 // 길이 0이면 빈 객체
+	nlohmann::json ReadBlob()
+	{
+		const uint32_t length = Read<uint32_t>();
+		if (!m_isValid || static_cast<size_t>(m_end - m_cursor) < length) { m_isValid = false; return nlohmann::json::object(); }
+		if (length == 0) return nlohmann::json::object();
+
+		nlohmann::json jsonData = nlohmann::json::from_msgpack(m_cursor, m_cursor + length, true, false);
+		m_cursor += length;
+		if (jsonData.is_discarded()) { m_isValid = false; return nlohmann::json::object(); }
+
+		return jsonData;
+	}
+};
+
+// 메모리 맵 파일 // 읽기 전용
+class BinarySerializer::MappedFile
+{
+	HANDLE m_file = INVALID_HANDLE_VALUE;
+	HANDLE m_mapping = nullptr;
+	const uint8_t* m_data = nullptr;
+	size_t m_size = 0;
+
+public:
+	explicit MappedFile(const filesystem::path& filePath)
+	{
+		m_file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (m_file == INVALID_HANDLE_VALUE) return;
+
+		LARGE_INTEGER fileSize = {};
+		if (!GetFileSizeEx(m_file, &fileSize) || fileSize.QuadPart == 0) return;
+
+		m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!m_mapping) return;
+
+		m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+		if (m_data) m_size = static_cast<size_t>(fileSize.QuadPart);
+	}
+	~MappedFile()
+	{
+		if (m_data) UnmapViewOfFile(m_data);
+		if (m_mapping) CloseHandle(m_mapping);
+		if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+	}
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile(MappedFile&&) = delete;
+	MappedFile& operator=(MappedFile&&) = delete;
+
+	const uint8_t* GetData() const { return m_data; }
+	size_t GetSize() const { return m_size; }
+};
+
+bool BinarySerializer::Cook(const filesystem::path& jsonFilePath)
+{
+	if (!filesystem::exists(jsonFilePath)) return false;
+
+	// 백그라운드 씬 로드에서 호출되므로 메인 스레드의 저장과 겹치지 않게 읽기부터 잠금
+	lock_guard<mutex> lock(m_fileMutex);
+
+	ifstream file(jsonFilePath);
+	nlohmann::json jsonData = nlohmann::json::parse(file, nullptr, false);
+	file.close();
+
+	if (jsonData.is_discarded())
+	{
+		cerr << "바이너리 변환 실패: '" << jsonFilePath.string() << "' JSON 파싱 오류" << endl;
+		return false;
+	}
+
+	return WriteBinaryFile(jsonData, GetBinaryPath(jsonFilePath), GetSourceStamp(jsonFilePath));
+}
+
+bool BinarySerializer::Write(const nlohmann::json& jsonData, const filesystem::path& binaryFilePath, uint64_t sourceStamp)
+{
+	lock_guard<mutex> lock(m_fileMutex);
+
+	return WriteBinaryFile(jsonData, binaryFilePath, sourceStamp);
+}
+
+bool BinarySerializer::Save(const nlohmann::json& jsonData, const filesystem::path& jsonFilePath)
+{
+	lock_guard<mutex> lock(m_fileMutex);
+
+	if (!ReplaceFileContents(jsonFilePath, jsonData.dump(4), ios::out))
+	{
+		cerr << "저장 실패: '" << jsonFilePath.string() << "' 파일을 쓸 수 없습니다." << endl;
+		return false;
+	}
+
+	return WriteBinaryFile(jsonData, GetBinaryPath(jsonFilePath), GetSourceStamp(jsonFilePath));
+}
+
+bool BinarySerializer::WriteBinaryFile(const nlohmann::json& jsonData, const filesystem::path& binaryFilePath, uint64_t sourceStamp)
+{
+	const bool isScene = jsonData.contains("rootGameObjects");
+
+	// 타입 테이블 구성
+	vector<string> typeNames = {};
+	if (isScene) for (const auto& gameObjectData : jsonData["rootGameObjects"]) CollectTypeNames(gameObjectData, typeNames);
+	else CollectTypeNames(jsonData, typeNames);
+
+	BinaryWriter writer;
+
+	// 헤더
+	writer.Write(BINARY_MAGIC);
+	writer.Write(BINARY_VERSION);
+	writer.Write(static_cast<uint32_t>(isScene ? BinaryContent::Scene : BinaryContent::Prefab));
+	writer.Write(static_cast<uint32_t>(typeNames.size()));
+	writer.Write(sourceStamp);
+
+	// 타입 테이블
+	for (const string& typeName : typeNames)
+	{
+		writer.WriteString(typeName);
+		writer.Write(GetSchemaHash(typeName));
+	}
+
+	if (isScene)
+	{
+		// 씬 설정은 루트 게임 오브젝트를 제외하고 하나의 블롭으로 기록
+		nlohmann::json sceneSettings = jsonData;
+		sceneSettings.erase("rootGameObjects");
+		writer.WriteBlob(sceneSettings);
+
+		writer.Write(static_cast<uint32_t>(jsonData["rootGameObjects"].size()));
+		for (const auto& gameObjectData : jsonData["rootGameObjects"]) WriteGameObject(writer, gameObjectData, typeNames);
+	}
+	else WriteGameObject(writer, jsonData, typeNames);
+
+	const vector<uint8_t>& buffer = writer.GetBuffer();
+	if (!ReplaceFileContents(binaryFilePath, string_view(reinterpret_cast<const char*>(buffer.data()), buffer.size()), ios::binary))
+	{
+		cerr << "바이너리 변환 실패: '" << binaryFilePath.string() << "' 파일을 쓸 수 없습니다." << endl;
+		return false;
+	}
+
+	return true;
+}
+
+bool BinarySerializer::CookAll()
+{
+	bool isAllCooked = true;
+
+	for (const filesystem::path directory : { "../Asset/Scene/", "../Asset/Prefab/" })
+	{
+		if (!filesystem::exists(directory)) continue;
+
+		for (const auto& entry : filesystem::directory_iterator(directory))
+		{
+			if (entry.path().extension() != ".json") continue;
+
+			if (Cook(entry.path())) cout << "[System] Cooked: " << entry.path().filename().string() << endl;
+			else isAllCooked = false;
+		}
+	}
+
+	return isAllCooked;
+}
+
+void BinarySerializer::CompareSceneLoadTimes(size_t iterationCount)
+{
+	const filesystem::path directory = "../Asset/Scene/";
+	if (!filesystem::exists(directory)) return;
+
+	iterationCount = max<size_t>(iterationCount, 1);
+
+	// 첫 읽기를 제외한 읽기 시간 중앙값 // 실패하면 음수
+	const auto measureMedianMilliseconds = [&](const auto& read) -> double
+		{
+			SceneLoadData warmUpData = {};
+			if (!read(warmUpData)) return -1.0;
+
+			vector<double> elapsedMilliseconds(iterationCount);
+			for (double& elapsed : elapsedMilliseconds)
+			{
+				SceneLoadData loadData = {};
+				const chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+				read(loadData);
+				elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+			}
+			nth_element(elapsedMilliseconds.begin(), elapsedMilliseconds.begin() + iterationCount / 2, elapsedMilliseconds.end());
+
+			return elapsedMilliseconds[iterationCount / 2];
+		};
+
+	for (const auto& entry : filesystem::directory_iterator(directory))
+	{
+		const filesystem::path& sceneFilePath = entry.path();
+		if (sceneFilePath.extension() != ".json" || !Cook(sceneFilePath)) continue;
+
+		const double jsonElapsed = measureMedianMilliseconds([&](SceneLoadData& loadData) { return StreamingSceneLoader::ReadScene(sceneFilePath, loadData); });
+		const double binaryElapsed = measureMedianMilliseconds([&](SceneLoadData& loadData) { return ReadScene(sceneFilePath, loadData); });
+		if (jsonElapsed < 0.0 || binaryElapsed < 0.0)
+		{
+			cerr << "씬 로드 시간 비교 실패: " << sceneFilePath.string() << endl;
+			continue;
+		}
+
+		cout << "[Scene load] " << sceneFilePath.stem().string()
+			<< ": json " << jsonElapsed << "ms (" << filesystem::file_size(sceneFilePath) / 1024 << "KB)"
+			<< ", binary " << binaryElapsed << "ms (" << filesystem::file_size(GetBinaryPath(sceneFilePath)) / 1024 << "KB)"
+			<< ", x" << (binaryElapsed > 0.0 ? jsonElapsed / binaryElapsed : 0.0) << endl;
+	}
+}
+
+bool BinarySerializer::LoadScene(const filesystem::path& jsonFilePath, SceneBase& scene)
+{
+	SceneLoadData loadData = {};
+	if (!ReadScene(jsonFilePath, loadData)) return false;
+
+	scene.CommitLoadData(loadData);
+
+	return true;
+}
+
+bool BinarySerializer::ReadScene(const filesystem::path& jsonFilePath, SceneLoadData& loadData, atomic<float>* progress)
+{
+	MappedFile file(GetBinaryPath(jsonFilePath));
+	if (!file.GetData()) return false;
+
+	BinaryReader reader(file.GetData(), file.GetSize());
+
+	vector<string> typeNames = {};
+	if (!ReadHeader(reader, BinaryContent::Scene, GetSourceStamp(jsonFilePath), typeNames)) return false;
+
+	nlohmann::json sceneSettings = reader.ReadBlob();
+
+	// 모든 게임 오브젝트를 읽은 뒤에 씬에 반영 // 중간에 실패하면 씬은 그대로 둠
+	const uint32_t rootCount = reader.Read<uint32_t>();
+	vector<unique_ptr<GameObjectBase>> rootGameObjects = {};
+	for (uint32_t i = 0; i < rootCount && reader.IsValid(); ++i)
+	{
+		unique_ptr<GameObjectBase> gameObject = ReadGameObject(reader, typeNames, nullptr);
+		if (gameObject) rootGameObjects.push_back(move(gameObject));
+
+		if (progress) progress->store(static_cast<float>(i + 1) / static_cast<float>(rootCount));
+	}
+
+	if (!reader.IsValid())
+	{
+		cerr << "바이너리 씬 로드 실패: '" << GetBinaryPath(jsonFilePath).string() << "' 파일이 손상되었습니다." << endl;
+		return false;
+	}
+
+	loadData.sceneSettings = move(sceneSettings);
+	loadData.rootGameObjects = move(rootGameObjects);
+
+	return true;
+}
+
+optional<nlohmann::json> BinarySerializer::LoadPrefab(const filesystem::path& jsonFilePath)
+{
+	MappedFile file(GetBinaryPath(jsonFilePath));
+	if (!file.GetData()) return nullopt;
+
+	BinaryReader reader(file.GetData(), file.GetSize());
+
+	vector<string> typeNames = {};
+	if (!ReadHeader(reader, BinaryContent::Prefab, GetSourceStamp(jsonFilePath), typeNames)) return nullopt;
+
+	nlohmann::json prefabData = ReadGameObjectJson(reader, typeNames);
+	if (!reader.IsValid()) return nullopt;
+
+	return prefabData;
+}
+
+uint64_t BinarySerializer::GetSourceStamp(const filesystem::path& jsonFilePath)
+{
+	error_code errorCode = {};
+	const filesystem::file_time_type writeTime = filesystem::last_write_time(jsonFilePath, errorCode);
+	if (errorCode) return 0;
+
+	return static_cast<uint64_t>(writeTime.time_since_epoch().count());
+}
+
+uint64_t BinarySerializer::GetSchemaHash(const string& typeName)
+{
+	lock_guard<mutex> lock(m_schemaHashMutex);
+
+	auto it = m_schemaHashes.find(typeName);
+	if (it != m_schemaHashes.end()) return it->second;
+
+	// 기본 객체의 직렬화 키 목록으로 계산 // 키가 추가, 삭제, 변경되면 해시가 바뀜
+	TypeRegistry& typeRegistry = TypeRegistry::GetInstance();
+	nlohmann::json defaultData = {};
+	if (typeRegistry.m_gameObjectRegistry.contains(typeName)) defaultData = static_cast<Base*>(typeRegistry.CreateGameObject(typeName).get())->BaseSerialize();
+	else if (typeRegistry.m_componentRegistry.contains(typeName)) defaultData = static_cast<Base*>(typeRegistry.CreateComponent(typeName).get())->BaseSerialize();
+
+	// FNV-1a 64비트
+	uint64_t hash = 14695981039346656037ull;
+	const auto hashString = [&](const string& value)
+		{
+			for (const char character : value) { hash ^= static_cast<uint8_t>(character); hash *= 1099511628211ull; }
+			hash ^= 0xFF; hash *= 1099511628211ull; // 구분자
+		};
+
+	hashString(typeName);
+	if (defaultData.is_object()) for (const auto& [key, value] : defaultData.items()) hashString(key);
+
+	m_schemaHashes[typeName] = hash;
+
+	return hash;
+}
+
+bool BinarySerializer::ReadHeader(BinaryReader& reader, BinaryContent content, uint64_t sourceStamp, vector<string>& typeNames)
+{
+	const uint32_t magic = reader.Read<uint32_t>();
+	const uint32_t version = reader.Read<uint32_t>();
+	const uint32_t fileContent = reader.Read<uint32_t>();
+	const uint32_t typeCount = reader.Read<uint32_t>();
+	const uint64_t fileSourceStamp = reader.Read<uint64_t>();
+
+	if (!reader.IsValid() || magic != BINARY_MAGIC || version != BINARY_VERSION || fileContent != static_cast<uint32_t>(content)) return false;
+
+	// 원본 JSON이 바이너리보다 새로우면 다시 변환해야 함 // 원본이 없으면 바이너리만 사용
+	if (sourceStamp != 0 && sourceStamp != fileSourceStamp) return false;
+
+	for (uint32_t i = 0; i < typeCount && reader.IsValid(); ++i)
+	{
+		string typeName = reader.ReadString();
+		const uint64_t schemaHash = reader.Read<uint64_t>();
+
+		if (reader.IsValid() && schemaHash != GetSchemaHash(typeName))
+		{
+			cout << "[System] '" << typeName << "' 스키마가 변경되어 JSON으로 로드합니다." << endl;
+			return false;
+		}
+
+		typeNames.push_back(move(typeName));
+	}
+
+	return reader.IsValid();
+}
+
+void BinarySerializer::CollectTypeNames(const nlohmann::json& gameObjectData, vector<string>& typeNames) const
+{
+	const auto addTypeName = [&](const string& typeName) { if (find(typeNames.begin(), typeNames.end(), typeName) == typeNames.end()) typeNames.push_back(typeName); };
+
+	addTypeName(gameObjectData["type"].get<string>());
+	if (gameObjectData.contains("components")) for (const auto& componentData : gameObjectData["components"]) addTypeName(componentData["type"].get<string>());
+	if (gameObjectData.contains("childGameObjects")) for (const auto& childData : gameObjectData["childGameObjects"]) CollectTypeNames(childData, typeNames);
+}
+
+void BinarySerializer::WriteGameObject(BinaryWriter& writer, const nlohmann::json& gameObjectData, const vector<string>& typeNames) const
+{
+	const auto getTypeIndex = [&](const string& typeName) { return static_cast<uint32_t>(distance(typeNames.begin(), find(typeNames.begin(), typeNames.end(), typeName))); };
+	const auto writeVector = [&](const char* key, const array<float, 4>& defaultValue)
+		{
+			array<float, 4> values = defaultValue;
+			if (gameObjectData.contains(key)) for (size_t i = 0; i < values.size() && i < gameObjectData[key].size(); ++i) values[i] = gameObjectData[key][i].get<float>();
+			writer.Write(values);
+		};
+
+	writer.Write(getTypeIndex(gameObjectData["type"].get<string>()));
+	writer.WriteString(gameObjectData.contains("name") ? gameObjectData["name"].get<string>() : string());
+
+	writeVector("position", { 0.0f, 0.0f, 0.0f, 1.0f });
+	writeVector("rotation", { 0.0f, 0.0f, 0.0f, 1.0f });
+	writeVector("scale", { 1.0f, 1.0f, 1.0f, 1.0f });
+
+	// 파생 클래스 데이터
+	nlohmann::json derivedData = nlohmann::json::object();
+	for (const auto& [key, value] : gameObjectData.items())
+	{
+		if (find_if(GAME_OBJECT_KEYS.begin(), GAME_OBJECT_KEYS.end(), [&](const char* gameObjectKey) { return key == gameObjectKey; }) == GAME_OBJECT_KEYS.end()) derivedData[key] = value;
+	}
+	writer.WriteBlob(derivedData);
+
+	// 컴포넌트
+	static const nlohmann::json emptyArray = nlohmann::json::array();
+	const nlohmann::json& componentsData = gameObjectData.contains("components") ? gameObjectData["components"] : emptyArray;
+	writer.Write(static_cast<uint32_t>(componentsData.size()));
+	for (const auto& componentData : componentsData)
+	{
+		writer.Write(getTypeIndex(componentData["type"].get<string>()));
+		writer.WriteBlob(componentData);
+	}
+
+	// 자식 게임 오브젝트
+	const nlohmann::json& childrenData = gameObjectData.contains("childGameObjects") ? gameObjectData["childGameObjects"] : emptyArray;
+	writer.Write(static_cast<uint32_t>(childrenData.size()));
+	for (const auto& childData : childrenData) WriteGameObject(writer, childData, typeNames);
+}
+
+unique_ptr<GameObjectBase> BinarySerializer::ReadGameObject(BinaryReader& reader, const vector<string>& typeNames, GameObjectBase* parent) const
+{
+	const uint32_t typeIndex = reader.Read<uint32_t>();
+	if (!reader.IsValid() || typeIndex >= typeNames.size()) { reader.Invalidate(); return nullptr; }
+
+	unique_ptr<GameObjectBase> gameObject = TypeRegistry::GetInstance().CreateGameObject(typeNames[typeIndex]);
+	gameObject->m_parent = parent;
+	gameObject->m_name = reader.ReadString();
+
+	const array<float, 4> position = reader.Read<array<float, 4>>();
+	const array<float, 4> rotation = reader.Read<array<float, 4>>();
+	const array<float, 4> scale = reader.Read<array<float, 4>>();
+	gameObject->m_position = XMVectorSet(position[0], position[1], position[2], position[3]);
+	gameObject->m_quaternion = XMVectorSet(rotation[0], rotation[1], rotation[2], rotation[3]);
+	gameObject->m_euler = ToDegrees(static_cast<XMVECTOR>(static_cast<SimpleMath::Quaternion>(gameObject->m_quaternion).ToEuler()));
+	gameObject->m_scale = XMVectorSet(scale[0], scale[1], scale[2], scale[3]);
+
+	// 활성 상태, 정적 여부는 파생 데이터 블롭에 함께 기록됨
+	const nlohmann::json derivedData = reader.ReadBlob();
+	if (derivedData.is_object())
+	{
+		gameObject->Base::SetActive(derivedData.value("active", true));
+		gameObject->m_isStatic = derivedData.value("static", false);
+	}
+	gameObject->Deserialize(derivedData);
+
+	const uint32_t componentCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < componentCount && reader.IsValid(); ++i)
+	{
+		const uint32_t componentTypeIndex = reader.Read<uint32_t>();
+		nlohmann::json componentData = reader.ReadBlob();
+		if (!reader.IsValid() || componentTypeIndex >= typeNames.size()) { reader.Invalidate(); break; }
+
+		componentData["type"] = typeNames[componentTypeIndex];
+		gameObject->AddComponentFromJson(componentData);
+	}
+
+	const uint32_t childCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < childCount && reader.IsValid(); ++i)
+	{
+		unique_ptr<GameObjectBase> child = ReadGameObject(reader, typeNames, gameObject.get());
+		if (child) gameObject->AttachChild(move(child));
+	}
+
+	gameObject->SetDirty();
+
+	return reader.IsValid() ? move(gameObject) : nullptr;
+}
+
+nlohmann::json BinarySerializer::ReadGameObjectJson(BinaryReader& reader, const vector<string>& typeNames) const
+{
+	const uint32_t typeIndex = reader.Read<uint32_t>();
+	if (!reader.IsValid() || typeIndex >= typeNames.size()) { reader.Invalidate(); return {}; }
+
+	nlohmann::json gameObjectData = nlohmann::json::object();
+	gameObjectData["type"] = typeNames[typeIndex];
+	gameObjectData["name"] = reader.ReadString();
+	gameObjectData["position"] = reader.Read<array<float, 4>>();
+	gameObjectData["rotation"] = reader.Read<array<float, 4>>();
+	gameObjectData["scale"] = reader.Read<array<float, 4>>();
+
+	const nlohmann::json derivedData = reader.ReadBlob();
+	if (derivedData.is_object()) gameObjectData.update(derivedData);
+
+	gameObjectData["components"] = nlohmann::json::array();
+	const uint32_t componentCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < componentCount && reader.IsValid(); ++i)
+	{
+		const uint32_t componentTypeIndex = reader.Read<uint32_t>();
+		nlohmann::json componentData = reader.ReadBlob();
+		if (!reader.IsValid() || componentTypeIndex >= typeNames.size()) { reader.Invalidate(); break; }
+
+		componentData["type"] = typeNames[componentTypeIndex];
+		gameObjectData["components"].push_back(move(componentData));
+	}
+
+	gameObjectData["childGameObjects"] = nlohmann::json::array();
+	const uint32_t childCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < childCount && reader.IsValid(); ++i) gameObjectData["childGameObjects"].push_back(ReadGameObjectJson(reader, typeNames));
+
+	return gameObjectData;
+}
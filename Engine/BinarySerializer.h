@@ -0,0 +1,87 @@
+#pragma once
+
+class GameObjectBase;
+class SceneBase;
+struct SceneLoadData;
+
+// 바이너리 씬/프리팹 파일 구조 (리틀 엔디안)
+// [헤더] 매직, 버전, 내용 종류, 타입 수, 원본 JSON 수정 시각
+// [타입 테이블] (이름 길이, 이름, 스키마 해시) * 타입 수
+// [씬] 씬 설정 블롭, 루트 게임 오브젝트 수, 게임 오브젝트 * 루트 게임 오브젝트 수
+// [프리팹] 게임 오브젝트
+// [게임 오브젝트] 타입 인덱스, 이름, 위치/회전/크기, 파생 데이터 블롭, 컴포넌트 수, (타입 인덱스, 컴포넌트 블롭) * 컴포넌트 수, 자식 수, 게임 오브젝트 * 자식 수
+// 블롭은 길이(uint32_t) + MessagePack 데이터
+enum class BinaryContent : uint32_t
+{
+	Scene,
+	Prefab
+};
+
+class BinarySerializer : public Singleton<BinarySerializer>
+{
+	friend class Singleton<BinarySerializer>;
+
+	static constexpr uint32_t BINARY_MAGIC = 0x42525541; // "AURB"
+	static constexpr uint32_t BINARY_VERSION = 1;
+
+	class BinaryWriter;
+	class BinaryReader;
+	class MappedFile;
+
+	std::unordered_map<std::string, uint64_t> m_schemaHashes = {}; // 타입 이름별 스키마 해시 캐시
+	std::mutex m_schemaHashMutex = {}; // 백그라운드 씬 로드와 공유하는 스키마 해시 캐시 보호
+	std::mutex m_fileMutex = {}; // 백그라운드 씬 로드의 변환과 메인 스레드 저장이 같은 파일을 동시에 읽고 쓰지 않도록 보호
+
+public:
+	~BinarySerializer() = default;
+	BinarySerializer(const BinarySerializer&) = delete;
+	BinarySerializer& operator=(const BinarySerializer&) = delete;
+	BinarySerializer(BinarySerializer&&) = delete;
+	BinarySerializer& operator=(BinarySerializer&&) = delete;
+
+	// JSON 파일 경로에 대응하는 바이너리 파일 경로
+	static std::filesystem::path GetBinaryPath(const std::filesystem::path& jsonFilePath) { return std::filesystem::path(jsonFilePath).replace_extension(".bin"); }
+
+	// JSON 파일을 바이너리 파일로 변환 // 씬인지 프리팹인지는 rootGameObjects 키로 판단
+	bool Cook(const std::filesystem::path& jsonFilePath);
+	// JSON 데이터를 바이너리 파일로 저장
+	bool Write(const nlohmann::json& jsonData, const std::filesystem::path& binaryFilePath, uint64_t sourceStamp);
+	// JSON 데이터를 JSON 파일과 바이너리 파일로 함께 저장 // 에디터 저장용
+	bool Save(const nlohmann::json& jsonData, const std::filesystem::path& jsonFilePath);
+	// 씬, 프리팹 디렉토리의 모든 JSON 파일 변환 // --cook 실행 인자로 호출 // 하나라도 실패하면 false
+	bool CookAll();
+	// 씬 디렉토리의 모든 씬을 변환한 뒤 JSON 스트리밍과 바이너리로 각각 iterationCount번 읽어 시간 중앙값과 파일 크기를 콘솔에 출력
+	// 리소스 캐시를 채우는 첫 읽기는 제외 // --compare-scene-load 실행 인자로 호출
+	void CompareSceneLoadTimes(size_t iterationCount);
+
+	// 바이너리 씬 파일로부터 씬 로드 // 원본 JSON보다 오래됐거나 스키마가 바뀌었으면 아무것도 하지 않고 false 반환
+	bool LoadScene(const std::filesystem::path& jsonFilePath, SceneBase& scene);
+	// 바이너리 씬 파일을 씬에 반영하지 않고 읽기 // 백그라운드 스레드에서 호출 가능 // progress에 루트 게임 오브젝트 기준 진행률(0~1) 기록
+	bool ReadScene(const std::filesystem::path& jsonFilePath, SceneLoadData& loadData, std::atomic<float>* progress = nullptr);
+	// 바이너리 프리팹 파일을 JSON 데이터로 로드 // 프리팹 캐시용
+	std::optional<nlohmann::json> LoadPrefab(const std::filesystem::path& jsonFilePath);
+
+	// 원본 JSON 파일 수정 시각 // 파일이 없으면 0
+	static uint64_t GetSourceStamp(const std::filesystem::path& jsonFilePath);
+	// 타입의 스키마 해시 // 기본 객체 직렬화 결과의 키 목록으로 계산
+	uint64_t GetSchemaHash(const std::string& typeName);
+
+private:
+	BinarySerializer() = default;
+
+	// 바이너리 파일 쓰기 // m_fileMutex를 잠근 상태에서 호출
+	bool WriteBinaryFile(const nlohmann::json& jsonData, const std::filesystem::path& binaryFilePath, uint64_t sourceStamp);
+
+	// 헤더 및 타입 테이블 검사 // 실패 시 false
+	bool ReadHeader(BinaryReader& reader, BinaryContent content, uint64_t sourceStamp, std::vector<std::string>& typeNames);
+
+	// 게임 오브젝트 JSON에서 사용하는 타입 이름 수집
+	void CollectTypeNames(const nlohmann::json& gameObjectData, std::vector<std::string>& typeNames) const;
+	// 게임 오브젝트 JSON을 바이너리로 기록
+	void WriteGameObject(BinaryWriter& writer, const nlohmann::json& gameObjectData, const std::vector<std::string>& typeNames) const;
+
+	// 바이너리에서 게임 오브젝트 생성 // 역직렬화만 하고 초기화는 호출하지 않음
+	std::unique_ptr<GameObjectBase> ReadGameObject(BinaryReader& reader, const std::vector<std::string>& typeNames, GameObjectBase* parent) const;
+	// 바이너리에서 게임 오브젝트 JSON 복원
+	nlohmann::json ReadGameObjectJson(BinaryReader& reader, const std::vector<std::string>& typeNames) const;
+};
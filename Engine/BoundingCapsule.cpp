@@ -0,0 +1,580 @@
+#include "stdafx.h"
+#include "BoundingCapsule.h"
+
+#include "Microbenchmark.h"
+
+using namespace std;
+using namespace DirectX;
+
+REGISTER_MICROBENCHMARK(BoundingCapsule, BoundingCapsule::RunMicrobenchmarks)
+
+namespace
+{
+	// 선분 위에서 점과 가장 가까운 점의 매개변수 // 0이면 시작점, 1이면 끝점
+	float GetClosestSegmentParameter(const XMVECTOR& start, const XMVECTOR& end, const XMVECTOR& point)
+	{
+		const XMVECTOR segment = XMVectorSubtract(end, start);
+		const float lengthSquared = XMVectorGetX(XMVector3Dot(segment, segment));
+		if (lengthSquared <= numeric_limits<float>::epsilon()) return 0.0f;
+
+		return clamp(XMVectorGetX(XMVector3Dot(XMVectorSubtract(point, start), segment)) / lengthSquared, 0.0f, 1.0f);
+	}
+
+	// 두 선분에서 서로 가장 가까운 두 점
+	void GetClosestSegmentPoints(const XMVECTOR& startA, const XMVECTOR& endA, const XMVECTOR& startB, const XMVECTOR& endB, _Out_ XMVECTOR& closestA, _Out_ XMVECTOR& closestB)
+	{
+		const XMVECTOR directionA = XMVectorSubtract(endA, startA);
+		const XMVECTOR directionB = XMVectorSubtract(endB, startB);
+		const XMVECTOR offset = XMVectorSubtract(startA, startB);
+
+		const float lengthSquaredA = XMVectorGetX(XMVector3Dot(directionA, directionA));
+		const float lengthSquaredB = XMVectorGetX(XMVector3Dot(directionB, directionB));
+		const float offsetDotB = XMVectorGetX(XMVector3Dot(directionB, offset));
+		constexpr float EPSILON = numeric_limits<float>::epsilon();
+
+		// 각 선분의 매개변수 // 무한 직선끼리 가장 가까운 점을 구한 뒤 선분 범위로 자름
+		float s = 0.0f;
+		float t = 0.0f;
+		if (lengthSquaredA <= EPSILON)
+		{
+			if (lengthSquaredB > EPSILON) t = clamp(offsetDotB / lengthSquaredB, 0.0f, 1.0f);
+		}
+		else
+		{
+			const float offsetDotA = XMVectorGetX(XMVector3Dot(directionA, offset));
+			if (lengthSquaredB <= EPSILON) s = clamp(-offsetDotA / lengthSquaredA, 0.0f, 1.0f);
+			else
+			{
+				const float directionDot = XMVectorGetX(XMVector3Dot(directionA, directionB));
+				const float denominator = lengthSquaredA * lengthSquaredB - directionDot * directionDot;
+
+				// 평행하면 아무 점에서 시작
+				if (denominator > EPSILON) s = clamp((directionDot * offsetDotB - offsetDotA * lengthSquaredB) / denominator, 0.0f, 1.0f);
+				t = (directionDot * s + offsetDotB) / lengthSquaredB;
+
+				if (t < 0.0f)
+				{
+					t = 0.0f;
+					s = clamp(-offsetDotA / lengthSquaredA, 0.0f, 1.0f);
+				}
+				else if (t > 1.0f)
+				{
+					t = 1.0f;
+					s = clamp((directionDot - offsetDotA) / lengthSquaredA, 0.0f, 1.0f);
+				}
+			}
+		}
+
+		closestA = XMVectorMultiplyAdd(directionA, XMVectorReplicate(s), startA);
+		closestB = XMVectorMultiplyAdd(directionB, XMVectorReplicate(t), startB);
+	}
+
+	// 두 선분 사이 최단 거리 제곱
+	float GetSegmentDistanceSquared(const XMVECTOR& startA, const XMVECTOR& endA, const XMVECTOR& startB, const XMVECTOR& endB)
+	{
+		XMVECTOR closestA = {};
+		XMVECTOR closestB = {};
+		GetClosestSegmentPoints(startA, endA, startB, endB, closestA, closestB);
+
+		return XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(closestA, closestB)));
+	}
+
+	// 원점 중심 축 정렬 상자와 점 사이 거리 제곱
+	float GetBoxDistanceSquared(const XMVECTOR& extents, const XMVECTOR& point)
+	{
+		const XMVECTOR outside = XMVectorMax(XMVectorSubtract(XMVectorAbs(point), extents), XMVectorZero());
+		return XMVectorGetX(XMVector3LengthSq(outside));
+	}
+
+	// 원점 중심 축 정렬 상자와 선분 사이 거리 제곱 // parameter에 선분 위 가장 가까운 점의 매개변수 기록
+	float GetBoxSegmentDistanceSquared(const XMVECTOR& extents, const XMVECTOR& start, const XMVECTOR& end, _Out_ float& parameter)
+	{
+		const XMVECTOR segment = XMVectorSubtract(end, start);
+
+		// 선분이 상자를 지나면 0 // 평판 검사
+		const XMVECTOR inverseSegment = XMVectorReciprocal(segment);
+		const XMVECTOR t1 = XMVectorMultiply(XMVectorSubtract(XMVectorNegate(extents), start), inverseSegment);
+		const XMVECTOR t2 = XMVectorMultiply(XMVectorSubtract(extents, start), inverseSegment);
+		XMFLOAT3 nearT = {};
+		XMFLOAT3 farT = {};
+		XMStoreFloat3(&nearT, XMVectorMin(t1, t2));
+		XMStoreFloat3(&farT, XMVectorMax(t1, t2));
+		// 선분과 평행한 축은 무한대나 NaN이 되므로 시작점이 그 축 범위 안인지 따로 확인
+		XMFLOAT3 segmentValue = {};
+		XMFLOAT3 startValue = {};
+		XMFLOAT3 extentsValue = {};
+		XMStoreFloat3(&segmentValue, segment);
+		XMStoreFloat3(&startValue, start);
+		XMStoreFloat3(&extentsValue, extents);
+		float entry = 0.0f;
+		float exit = 1.0f;
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			if (abs((&segmentValue.x)[axis]) <= numeric_limits<float>::epsilon())
+			{
+				if (abs((&startValue.x)[axis]) > (&extentsValue.x)[axis]) exit = -1.0f;
+				continue;
+			}
+			entry = max(entry, (&nearT.x)[axis]);
+			exit = min(exit, (&farT.x)[axis]);
+		}
+		if (entry <= exit)
+		{
+			parameter = entry;
+			return 0.0f;
+		}
+
+		// 거리는 매개변수에 대해 볼록하므로 황금 분할 탐색으로 최솟값
+		constexpr float INVERSE_GOLDEN_RATIO = 0.618034f;
+		const auto getDistanceSquared = [&](float parameter) { return GetBoxDistanceSquared(extents, XMVectorMultiplyAdd(segment, XMVectorReplicate(parameter), start)); };
+
+		float low = 0.0f;
+		float high = 1.0f;
+		float left = high - (high - low) * INVERSE_GOLDEN_RATIO;
+		float right = low + (high - low) * INVERSE_GOLDEN_RATIO;
+		float leftDistance = getDistanceSquared(left);
+		float rightDistance = getDistanceSquared(right);
+		for (size_t iteration = 0; iteration < 24; ++iteration)
+		{
+			if (leftDistance < rightDistance)
+			{
+				high = right;
+				right = left;
+				rightDistance = leftDistance;
+				left = high - (high - low) * INVERSE_GOLDEN_RATIO;
+				leftDistance = getDistanceSquared(left);
+			}
+			else
+			{
+				low = left;
+				left = right;
+				leftDistance = rightDistance;
+				right = low + (high - low) * INVERSE_GOLDEN_RATIO;
+				rightDistance = getDistanceSquared(right);
+			}
+		}
+
+		const array<pair<float, float>, 4> candidates = { { { leftDistance, left }, { rightDistance, right }, { getDistanceSquared(0.0f), 0.0f }, { getDistanceSquared(1.0f), 1.0f } } };
+		const pair<float, float>& closest = *min_element(candidates.begin(), candidates.end());
+		parameter = closest.second;
+		return closest.first;
+	}
+
+	// 광선과 구의 진입 거리 // 방향은 정규화되어 있어야 함 // 뒤에 있거나 지나지 않으면 음수
+	float IntersectSphere(const XMVECTOR& origin, const XMVECTOR& direction, const XMVECTOR& center, float radius)
+	{
+		const XMVECTOR offset = XMVectorSubtract(origin, center);
+		const float b = XMVectorGetX(XMVector3Dot(offset, direction));
+		const float c = XMVectorGetX(XMVector3Dot(offset, offset)) - radius * radius;
+		if (c > 0.0f && b > 0.0f) return -1.0f;
+
+		const float discriminant = b * b - c;
+		if (discriminant < 0.0f) return -1.0f;
+
+		return -b - sqrt(discriminant);
+	}
+
+	// from에서 to로 가는 거리와 단위 방향 // 같은 점이면 방향은 0
+	float GetSeparation(const XMVECTOR& to, const XMVECTOR& from, _Out_ XMVECTOR& direction)
+	{
+		const XMVECTOR offset = XMVectorSubtract(to, from);
+		const float distance = XMVectorGetX(XMVector3Length(offset));
+		direction = distance > numeric_limits<float>::epsilon() ? XMVectorScale(offset, 1.0f / distance) : XMVectorZero();
+
+		return distance;
+	}
+
+	// 삼각형 위에서 점과 가장 가까운 점 // 꼭짓점, 모서리, 면 영역 순으로 판정
+	XMVECTOR GetClosestTrianglePoint(const XMVECTOR& point, const XMVECTOR& v0, const XMVECTOR& v1, const XMVECTOR& v2)
+	{
+		const XMVECTOR edge1 = XMVectorSubtract(v1, v0);
+		const XMVECTOR edge2 = XMVectorSubtract(v2, v0);
+
+		const XMVECTOR offset0 = XMVectorSubtract(point, v0);
+		const float d1 = XMVectorGetX(XMVector3Dot(edge1, offset0));
+		const float d2 = XMVectorGetX(XMVector3Dot(edge2, offset0));
+		if (d1 <= 0.0f && d2 <= 0.0f) return v0;
+
+		const XMVECTOR offset1 = XMVectorSubtract(point, v1);
+		const float d3 = XMVectorGetX(XMVector3Dot(edge1, offset1));
+		const float d4 = XMVectorGetX(XMVector3Dot(edge2, offset1));
+		if (d3 >= 0.0f && d4 <= d3) return v1;
+
+		const float areaC = d1 * d4 - d3 * d2;
+		if (areaC <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return XMVectorMultiplyAdd(edge1, XMVectorReplicate(d1 / (d1 - d3)), v0);
+
+		const XMVECTOR offset2 = XMVectorSubtract(point, v2);
+		const float d5 = XMVectorGetX(XMVector3Dot(edge1, offset2));
+		const float d6 = XMVectorGetX(XMVector3Dot(edge2, offset2));
+		if (d6 >= 0.0f && d5 <= d6) return v2;
+
+		const float areaB = d5 * d2 - d1 * d6;
+		if (areaB <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return XMVectorMultiplyAdd(edge2, XMVectorReplicate(d2 / (d2 - d6)), v0);
+
+		const float areaA = d3 * d6 - d5 * d4;
+		if (areaA <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) return XMVectorLerp(v1, v2, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+		// 넓이가 0인 삼각형은 모서리 검사에 맡김
+		const float area = areaA + areaB + areaC;
+		if (area <= numeric_limits<float>::epsilon()) return v0;
+
+		return XMVectorAdd(v0, XMVectorAdd(XMVectorScale(edge1, areaB / area), XMVectorScale(edge2, areaC / area)));
+	}
+
+	// 선분이 삼각형을 지나는지 // 양면 // 평행하면 false이므로 모서리 거리로 판정해야 함
+	bool CrossesTriangle(const XMVECTOR& start, const XMVECTOR& end, const XMVECTOR& v0, const XMVECTOR& v1, const XMVECTOR& v2)
+	{
+		const XMVECTOR segment = XMVectorSubtract(end, start);
+		const XMVECTOR edge1 = XMVectorSubtract(v1, v0);
+		const XMVECTOR edge2 = XMVectorSubtract(v2, v0);
+
+		const XMVECTOR p = XMVector3Cross(segment, edge2);
+		const float determinant = XMVectorGetX(XMVector3Dot(edge1, p));
+		if (abs(determinant) <= numeric_limits<float>::epsilon()) return false;
+		const float inverseDeterminant = 1.0f / determinant;
+
+		const XMVECTOR offset = XMVectorSubtract(start, v0);
+		const float u = XMVectorGetX(XMVector3Dot(offset, p)) * inverseDeterminant;
+		if (u < 0.0f || u > 1.0f) return false;
+
+		const XMVECTOR q = XMVector3Cross(offset, edge1);
+		const float v = XMVectorGetX(XMVector3Dot(segment, q)) * inverseDeterminant;
+		if (v < 0.0f || u + v > 1.0f) return false;
+
+		const float t = XMVectorGetX(XMVector3Dot(edge2, q)) * inverseDeterminant;
+		return t >= 0.0f && t <= 1.0f;
+	}
+}
+
+void BoundingCapsule::Transform(_Out_ BoundingCapsule& out, FXMMATRIX matrix) const
+{
+	XMStoreFloat3(&out.pointA, XMVector3Transform(XMLoadFloat3(&pointA), matrix));
+	XMStoreFloat3(&out.pointB, XMVector3Transform(XMLoadFloat3(&pointB), matrix));
+
+	const XMVECTOR maxScaleSquared = XMVectorMax(XMVectorMax(XMVector3LengthSq(matrix.r[0]), XMVector3LengthSq(matrix.r[1])), XMVector3LengthSq(matrix.r[2]));
+	out.radius = radius * sqrt(XMVectorGetX(maxScaleSquared));
+}
+
+BoundingBox BoundingCapsule::GetBounds() const
+{
+	const XMVECTOR a = XMLoadFloat3(&pointA);
+	const XMVECTOR b = XMLoadFloat3(&pointB);
+	const XMVECTOR radiusVector = XMVectorReplicate(radius);
+
+	BoundingBox bounds = {};
+	BoundingBox::CreateFromPoints(bounds, XMVectorSubtract(XMVectorMin(a, b), radiusVector), XMVectorAdd(XMVectorMax(a, b), radiusVector));
+
+	return bounds;
+}
+
+bool BoundingCapsule::Intersects(const BoundingSphere& sphere) const
+{
+	const XMVECTOR a = XMLoadFloat3(&pointA);
+	const XMVECTOR b = XMLoadFloat3(&pointB);
+	const XMVECTOR center = XMLoadFloat3(&sphere.Center);
+
+	const XMVECTOR closest = XMVectorLerp(a, b, GetClosestSegmentParameter(a, b, center));
+	const float radiusSum = radius + sphere.Radius;
+
+	return XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(center, closest))) <= radiusSum * radiusSum;
+}
+
+bool BoundingCapsule::Intersects(const BoundingBox& box) const
+{
+	const XMVECTOR center = XMLoadFloat3(&box.Center);
+
+	float parameter = 0.0f;
+	return GetBoxSegmentDistanceSquared(XMLoadFloat3(&box.Extents), XMVectorSubtract(XMLoadFloat3(&pointA), center), XMVectorSubtract(XMLoadFloat3(&pointB), center), parameter) <= radius * radius;
+}
+
+bool BoundingCapsule::Intersects(const BoundingOrientedBox& obb) const
+{
+	// 선분을 상자 로컬 좌표계로 옮겨 축 정렬 상자와 검사
+	const XMVECTOR center = XMLoadFloat3(&obb.Center);
+	const XMVECTOR orientation = XMLoadFloat4(&obb.Orientation);
+	const XMVECTOR localA = XMVector3InverseRotate(XMVectorSubtract(XMLoadFloat3(&pointA), center), orientation);
+	const XMVECTOR localB = XMVector3InverseRotate(XMVectorSubtract(XMLoadFloat3(&pointB), center), orientation);
+
+	float parameter = 0.0f;
+	return GetBoxSegmentDistanceSquared(XMLoadFloat3(&obb.Extents), localA, localB, parameter) <= radius * radius;
+}
+
+bool BoundingCapsule::Intersects(const BoundingFrustum& frustum) const
+{
+	// 평면 법선은 바깥쪽 // 안쪽 점은 평면 거리 0 이하
+	array<XMVECTOR, 6> planes = {};
+	frustum.GetPlanes(&planes[0], &planes[1], &planes[2], &planes[3], &planes[4], &planes[5]);
+
+	const XMVECTOR a = XMVectorSetW(XMLoadFloat3(&pointA), 1.0f);
+	const XMVECTOR b = XMVectorSetW(XMLoadFloat3(&pointB), 1.0f);
+	for (const XMVECTOR& plane : planes)
+	{
+		if (XMVectorGetX(XMPlaneDot(plane, a)) > radius && XMVectorGetX(XMPlaneDot(plane, b)) > radius) return false;
+	}
+
+	return true;
+}
+
+bool BoundingCapsule::Intersects(const BoundingCapsule& capsule) const
+{
+	const float radiusSum = radius + capsule.radius;
+
+	return GetSegmentDistanceSquared(XMLoadFloat3(&pointA), XMLoadFloat3(&pointB), XMLoadFloat3(&capsule.pointA), XMLoadFloat3(&capsule.pointB)) <= radiusSum * radiusSum;
+}
+
+bool BoundingCapsule::Intersects(FXMVECTOR origin, FXMVECTOR direction, _Out_ float& distance) const
+{
+	distance = 0.0f;
+
+	const XMVECTOR a = XMLoadFloat3(&pointA);
+	const XMVECTOR b = XMLoadFloat3(&pointB);
+	const XMVECTOR closest = XMVectorLerp(a, b, GetClosestSegmentParameter(a, b, origin));
+	if (XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(origin, closest))) <= radius * radius) return true;
+
+	// 캡슐은 원기둥과 양 끝 구의 합집합 // 시작점이 밖에 있으므로 가장 가까운 진입 거리가 답
+	float closestDistance = numeric_limits<float>::max();
+	const auto accept = [&](float candidate) { if (candidate >= 0.0f && candidate < closestDistance) closestDistance = candidate; };
+
+	accept(IntersectSphere(origin, direction, a, radius));
+	accept(IntersectSphere(origin, direction, b, radius));
+
+	// 무한 원기둥과 교차한 뒤 선분 범위 안인지 확인
+	const XMVECTOR axis = XMVectorSubtract(b, a);
+	const XMVECTOR offset = XMVectorSubtract(origin, a);
+	const float axisDotAxis = XMVectorGetX(XMVector3Dot(axis, axis));
+	const float axisDotOffset = XMVectorGetX(XMVector3Dot(axis, offset));
+	const float axisDotDirection = XMVectorGetX(XMVector3Dot(axis, direction));
+	const float offsetDotDirection = XMVectorGetX(XMVector3Dot(offset, direction));
+
+	const float qa = axisDotAxis - axisDotDirection * axisDotDirection;
+	const float qb = axisDotAxis * offsetDotDirection - axisDotOffset * axisDotDirection;
+	const float qc = axisDotAxis * (XMVectorGetX(XMVector3Dot(offset, offset)) - radius * radius) - axisDotOffset * axisDotOffset;
+	// 축과 평행하면 양 끝 구에서만 진입
+	if (qa > numeric_limits<float>::epsilon() * axisDotAxis)
+	{
+		const float discriminant = qb * qb - qa * qc;
+		if (discriminant >= 0.0f)
+		{
+			const float t = (-qb - sqrt(discriminant)) / qa;
+			const float axisPosition = axisDotOffset + t * axisDotDirection;
+			if (axisPosition >= 0.0f && axisPosition <= axisDotAxis) accept(t);
+		}
+	}
+
+	if (closestDistance == numeric_limits<float>::max()) return false;
+
+	distance = closestDistance;
+	return true;
+}
+
+float BoundingCapsule::GetAxisDistance(const BoundingSphere& sphere, _Out_ XMVECTOR& direction) const
+{
+	const XMVECTOR a = XMLoadFloat3(&pointA);
+	const XMVECTOR b = XMLoadFloat3(&pointB);
+	const XMVECTOR center = XMLoadFloat3(&sphere.Center);
+
+	return GetSeparation(XMVectorLerp(a, b, GetClosestSegmentParameter(a, b, center)), center, direction) - sphere.Radius;
+}
+
+float BoundingCapsule::GetAxisDistance(const BoundingBox& box, _Out_ XMVECTOR& direction) const
+{
+	const XMVECTOR center = XMLoadFloat3(&box.Center);
+	const XMVECTOR extents = XMLoadFloat3(&box.Extents);
+	const XMVECTOR localA = XMVectorSubtract(XMLoadFloat3(&pointA), center);
+	const XMVECTOR localB = XMVectorSubtract(XMLoadFloat3(&pointB), center);
+
+	float parameter = 0.0f;
+	GetBoxSegmentDistanceSquared(extents, localA, localB, parameter);
+	const XMVECTOR closest = XMVectorLerp(localA, localB, parameter);
+
+	return GetSeparation(closest, XMVectorClamp(closest, XMVectorNegate(extents), extents), direction);
+}
+
+float BoundingCapsule::GetAxisDistance(const BoundingOrientedBox& obb, _Out_ XMVECTOR& direction) const
+{
+	// 상자 로컬 좌표계에서 구한 방향을 다시 돌림
+	const XMVECTOR orientation = XMLoadFloat4(&obb.Orientation);
+	BoundingCapsule localCapsule = {};
+	XMStoreFloat3(&localCapsule.pointA, XMVector3InverseRotate(XMVectorSubtract(XMLoadFloat3(&pointA), XMLoadFloat3(&obb.Center)), orientation));
+	XMStoreFloat3(&localCapsule.pointB, XMVector3InverseRotate(XMVectorSubtract(XMLoadFloat3(&pointB), XMLoadFloat3(&obb.Center)), orientation));
+
+	const float distance = localCapsule.GetAxisDistance(BoundingBox({}, obb.Extents), direction);
+	direction = XMVector3Rotate(direction, orientation);
+
+	return distance;
+}
+
+float BoundingCapsule::GetAxisDistance(const BoundingCapsule& capsule, _Out_ XMVECTOR& direction) const
+{
+	XMVECTOR closest = {};
+	XMVECTOR otherClosest = {};
+	GetClosestSegmentPoints(XMLoadFloat3(&pointA), XMLoadFloat3(&pointB), XMLoadFloat3(&capsule.pointA), XMLoadFloat3(&capsule.pointB), closest, otherClosest);
+
+	return GetSeparation(closest, otherClosest, direction) - capsule.radius;
+}
+
+float BoundingCapsule::GetAxisDistance(FXMVECTOR v0, FXMVECTOR v1, FXMVECTOR v2, _Out_ XMVECTOR& direction) const
+{
+	const XMVECTOR a = XMLoadFloat3(&pointA);
+	const XMVECTOR b = XMLoadFloat3(&pointB);
+
+	direction = XMVectorZero();
+	if (CrossesTriangle(a, b, v0, v1, v2)) return 0.0f;
+
+	// 지나지 않으면 가장 가까운 두 점은 선분 끝점과 삼각형 사이, 또는 선분과 삼각형 모서리 사이에 있음
+	float closestDistanceSquared = numeric_limits<float>::max();
+	XMVECTOR closestAxisPoint = a;
+	XMVECTOR closestTrianglePoint = v0;
+	const auto accept = [&](const XMVECTOR& axisPoint, const XMVECTOR& trianglePoint)
+		{
+			const float distanceSquared = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(axisPoint, trianglePoint)));
+			if (distanceSquared >= closestDistanceSquared) return;
+
+			closestDistanceSquared = distanceSquared;
+			closestAxisPoint = axisPoint;
+			closestTrianglePoint = trianglePoint;
+		};
+
+	accept(a, GetClosestTrianglePoint(a, v0, v1, v2));
+	accept(b, GetClosestTrianglePoint(b, v0, v1, v2));
+	const array<pair<XMVECTOR, XMVECTOR>, 3> edges = { { { v0, v1 }, { v1, v2 }, { v2, v0 } } };
+	for (const auto& [edgeStart, edgeEnd] : edges)
+	{
+		XMVECTOR axisPoint = {};
+		XMVECTOR edgePoint = {};
+		GetClosestSegmentPoints(a, b, edgeStart, edgeEnd, axisPoint, edgePoint);
+		accept(axisPoint, edgePoint);
+	}
+
+	return GetSeparation(closestAxisPoint, closestTrianglePoint, direction);
+}
+
+void CapsuleSweepTargets::Clear()
+{
+	spheres.clear();
+	boxes.clear();
+	orientedBoxes.clear();
+	capsules.clear();
+	triangles.clear();
+}
+
+bool CapsuleSweepTargets::Sweep(const BoundingCapsule& capsule, FXMVECTOR displacement, _Out_ Hit& hit) const
+{
+	hit = {};
+	if (XMVectorGetX(XMVector3Length(displacement)) <= numeric_limits<float>::epsilon()) return false;
+
+	const XMVECTOR a = XMLoadFloat3(&capsule.pointA);
+	const XMVECTOR b = XMLoadFloat3(&capsule.pointB);
+
+	float fraction = 0.0f;
+	for (size_t iteration = 0; iteration < MAX_ADVANCE_ITERATIONS; ++iteration)
+	{
+		BoundingCapsule moved = capsule;
+		XMStoreFloat3(&moved.pointA, XMVectorMultiplyAdd(displacement, XMVectorReplicate(fraction), a));
+		XMStoreFloat3(&moved.pointB, XMVectorMultiplyAdd(displacement, XMVectorReplicate(fraction), b));
+
+		// 모양마다 다음에 닿을 수 있는 가장 이른 비율 // 볼록 모양과의 거리는 평행 이동 비율에 대해 볼록이므로 지금 접근 속도로 나눈 만큼은 닿지 않음
+		float step = numeric_limits<float>::max();
+		float blockingApproach = 0.0f;
+		const auto evaluate = [&](float axisDistance, const XMVECTOR& direction, const void* userData)
+			{
+				// 멀어지거나 나란히 움직이면 닿지 않음 // 축이 모양 안에 있어 방향을 모르면 막지 않음
+				const float approach = -XMVectorGetX(XMVector3Dot(displacement, direction));
+				if (approach <= 0.0f) return;
+
+				const float gap = axisDistance - capsule.radius;
+				const float candidate = gap <= CONTACT_DISTANCE ? 0.0f : gap / approach;
+				// 이미 닿은 모양이 여럿이면 가장 정면으로 막는 모양
+				if (candidate > step || (candidate == step && approach <= blockingApproach)) return;
+
+				step = candidate;
+				blockingApproach = approach;
+				XMStoreFloat3(&hit.normal, direction);
+				hit.userData = userData;
+			};
+
+		XMVECTOR separation = {};
+		for (const auto& [sphere, userData] : spheres) evaluate(moved.GetAxisDistance(sphere, separation), separation, userData);
+		for (const auto& [box, userData] : boxes) evaluate(moved.GetAxisDistance(box, separation), separation, userData);
+		for (const auto& [obb, userData] : orientedBoxes) evaluate(moved.GetAxisDistance(obb, separation), separation, userData);
+		for (const auto& [other, userData] : capsules) evaluate(moved.GetAxisDistance(other, separation), separation, userData);
+		for (const Triangle& triangle : triangles)
+		{
+			const float distance = moved.GetAxisDistance(XMLoadFloat3(&triangle.vertices[0]), XMLoadFloat3(&triangle.vertices[1]), XMLoadFloat3(&triangle.vertices[2]), separation);
+			evaluate(distance, separation, triangle.userData);
+		}
+
+		if (step == 0.0f)
+		{
+			hit.fraction = fraction;
+			return true;
+		}
+
+		fraction += step;
+		if (fraction >= 1.0f)
+		{
+			hit = {};
+			return false;
+		}
+	}
+
+	// 반복 안에 닿지 않았어도 끝까지 가지 못했으면 지금 비율에서 멈춤 // 지나치는 것보다 덜 가는 편이 안전
+	hit.fraction = fraction;
+	return true;
+}
+
+void BoundingCapsule::RunMicrobenchmarks()
+{
+	const auto getTestsPerSecond = [](size_t testCount, double elapsed) { return static_cast<double>(testCount) / (elapsed * 0.001); };
+
+	constexpr size_t SHAPE_COUNT = 1000;
+	constexpr size_t PAIR_COUNT = 2000000;
+	constexpr float WORLD_HALF_SIZE = 15.0f;
+
+	cout << "[캡슐 좁은 단계 마이크로벤치마크] 캐릭터 크기 모양 " << SHAPE_COUNT << "개에서 무작위 쌍 " << PAIR_COUNT << "개 겹침 검사" << endl;
+
+	mt19937 engine(MICROBENCHMARK_SEED);
+	uniform_real_distribution<float> position(-WORLD_HALF_SIZE, WORLD_HALF_SIZE);
+	uniform_real_distribution<float> angle(-XM_PI, XM_PI);
+	uniform_real_distribution<float> tilt(-0.3f, 0.3f);
+	uniform_int_distribution<size_t> index(0, SHAPE_COUNT - 1);
+
+	// 같은 몸을 감싸는 방향 상자와 캡슐 // 반지름 0.4, 키 1.8
+	constexpr float RADIUS = 0.4f;
+	constexpr float HALF_HEIGHT = 0.9f;
+	vector<BoundingOrientedBox> obbs(SHAPE_COUNT);
+	vector<BoundingCapsule> capsules(SHAPE_COUNT);
+	for (size_t i = 0; i < SHAPE_COUNT; ++i)
+	{
+		const XMVECTOR rotation = XMQuaternionRotationRollPitchYaw(tilt(engine), angle(engine), tilt(engine));
+		const XMFLOAT3 center = { position(engine), 0.0f, position(engine) };
+
+		XMFLOAT4 orientation = {};
+		XMStoreFloat4(&orientation, rotation);
+		obbs[i] = BoundingOrientedBox(center, { RADIUS, HALF_HEIGHT, RADIUS }, orientation);
+
+		const XMVECTOR axis = XMVector3Rotate(XMVectorSet(0.0f, HALF_HEIGHT - RADIUS, 0.0f, 0.0f), rotation);
+		XMStoreFloat3(&capsules[i].pointA, XMVectorSubtract(XMLoadFloat3(&center), axis));
+		XMStoreFloat3(&capsules[i].pointB, XMVectorAdd(XMLoadFloat3(&center), axis));
+		capsules[i].radius = RADIUS;
+	}
+
+	// 가까운 쌍이 적당히 섞이도록 절반은 이웃 인덱스
+	vector<pair<size_t, size_t>> pairs(PAIR_COUNT);
+	for (size_t i = 0; i < PAIR_COUNT; ++i)
+	{
+		const size_t first = index(engine);
+		pairs[i] = { first, i % 2 == 0 ? index(engine) : (first + 1) % SHAPE_COUNT };
+	}
+
+	size_t obbHitCount = 0;
+	const double obbElapsed = MeasureMilliseconds([&]() { for (const auto& [first, second] : pairs) if (obbs[first].Intersects(obbs[second])) obbHitCount++; });
+
+	size_t capsuleHitCount = 0;
+	const double capsuleElapsed = MeasureMilliseconds([&]() { for (const auto& [first, second] : pairs) if (capsules[first].Intersects(capsules[second])) capsuleHitCount++; });
+
+	const double obbTestsPerSecond = getTestsPerSecond(PAIR_COUNT, obbElapsed);
+	const double capsuleTestsPerSecond = getTestsPerSecond(PAIR_COUNT, capsuleElapsed);
+	cout << "방향 상자-방향 상자: " << obbTestsPerSecond / 1000000.0 << " M검사/초, 겹침 " << obbHitCount << "개" << endl;
+	cout << "캡슐-캡슐: " << capsuleTestsPerSecond / 1000000.0 << " M검사/초, 겹침 " << capsuleHitCount << "개 (" << capsuleTestsPerSecond / obbTestsPerSecond << "배)" << endl;
+}
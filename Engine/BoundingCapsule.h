@@ -0,0 +1,73 @@
+#pragma once
+
+// 캡슐 경계 모양 // 두 끝점을 잇는 선분에서 반지름 안에 있는 점 전체
+// DirectXMath 경계 모양과 같은 형태로 변환, 광선, 다른 모양과의 겹침 검사 제공
+// 캐릭터 크기 오브젝트용 // 선분 사이 거리 하나로 검사하므로 방향 상자 분리축 검사보다 싸고 몸에 더 맞음
+struct BoundingCapsule
+{
+	DirectX::XMFLOAT3 pointA = { 0.0f, -0.5f, 0.0f };
+	DirectX::XMFLOAT3 pointB = { 0.0f, 0.5f, 0.0f };
+	float radius = 0.5f;
+
+	// 끝점은 행렬로 옮기고 반지름은 가장 큰 축 배율로 늘림 // BoundingSphere::Transform과 같음
+	void Transform(_Out_ BoundingCapsule& out, DirectX::FXMMATRIX matrix) const;
+	// 감싸는 축 정렬 상자
+	DirectX::BoundingBox GetBounds() const;
+
+	bool Intersects(const DirectX::BoundingSphere& sphere) const;
+	bool Intersects(const DirectX::BoundingBox& box) const;
+	bool Intersects(const DirectX::BoundingOrientedBox& obb) const;
+	// 여섯 평면 중 하나라도 두 끝점이 모두 반지름보다 바깥에 있으면 겹치지 않음 // 절두체 모서리 바깥 근처는 겹친다고 볼 수 있음
+	bool Intersects(const DirectX::BoundingFrustum& frustum) const;
+	bool Intersects(const BoundingCapsule& capsule) const;
+	// 광선 검사 // 방향은 정규화되어 있어야 함 // 시작점이 캡슐 안이면 거리 0
+	bool Intersects(DirectX::FXMVECTOR origin, DirectX::FXMVECTOR direction, _Out_ float& distance) const;
+
+	// 축 선분과 모양 사이 최단 거리 // 이 캡슐의 반지름은 빼지 않음, 구와 캡슐은 상대 반지름을 뺌 // 겹치면 음수일 수 있음
+	// direction에 모양에서 축으로 향하는 단위 방향 기록 // 축이 모양에 닿거나 지나면 0
+	float GetAxisDistance(const DirectX::BoundingSphere& sphere, _Out_ DirectX::XMVECTOR& direction) const;
+	float GetAxisDistance(const DirectX::BoundingBox& box, _Out_ DirectX::XMVECTOR& direction) const;
+	float GetAxisDistance(const DirectX::BoundingOrientedBox& obb, _Out_ DirectX::XMVECTOR& direction) const;
+	float GetAxisDistance(const BoundingCapsule& capsule, _Out_ DirectX::XMVECTOR& direction) const;
+	// 삼각형 // 양면
+	float GetAxisDistance(DirectX::FXMVECTOR v0, DirectX::FXMVECTOR v1, DirectX::FXMVECTOR v2, _Out_ DirectX::XMVECTOR& direction) const;
+
+	// 같은 무작위 배치에서 방향 상자끼리, 캡슐끼리 겹침 검사 처리량 비교 결과를 콘솔에 출력
+	static void RunMicrobenchmarks();
+};
+
+// 캡슐 이동 검사 대상 // 월드 좌표계 볼록 모양 묶음 // 모양마다 사용자 데이터 포인터 하나
+// 브로드페이즈로 이동 범위 안 모양만 모아 채운 뒤 여러 번 검사 // Clear는 용량을 유지하므로 같은 객체를 다시 채워 씀
+struct CapsuleSweepTargets
+{
+	static constexpr float CONTACT_DISTANCE = 0.001f; // 표면 사이가 이보다 가까우면 닿은 것으로 봄
+	static constexpr size_t MAX_ADVANCE_ITERATIONS = 16; // 곡면에 비스듬히 다가갈 때 전진 반복 상한
+
+	// 이동 검사 결과
+	struct Hit
+	{
+		float fraction = 1.0f; // 이동량 중 닿기 전까지 움직일 수 있는 비율
+		DirectX::XMFLOAT3 normal = {}; // 닿은 모양에서 캡슐로 향하는 단위 방향
+		const void* userData = nullptr; // 닿은 모양의 사용자 데이터
+	};
+
+	struct Triangle
+	{
+		std::array<DirectX::XMFLOAT3, 3> vertices = {};
+		const void* userData = nullptr;
+	};
+
+	std::vector<std::pair<DirectX::BoundingSphere, const void*>> spheres = {};
+	std::vector<std::pair<DirectX::BoundingBox, const void*>> boxes = {};
+	std::vector<std::pair<DirectX::BoundingOrientedBox, const void*>> orientedBoxes = {};
+	std::vector<std::pair<BoundingCapsule, const void*>> capsules = {};
+	std::vector<Triangle> triangles = {};
+
+	void Clear();
+	bool IsEmpty() const { return spheres.empty() && boxes.empty() && orientedBoxes.empty() && capsules.empty() && triangles.empty(); }
+
+	// capsule을 displacement만큼 평행 이동할 때 처음 닿는 모양 // 닿으면 hit 기록 후 true
+	// 보수적 전진 // 모양과의 거리를 그 모양에 다가가는 속도로 나눈 만큼씩 나아가므로 얇은 모양도 지나치지 않음
+	// 멀어지는 모양과 축이 이미 안에 들어가 방향을 알 수 없는 모양은 막지 않음 // 겹친 채 시작해도 빠져나올 수 있음
+	bool Sweep(const BoundingCapsule& capsule, DirectX::FXMVECTOR displacement, _Out_ Hit& hit) const;
+};
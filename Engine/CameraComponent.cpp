@@ -3,6 +3,7 @@
 
 #include "GameObjectBase.h"
 #include "Renderer.h"
+#include "RenderBackend.h"
 
 #ifdef _DEBUG
 #include "ResourceManager.h"
@@ -14,6 +15,7 @@ using namespace std;
 using namespace DirectX;
 
 CameraComponent* CameraComponent::s_mainCamera = nullptr;
+optional<pair<XMVECTOR, XMVECTOR>> CameraComponent::s_viewOverride = nullopt;
 
 XMFLOAT2 CameraComponent::WorldToScreenPosition(const XMVECTOR& worldPosition) const
 {
@@ -82,6 +84,18 @@ void CameraComponent::Initialize()
 
 void CameraComponent::UpdateViewMatrix()
 {
+	if (this == s_mainCamera && s_viewOverride)
+	{
+		const auto& [position, target] = *s_viewOverride;
+		constexpr XMVECTOR UP = { 0.0f, 1.0f, 0.0f, 0.0f };
+
+		m_position = &s_viewOverride->first;
+		m_forwardVector = XMVector3Normalize(XMVectorSubtract(target, position));
+		m_viewMatrix = XMMatrixLookAtLH(position, target, UP);
+		return;
+	}
+
+	m_position = &m_owner->GetWorldMatrix().r[3];
 	m_forwardVector = m_owner->GetWorldDirectionVector(Direction::Forward);
 	m_viewMatrix = XMMatrixLookAtLH
 	(
@@ -96,7 +110,9 @@ void CameraComponent::UpdateProjectionMatrix()
 	m_projectionMatrix = XMMatrixPerspectiveFovLH(m_fovY, Renderer::GetInstance().GetAspectRatio(), m_nearZ, m_farZ);
 
 	m_boundingFrustum = BoundingFrustum(m_projectionMatrix);
-	m_boundingFrustum.Transform(m_transformedBoundingFrustum, m_owner->GetWorldMatrix());
+	// 강제 시점이면 뷰 행렬의 역행렬이 카메라 월드 행렬
+	const XMMATRIX cameraWorldMatrix = this == s_mainCamera && s_viewOverride ? XMMatrixInverse(nullptr, m_viewMatrix) : m_owner->GetWorldMatrix();
+	m_boundingFrustum.Transform(m_transformedBoundingFrustum, cameraWorldMatrix);
 }
 
 void CameraComponent::Render()
@@ -115,6 +131,7 @@ void CameraComponent::Render()
 
 			ResourceManager& resourceManager = ResourceManager::GetInstance();
 			com_ptr<ID3D11DeviceContext> deviceContext = renderer.GetDeviceContext();
+			RenderBackend& renderBackend = RenderBackend::GetInstance();
 
 			deviceContext->IASetInputLayout(m_boundingFrustumVertexShaderAndInputLayout.second.Get());
 			deviceContext->VSSetShader(m_boundingFrustumVertexShaderAndInputLayout.first.Get(), nullptr, 0);
@@ -134,8 +151,8 @@ void CameraComponent::Render()
 				lineBufferData.linePoints[1] = XMFLOAT4{ boxVertices[endIndex].x, boxVertices[endIndex].y, boxVertices[endIndex].z, 1.0f };
 				lineBufferData.lineColors[0] = XMFLOAT4{ 1.0f, 1.0f, 1.0f, 1.0f };
 				lineBufferData.lineColors[1] = XMFLOAT4{ 1.0f, 1.0f, 1.0f, 1.0f };
-				deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-				deviceContext->Draw(2, 0);
+				renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+				renderBackend.Draw(deviceContext.Get(), 2, 0);
 			}
 		}
 	);
@@ -170,7 +187,14 @@ nlohmann::json CameraComponent::Serialize()
 
 void CameraComponent::Deserialize(const nlohmann::json& jsonData)
 {
-	if (jsonData.contains("fovY")) m_fovY = jsonData["fovY"].get<float>();
-	if (jsonData.contains("nearZ")) m_nearZ = jsonData["nearZ"].get<float>();
-	if (jsonData.contains("farZ")) m_farZ = jsonData["farZ"].get<float>();
+	for (const auto& [key, value] : jsonData.items()) DeserializeField(key, value);
+}
+
+bool CameraComponent::DeserializeField(const string& key, const nlohmann::json& value)
+{
+	if (key == "fovY") m_fovY = value.get<float>();
+	else if (key == "nearZ") m_nearZ = value.get<float>();
+	else if (key == "farZ") m_farZ = value.get<float>();
+
+	return true;
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 class CameraComponent : public ComponentBase
 {
 	static CameraComponent* s_mainCamera;
+	static std::optional<std::pair<DirectX::XMVECTOR, DirectX::XMVECTOR>> s_viewOverride; // 메인 카메라 위치, 바라보는 지점 강제 // 벤치마크 카메라 경로용
 
 	float m_fovY = DirectX::XM_PIDIV4; // 수직 시야각 (라디안 단위)
 
@@ -41,6 +42,10 @@ public:
 	static const CameraComponent& GetMainCamera() { return *s_mainCamera; }
 	void SetAsMainCamera() { s_mainCamera = this; }
 
+	// 메인 카메라가 소유 게임 오브젝트 대신 지정한 위치에서 지점을 바라보도록 강제 // 다음 업데이트부터 적용
+	static void SetViewOverride(const DirectX::XMVECTOR& position, const DirectX::XMVECTOR& target) { s_viewOverride = { position, target }; }
+	static void ClearViewOverride() { s_viewOverride.reset(); }
+
 	const DirectX::XMMATRIX& GetViewMatrix() const { return m_viewMatrix; }
 	const DirectX::XMMATRIX& GetProjectionMatrix() const { return m_projectionMatrix; }
 	const DirectX::BoundingFrustum& GetBoundingFrustum() const { return m_transformedBoundingFrustum; }
@@ -61,6 +66,13 @@ public:
 	bool NeedsRender() const override { return false; }
 	#endif
 
+	// 업데이트에서 뷰, 투영 행렬 갱신 // 렌더링은 메인 카메라 절두체 읽기
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override
+	{
+		if (phase == FramePhase::Render) return { .read = FrameAccess::Camera };
+		return { .write = FrameAccess::Camera };
+	}
+
 private:
 	void Initialize() override;
 
@@ -75,6 +87,7 @@ private:
 
 	nlohmann::json Serialize() override;
 	void Deserialize(const nlohmann::json& jsonData) override;
+	bool DeserializeField(const std::string& key, const nlohmann::json& value) override;
 
 	// 뷰 행렬 갱신
 	void UpdateViewMatrix();
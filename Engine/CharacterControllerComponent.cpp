@@ -0,0 +1,485 @@
+#include "stdafx.h"
+#include "CharacterControllerComponent.h"
+
+#include "GameObjectBase.h"
+#include "JobSystem.h"
+#include "Microbenchmark.h"
+
+#include "Telemetry.h"
+
+using namespace std;
+using namespace DirectX;
+
+REGISTER_TYPE(CharacterControllerComponent)
+REGISTER_MICROBENCHMARK(CharacterControllerComponent, CharacterControllerComponent::RunMicrobenchmarks)
+
+vector<CharacterControllerComponent*> CharacterControllerComponent::s_controllers = {};
+
+namespace
+{
+	using Settings = CharacterControllerComponent::Settings;
+
+	// position 기준 세운 캡슐
+	BoundingCapsule GetCapsule(const Settings& settings, const XMVECTOR& position)
+	{
+		const float bottom = XMVectorGetY(position) + settings.footOffset;
+
+		BoundingCapsule capsule = { .radius = settings.radius };
+		XMStoreFloat3(&capsule.pointA, XMVectorSetY(position, bottom + settings.radius));
+		XMStoreFloat3(&capsule.pointB, XMVectorSetY(position, bottom + max(settings.height - settings.radius, settings.radius)));
+
+		return capsule;
+	}
+
+	// 한 번 쓸어 이동 // 닿으면 닿기 전 지점에서 skinWidth만큼 물러난 곳까지 // 닿았으면 hit 기록 후 true
+	bool SweepMove(const Settings& settings, const CapsuleSweepTargets& targets, _Inout_ XMVECTOR& position, const XMVECTOR& displacement, _Out_ CapsuleSweepTargets::Hit& hit)
+	{
+		if (!targets.Sweep(GetCapsule(settings, position), displacement, hit))
+		{
+			position = XMVectorAdd(position, displacement);
+			return false;
+		}
+
+		const float length = XMVectorGetX(XMVector3Length(displacement));
+		const float travel = max(0.0f, hit.fraction * length - settings.skinWidth);
+		position = XMVectorMultiplyAdd(displacement, XMVectorReplicate(travel / length), position);
+
+		return true;
+	}
+
+	// 닿은 면을 따라 남은 이동량을 꺾으며 이동 // 가파른 면은 수평으로 눕혀 벽처럼 다루고 isBlocked를 true로
+	XMVECTOR SlideMove(const Settings& settings, const CapsuleSweepTargets& targets, XMVECTOR position, const XMVECTOR& displacement, float minWalkableNormalY, _Out_ bool& isBlocked)
+	{
+		isBlocked = false;
+
+		XMVECTOR remaining = displacement;
+		XMVECTOR previousNormal = XMVectorZero();
+		for (uint32_t iteration = 0; iteration < settings.maxSlideIterations; ++iteration)
+		{
+			CapsuleSweepTargets::Hit hit = {};
+			if (!SweepMove(settings, targets, position, remaining, hit)) break;
+
+			XMVECTOR normal = XMLoadFloat3(&hit.normal);
+			if (hit.normal.y < minWalkableNormalY)
+			{
+				isBlocked = true;
+				// 벽을 타고 오르거나 파고들지 않음 // 천장처럼 거의 수직인 법선은 그대로
+				const XMVECTOR flatNormal = XMVectorSetY(normal, 0.0f);
+				if (XMVectorGetX(XMVector3LengthSq(flatNormal)) > 0.01f) normal = XMVector3Normalize(flatNormal);
+			}
+
+			remaining = XMVectorScale(remaining, 1.0f - hit.fraction);
+			remaining = XMVectorSubtract(remaining, XMVectorScale(normal, XMVectorGetX(XMVector3Dot(remaining, normal))));
+			// 앞서 닿은 면으로 다시 밀려 들어가면 두 면이 만나는 모서리 방향으로만 이동
+			if (XMVectorGetX(XMVector3Dot(remaining, previousNormal)) < 0.0f)
+			{
+				const XMVECTOR crease = XMVector3Normalize(XMVector3Cross(previousNormal, normal));
+				remaining = XMVectorScale(crease, XMVectorGetX(XMVector3Dot(remaining, crease)));
+			}
+			// 처음 방향을 거슬러 되돌아가지 않음
+			if (XMVectorGetX(XMVector3Dot(remaining, displacement)) <= 0.0f) break;
+
+			previousNormal = normal;
+		}
+
+		return position;
+	}
+
+	// 이동 해결 // gather(bounds, targets)로 이번 이동이 닿을 수 있는 범위의 모양을 한 번만 모은 뒤 수평 미끄러짐, 턱 오르기, 수직 이동, 바닥 붙이기 순으로 처리
+	template<typename Gather>
+	XMVECTOR SolveMove(const Settings& settings, _Inout_ CapsuleSweepTargets& targets, const XMVECTOR& position, const XMVECTOR& displacement, Gather&& gather, _Out_ bool& isGrounded)
+	{
+		const XMVECTOR horizontal = XMVectorSetY(displacement, 0.0f);
+		const float vertical = XMVectorGetY(displacement);
+		const float horizontalLength = XMVectorGetX(XMVector3Length(horizontal));
+		const float minWalkableNormalY = cos(XMConvertToRadians(settings.maxSlopeAngle));
+
+		// 미끄러짐은 처음 이동량보다 길어지지 않으므로 수평으로 그만큼, 위로 턱 높이, 아래로 붙이는 거리만큼 넓힌 범위
+		const BoundingBox capsuleBounds = GetCapsule(settings, position).GetBounds();
+		const XMVECTOR margin = XMVectorReplicate(settings.skinWidth + horizontalLength);
+		const XMVECTOR minimum = XMVectorSubtract(XMVectorSubtract(XMLoadFloat3(&capsuleBounds.Center), XMLoadFloat3(&capsuleBounds.Extents)), XMVectorSetY(margin, settings.skinWidth + settings.groundSnapDistance + max(0.0f, -vertical)));
+		const XMVECTOR maximum = XMVectorAdd(XMVectorAdd(XMLoadFloat3(&capsuleBounds.Center), XMLoadFloat3(&capsuleBounds.Extents)), XMVectorSetY(margin, settings.skinWidth + max(settings.stepHeight, vertical)));
+		BoundingBox moveBounds = {};
+		BoundingBox::CreateFromPoints(moveBounds, minimum, maximum);
+
+		targets.Clear();
+		gather(moveBounds, targets);
+
+		isGrounded = false;
+		if (targets.IsEmpty()) return XMVectorAdd(position, displacement);
+
+		bool isBlocked = false;
+		XMVECTOR result = SlideMove(settings, targets, position, horizontal, minWalkableNormalY, isBlocked);
+
+		// 가파른 면에 막혔으면 턱 오르기 시도 // 올라가서 미끄러진 뒤 다시 내려와 가파른 면에 서지 않고 더 멀리 갔을 때만 채택
+		if (isBlocked && settings.stepHeight > 0.0f && horizontalLength > numeric_limits<float>::epsilon())
+		{
+			CapsuleSweepTargets::Hit hit = {};
+			XMVECTOR stepped = position;
+			SweepMove(settings, targets, stepped, XMVectorSet(0.0f, settings.stepHeight, 0.0f, 0.0f), hit);
+			const float climbed = XMVectorGetY(stepped) - XMVectorGetY(position);
+
+			bool isStepBlocked = false;
+			stepped = SlideMove(settings, targets, stepped, horizontal, minWalkableNormalY, isStepBlocked);
+			const bool isLanded = SweepMove(settings, targets, stepped, XMVectorSet(0.0f, -climbed, 0.0f, 0.0f), hit);
+
+			const XMVECTOR direction = XMVectorScale(horizontal, 1.0f / horizontalLength);
+			const float stepProgress = XMVectorGetX(XMVector3Dot(XMVectorSubtract(stepped, position), direction));
+			const float slideProgress = XMVectorGetX(XMVector3Dot(XMVectorSubtract(result, position), direction));
+			if ((!isLanded || hit.normal.y >= minWalkableNormalY) && stepProgress > slideProgress + settings.skinWidth)
+			{
+				result = stepped;
+				TELEMETRY_COUNT("CharacterController.StepUps", 1);
+			}
+		}
+
+		if (vertical != 0.0f)
+		{
+			CapsuleSweepTargets::Hit hit = {};
+			if (SweepMove(settings, targets, result, XMVectorSet(0.0f, vertical, 0.0f, 0.0f), hit) && vertical < 0.0f) isGrounded = hit.normal.y >= minWalkableNormalY;
+		}
+
+		// 바닥 붙이기 // 위로 움직이지 않았으면 아래로 쓸어 걸을 수 있는 바닥이 있을 때만 내려앉음
+		if (vertical <= 0.0f && !isGrounded)
+		{
+			CapsuleSweepTargets::Hit hit = {};
+			XMVECTOR snapped = result;
+			if (SweepMove(settings, targets, snapped, XMVectorSet(0.0f, -(settings.groundSnapDistance + settings.skinWidth), 0.0f, 0.0f), hit) && hit.normal.y >= minWalkableNormalY)
+			{
+				result = snapped;
+				isGrounded = true;
+			}
+		}
+
+		return result;
+	}
+}
+
+XMVECTOR CharacterControllerComponent::Move(const XMVECTOR& displacement)
+{
+	TELEMETRY_COUNT("CharacterController.Moves", 1);
+
+	const XMVECTOR position = m_owner->GetPosition();
+	const XMVECTOR resolved = Resolve(position, displacement);
+	m_owner->SetPosition(resolved);
+
+	return XMVectorSubtract(resolved, position);
+}
+
+void CharacterControllerComponent::ResolveQueuedMoves()
+{
+	PROFILE_FUNCTION();
+
+	FrameVector<CharacterControllerComponent*> movingControllers = {};
+	for (CharacterControllerComponent* controller : s_controllers) if (!XMVector3Equal(controller->m_pendingDisplacement, XMVectorZero())) movingControllers.push_back(controller);
+	if (movingControllers.empty()) return;
+	TELEMETRY_COUNT("CharacterController.QueuedMoves", movingControllers.size());
+
+	// 서로의 위치는 읽지 않으므로 순서와 관계없이 같은 결과
+	FrameVector<XMVECTOR> resolvedPositions(movingControllers.size());
+	JobSystem::GetInstance().ParallelFor
+	(
+		movingControllers.size(), 0,
+		[&](size_t i)
+		{
+			CharacterControllerComponent* controller = movingControllers[i];
+			resolvedPositions[i] = controller->Resolve(controller->m_owner->GetPosition(), controller->m_pendingDisplacement);
+		}
+	);
+
+	for (size_t i = 0; i < movingControllers.size(); ++i)
+	{
+		movingControllers[i]->m_owner->SetPosition(resolvedPositions[i]);
+		movingControllers[i]->m_pendingDisplacement = XMVectorZero();
+		if (movingControllers[i]->m_onMoveResolved) movingControllers[i]->m_onMoveResolved();
+	}
+}
+
+#ifdef _DEBUG
+void CharacterControllerComponent::RenderImGui()
+{
+	ImGui::Text("Grounded: %s", m_isGrounded ? "true" : "false");
+
+	ImGui::DragFloat("Radius", &m_settings.radius, 0.01f, 0.01f, 10.0f);
+	ImGui::DragFloat("Height", &m_settings.height, 0.01f, 0.01f, 20.0f);
+	ImGui::DragFloat("Foot Offset", &m_settings.footOffset, 0.01f);
+	ImGui::DragFloat("Step Height", &m_settings.stepHeight, 0.01f, 0.0f, 2.0f);
+	ImGui::DragFloat("Max Slope Angle", &m_settings.maxSlopeAngle, 0.5f, 0.0f, 89.0f);
+	ImGui::DragFloat("Skin Width", &m_settings.skinWidth, 0.001f, 0.0f, 0.2f);
+	ImGui::DragFloat("Ground Snap Distance", &m_settings.groundSnapDistance, 0.01f, 0.0f, 2.0f);
+	int maxSlideIterations = static_cast<int>(m_settings.maxSlideIterations);
+	if (ImGui::SliderInt("Max Slide Iterations", &maxSlideIterations, 1, 8)) m_settings.maxSlideIterations = static_cast<uint32_t>(maxSlideIterations);
+
+	if (ImGui::TreeNode("Collision Mask"))
+	{
+		for (size_t i = 0; i < COLLISION_LAYER_NAMES.size(); ++i) ImGui::CheckboxFlags(COLLISION_LAYER_NAMES[i], &m_settings.collisionMask, ToLayerMask(static_cast<CollisionLayer>(i)));
+
+		ImGui::TreePop();
+	}
+}
+#endif
+
+nlohmann::json CharacterControllerComponent::Serialize()
+{
+	nlohmann::json jsonData;
+
+	jsonData["radius"] = m_settings.radius;
+	jsonData["height"] = m_settings.height;
+	jsonData["footOffset"] = m_settings.footOffset;
+	jsonData["stepHeight"] = m_settings.stepHeight;
+	jsonData["maxSlopeAngle"] = m_settings.maxSlopeAngle;
+	jsonData["skinWidth"] = m_settings.skinWidth;
+	jsonData["groundSnapDistance"] = m_settings.groundSnapDistance;
+	jsonData["maxSlideIterations"] = m_settings.maxSlideIterations;
+	jsonData["collisionMask"] = m_settings.collisionMask;
+
+	return jsonData;
+}
+
+void CharacterControllerComponent::Deserialize(const nlohmann::json& jsonData)
+{
+	for (const auto& [key, value] : jsonData.items()) DeserializeField(key, value);
+}
+
+bool CharacterControllerComponent::DeserializeField(const string& key, const nlohmann::json& value)
+{
+	if (key == "radius") m_settings.radius = value.get<float>();
+	else if (key == "height") m_settings.height = value.get<float>();
+	else if (key == "footOffset") m_settings.footOffset = value.get<float>();
+	else if (key == "stepHeight") m_settings.stepHeight = value.get<float>();
+	else if (key == "maxSlopeAngle") m_settings.maxSlopeAngle = value.get<float>();
+	else if (key == "skinWidth") m_settings.skinWidth = value.get<float>();
+	else if (key == "groundSnapDistance") m_settings.groundSnapDistance = value.get<float>();
+	else if (key == "maxSlideIterations") m_settings.maxSlideIterations = value.get<uint32_t>();
+	else if (key == "collisionMask") m_settings.collisionMask = value.get<uint32_t>();
+
+	return true;
+}
+
+XMVECTOR CharacterControllerComponent::Resolve(const XMVECTOR& position, const XMVECTOR& displacement)
+{
+	return SolveMove
+	(
+		m_settings, m_sweepTargets, position, displacement,
+		[&](const BoundingBox& bounds, CapsuleSweepTargets& targets) { ColliderComponent::GatherSweepTargets(bounds, targets, m_settings.collisionMask, m_owner); },
+		m_isGrounded
+	);
+}
+
+void CharacterControllerComponent::AddToControllers()
+{
+	if (m_controllerIndex != INVALID_INDEX) return;
+
+	m_controllerIndex = s_controllers.size();
+	s_controllers.push_back(this);
+}
+
+void CharacterControllerComponent::RemoveFromControllers()
+{
+	if (m_controllerIndex == INVALID_INDEX) return;
+
+	s_controllers[m_controllerIndex] = s_controllers.back();
+	s_controllers[m_controllerIndex]->m_controllerIndex = m_controllerIndex;
+	s_controllers.pop_back();
+
+	m_controllerIndex = INVALID_INDEX;
+	m_pendingDisplacement = XMVectorZero();
+}
+
+void CharacterControllerComponent::RunMicrobenchmarks()
+{
+	constexpr size_t AGENT_COUNT = 500;
+	constexpr size_t FRAME_COUNT = 120;
+	constexpr float DELTA_TIME = 1.0f / 60.0f;
+	constexpr float WALK_SPEED = 4.0f; // 적 이동 속도
+	constexpr float WORLD_HALF_SIZE = 25.0f;
+
+	const Settings settings = {};
+	mt19937 engine(MICROBENCHMARK_SEED);
+	uniform_real_distribution<float> position(-WORLD_HALF_SIZE, WORLD_HALF_SIZE);
+	uniform_real_distribution<float> angle(-XM_PI, XM_PI);
+
+	// 바닥 하나에 얇은 벽, 오를 수 있는 낮은 턱, 기둥을 흩어 놓은 구역 // 브로드페이즈는 콜라이더와 같은 트리를 따로 만들어 사용
+	vector<BoundingBox> boxes = { BoundingBox({ 0.0f, -0.5f, 0.0f }, { WORLD_HALF_SIZE + 5.0f, 0.5f, WORLD_HALF_SIZE + 5.0f }) };
+	vector<BoundingOrientedBox> walls = {};
+	vector<BoundingCapsule> pillars = {};
+	uniform_real_distribution<float> wallLength(1.0f, 3.0f);
+	uniform_real_distribution<float> thinThickness(0.05f, 0.15f);
+	uniform_real_distribution<float> ledgeHeight(0.1f, 0.25f);
+	for (size_t i = 0; i < 150; ++i)
+	{
+		XMFLOAT4 orientation = {};
+		XMStoreFloat4(&orientation, XMQuaternionRotationRollPitchYaw(0.0f, angle(engine), 0.0f));
+		walls.emplace_back(XMFLOAT3(position(engine), 1.5f, position(engine)), XMFLOAT3(wallLength(engine), 1.5f, thinThickness(engine)), orientation);
+	}
+	for (size_t i = 0; i < 60; ++i)
+	{
+		const float height = ledgeHeight(engine);
+		boxes.emplace_back(XMFLOAT3(position(engine), height * 0.5f, position(engine)), XMFLOAT3(1.0f, height * 0.5f, 1.0f));
+	}
+	for (size_t i = 0; i < 60; ++i)
+	{
+		const XMFLOAT3 center = { position(engine), 0.0f, position(engine) };
+		pillars.push_back({ .pointA = center, .pointB = { center.x, 3.0f, center.z }, .radius = 0.5f });
+	}
+
+	DynamicAABBTree tree = {};
+	for (size_t i = 0; i < boxes.size(); ++i) tree.CreateProxy(boxes[i], reinterpret_cast<void*>(i));
+	for (size_t i = 0; i < walls.size(); ++i)
+	{
+		array<XMFLOAT3, 8> corners = {};
+		walls[i].GetCorners(corners.data());
+		BoundingBox bounds = {};
+		BoundingBox::CreateFromPoints(bounds, corners.size(), corners.data(), sizeof(XMFLOAT3));
+		tree.CreateProxy(bounds, reinterpret_cast<void*>(boxes.size() + i));
+	}
+	for (size_t i = 0; i < pillars.size(); ++i) tree.CreateProxy(pillars[i].GetBounds(), reinterpret_cast<void*>(boxes.size() + walls.size() + i));
+
+	const auto gather = [&](const BoundingBox& bounds, CapsuleSweepTargets& targets)
+		{
+			tree.Query
+			(
+				bounds,
+				[&](int32_t proxyId)
+				{
+					size_t index = reinterpret_cast<size_t>(tree.GetUserData(proxyId));
+					if (index < boxes.size()) targets.boxes.emplace_back(boxes[index], nullptr);
+					else if ((index -= boxes.size()) < walls.size()) targets.orientedBoxes.emplace_back(walls[index], nullptr);
+					else targets.capsules.emplace_back(pillars[index - walls.size()], nullptr);
+					return true;
+				}
+			);
+		};
+
+	cout << "[캐릭터 컨트롤러 마이크로벤치마크] 에이전트 " << AGENT_COUNT << "개, 벽 " << walls.size() << "개, 턱 " << boxes.size() - 1 << "개, 기둥 " << pillars.size() << "개, " << FRAME_COUNT << "프레임" << endl;
+
+	// 벽이나 기둥에 파고든 위치인지 여부
+	const auto isPenetrating = [&](const XMVECTOR& agentPosition)
+		{
+			CapsuleSweepTargets targets = {};
+			BoundingCapsule capsule = GetCapsule(settings, agentPosition);
+			capsule.radius -= settings.skinWidth;
+			gather(capsule.GetBounds(), targets);
+
+			return any_of(targets.orientedBoxes.begin(), targets.orientedBoxes.end(), [&](const auto& wall) { return capsule.Intersects(wall.first); }) ||
+				any_of(targets.capsules.begin(), targets.capsules.end(), [&](const auto& pillar) { return capsule.Intersects(pillar.first); });
+		};
+
+	// 에이전트마다 무작위 목표 지점으로 걷고 도착하면 새 목표 // 시작 위치는 벽과 기둥 바깥에서 고름
+	struct Agent
+	{
+		XMVECTOR position = {};
+		XMVECTOR target = {};
+		bool isGrounded = false;
+		CapsuleSweepTargets targets = {};
+	};
+	vector<Agent> initialAgents(AGENT_COUNT);
+	for (Agent& agent : initialAgents)
+	{
+		do agent.position = XMVectorSet(position(engine), 0.0f, position(engine), 0.0f);
+		while (isPenetrating(agent.position));
+		agent.target = XMVectorSet(position(engine), 0.0f, position(engine), 0.0f);
+	}
+	vector<XMVECTOR> retargets(FRAME_COUNT * AGENT_COUNT);
+	for (XMVECTOR& target : retargets) target = XMVectorSet(position(engine), 0.0f, position(engine), 0.0f);
+
+	const auto simulate = [&](vector<Agent>& agents, bool isParallel)
+		{
+			const auto moveAgent = [&](size_t frame, size_t i)
+				{
+					Agent& agent = agents[i];
+					XMVECTOR toTarget = XMVectorSetY(XMVectorSubtract(agent.target, agent.position), 0.0f);
+					if (XMVectorGetX(XMVector3LengthSq(toTarget)) < 1.0f)
+					{
+						agent.target = retargets[frame * AGENT_COUNT + i];
+						toTarget = XMVectorSetY(XMVectorSubtract(agent.target, agent.position), 0.0f);
+					}
+					const XMVECTOR displacement = XMVectorScale(XMVector3Normalize(toTarget), WALK_SPEED * DELTA_TIME);
+					agent.position = SolveMove(settings, agent.targets, agent.position, displacement, gather, agent.isGrounded);
+				};
+
+			for (size_t frame = 0; frame < FRAME_COUNT; ++frame)
+			{
+				if (isParallel) JobSystem::GetInstance().ParallelFor(AGENT_COUNT, 0, [&](size_t i) { moveAgent(frame, i); });
+				else for (size_t i = 0; i < AGENT_COUNT; ++i) moveAgent(frame, i);
+			}
+		};
+
+	vector<Agent> serialAgents = initialAgents;
+	const double serialElapsed = MeasureMilliseconds([&]() { simulate(serialAgents, false); });
+	vector<Agent> parallelAgents = initialAgents;
+	const double parallelElapsed = MeasureMilliseconds([&]() { simulate(parallelAgents, true); });
+
+	// 끝난 뒤 벽이나 기둥에 파고든 에이전트 // 걷는 속도에서도 스윕이 막아야 함
+	const size_t penetratingCount = count_if(serialAgents.begin(), serialAgents.end(), [&](const Agent& agent) { return isPenetrating(agent.position); });
+	size_t gatheredShapeCount = 0;
+	for (const Agent& agent : serialAgents) gatheredShapeCount += agent.targets.boxes.size() + agent.targets.orientedBoxes.size() + agent.targets.capsules.size();
+
+	const double moveCount = static_cast<double>(AGENT_COUNT * FRAME_COUNT);
+	cout << "직렬: 에이전트당 " << serialElapsed * 1000.0 / moveCount << "us, 프레임당 " << serialElapsed / FRAME_COUNT << "ms" << endl;
+	cout << "병렬: 에이전트당 " << parallelElapsed * 1000.0 / moveCount << "us, 프레임당 " << parallelElapsed / FRAME_COUNT << "ms (" << serialElapsed / parallelElapsed << "배)" << endl;
+	cout << "끝난 뒤 벽, 기둥에 파고든 에이전트 " << penetratingCount << "개, 에이전트 주변 모양 평균 " << static_cast<double>(gatheredShapeCount) / AGENT_COUNT << "개" << endl;
+
+	// 대시 관통 // 플레이어 대시와 같은 속도와 시간으로 얇은 벽을 향해 돌진
+	// 이동만 하는 방식, 옮긴 뒤 겹치면 되돌리는 방식, 스윕 방식에서 벽 반대편으로 빠져나간 횟수
+	constexpr float DASH_SPEED = 30.0f;
+	constexpr float DASH_DURATION = 0.15f;
+	constexpr size_t DASH_TRIAL_COUNT = 1000;
+	constexpr array<float, 3> FRAME_RATES = { 144.0f, 60.0f, 20.0f };
+
+	uniform_real_distribution<float> wallThickness(0.02f, 0.2f);
+	uniform_real_distribution<float> startDistance(0.1f, 2.5f);
+	uniform_real_distribution<float> incidence(-XM_PI / 3.0f, XM_PI / 3.0f);
+	for (float frameRate : FRAME_RATES)
+	{
+		const float deltaTime = 1.0f / frameRate;
+		const size_t dashFrameCount = static_cast<size_t>(ceil(DASH_DURATION * frameRate));
+
+		size_t rawTunnelCount = 0;
+		size_t discreteTunnelCount = 0;
+		size_t sweptTunnelCount = 0;
+		for (size_t trial = 0; trial < DASH_TRIAL_COUNT; ++trial)
+		{
+			// 원점을 지나고 normal을 향하는 사실상 무한한 얇은 벽
+			const float yaw = angle(engine);
+			const float thickness = wallThickness(engine);
+			XMFLOAT4 orientation = {};
+			XMStoreFloat4(&orientation, XMQuaternionRotationRollPitchYaw(0.0f, yaw, 0.0f));
+			const BoundingOrientedBox wall({ 0.0f, 1.5f, 0.0f }, { 100.0f, 1.5f, thickness * 0.5f }, orientation);
+			const XMVECTOR normal = XMVector3Rotate(XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f), XMLoadFloat4(&orientation));
+			const XMVECTOR tangent = XMVector3Rotate(XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f), XMLoadFloat4(&orientation));
+
+			const XMVECTOR start = XMVectorScale(normal, -(thickness * 0.5f + settings.radius + startDistance(engine)));
+			const float dashAngle = incidence(engine);
+			const XMVECTOR step = XMVectorScale(XMVectorAdd(XMVectorScale(normal, cos(dashAngle)), XMVectorScale(tangent, sin(dashAngle))), DASH_SPEED * deltaTime);
+			const auto isTunnelled = [&](const XMVECTOR& end) { return XMVectorGetX(XMVector3Dot(end, normal)) > 0.0f; };
+
+			const auto dashGather = [&](const BoundingBox&, CapsuleSweepTargets& targets)
+				{
+					targets.boxes.emplace_back(boxes[0], nullptr);
+					targets.orientedBoxes.emplace_back(wall, nullptr);
+				};
+
+			XMVECTOR raw = start;
+			XMVECTOR discrete = start;
+			XMVECTOR swept = start;
+			CapsuleSweepTargets targets = {};
+			bool isGrounded = false;
+			for (size_t frame = 0; frame < dashFrameCount; ++frame)
+			{
+				raw = XMVectorAdd(raw, step);
+
+				const XMVECTOR next = XMVectorAdd(discrete, step);
+				if (!GetCapsule(settings, next).Intersects(wall)) discrete = next;
+
+				swept = SolveMove(settings, targets, swept, step, dashGather, isGrounded);
+			}
+
+			if (isTunnelled(raw)) rawTunnelCount++;
+			if (isTunnelled(discrete)) discreteTunnelCount++;
+			if (isTunnelled(swept)) sweptTunnelCount++;
+		}
+
+		cout << "대시 " << frameRate << "fps (프레임당 " << DASH_SPEED * deltaTime << "m) 벽 관통: 이동만 " << rawTunnelCount << ", 겹치면 되돌리기 " << discreteTunnelCount << ", 스윕 " << sweptTunnelCount << " / " << DASH_TRIAL_COUNT << "회" << endl;
+	}
+}
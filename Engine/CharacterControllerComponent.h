@@ -0,0 +1,93 @@
+#pragma once
+#include "ComponentBase.h"
+#include "ColliderComponent.h"
+
+// 키네마틱 캐릭터 컨트롤러 // 세운 캡슐을 콜라이더 세계로 쓸어 보내 면을 따라 미끄러지고, 낮은 턱은 오르고, 바닥에 붙음
+// 소유 게임 오브젝트 위치 기준으로 캡슐을 세움 // 부모가 없는 루트 오브젝트용 (로컬 위치를 월드 위치로 봄)
+// Move는 바로 이동 // QueueMove는 이동량만 모아 두고 업데이트 단계가 끝난 뒤 ResolveQueuedMoves가 모든 컨트롤러를 작업 시스템으로 한 번에 처리
+class CharacterControllerComponent : public ComponentBase
+{
+public:
+	// 캡슐 모양 및 이동 해결 설정
+	struct Settings
+	{
+		float radius = 0.4f;
+		float height = 1.8f; // 캡슐 전체 높이 // 반지름 두 배보다 낮으면 구
+		float footOffset = 0.0f; // 소유 오브젝트 위치에서 캡슐 바닥까지 높이 차이 // 눈높이에 위치를 둔 플레이어는 음수
+		float stepHeight = 0.3f; // 가파른 면에 막혔을 때 올라서 넘을 수 있는 턱 높이
+		float maxSlopeAngle = 45.0f; // 걸을 수 있는 경사 (도 단위) // 더 가파르면 벽으로 다룸
+		float skinWidth = 0.02f; // 닿은 면에서 띄워 두는 거리 // 다음 이동이 같은 면에 바로 걸리지 않음
+		float groundSnapDistance = 0.3f; // 위로 움직이지 않을 때 이 거리 안의 걸을 수 있는 바닥으로 붙임
+		uint32_t maxSlideIterations = 4; // 이동 한 번에 면을 따라 꺾는 최대 횟수
+		uint32_t collisionMask = ToLayerMask(CollisionLayer::Default) | ToLayerMask(CollisionLayer::Level); // 막히는 콜라이더 레이어 비트
+	};
+
+private:
+	static constexpr size_t INVALID_INDEX = std::numeric_limits<size_t>::max();
+	static std::vector<CharacterControllerComponent*> s_controllers; // 활성 컨트롤러 배열 // 예약 이동 일괄 처리용
+	size_t m_controllerIndex = INVALID_INDEX; // s_controllers 내 인덱스 // 등록되지 않았으면 INVALID_INDEX
+
+	Settings m_settings = {};
+	DirectX::XMVECTOR m_pendingDisplacement = DirectX::XMVectorZero(); // 예약된 이동량 // 일괄 처리 후 0
+	bool m_isGrounded = false; // 마지막 이동 후 걸을 수 있는 바닥에 서 있는지 여부
+	CapsuleSweepTargets m_sweepTargets = {}; // 이동 범위 안 콜라이더 모양 // 이동마다 다시 채우고 용량은 재사용
+	std::function<void()> m_onMoveResolved = nullptr; // 예약 이동 위치 반영 직후 호출 // 메인 스레드에서 컨트롤러마다 순서대로
+
+public:
+	CharacterControllerComponent() = default;
+	~CharacterControllerComponent() override = default;
+	CharacterControllerComponent(const CharacterControllerComponent&) = default;
+	CharacterControllerComponent& operator=(const CharacterControllerComponent&) = default;
+	CharacterControllerComponent(CharacterControllerComponent&&) = default;
+	CharacterControllerComponent& operator=(CharacterControllerComponent&&) = default;
+
+	void SetSettings(const Settings& settings) { m_settings = settings; }
+	const Settings& GetSettings() const { return m_settings; }
+	bool IsGrounded() const { return m_isGrounded; }
+
+	// 바로 이동 // 실제로 움직인 양 반환
+	DirectX::XMVECTOR Move(const DirectX::XMVECTOR& displacement);
+	// 이동량 예약 // 여러 번 부르면 더함 // 자기 이동량만 바꾸므로 병렬 업데이트 중에 불러도 됨
+	void QueueMove(const DirectX::XMVECTOR& displacement) { m_pendingDisplacement = DirectX::XMVectorAdd(m_pendingDisplacement, displacement); }
+	// 예약 이동이 해결되어 소유 오브젝트 위치가 바뀐 직후 호출할 함수 // 해결된 위치로 공유 자료 구조를 갱신할 때 사용
+	void SetOnMoveResolved(const std::function<void()>& onMoveResolved) { m_onMoveResolved = onMoveResolved; }
+
+	// 예약된 이동 일괄 처리 // 업데이트 단계가 끝난 뒤 씬이 한 번 호출
+	// 콜라이더는 읽기만 하므로 이동 해결은 작업 시스템으로 병렬 실행하고, 위치 반영은 모두 끝난 뒤 순서대로
+	static void ResolveQueuedMoves();
+
+	bool NeedsFixedUpdate() const override { return false; }
+	bool NeedsUpdate() const override { return false; }
+	bool NeedsRender() const override { return false; }
+
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override { return {}; }
+
+	// 에이전트 500개 이동 해결 비용과 대시 속도에서 얇은 벽 관통 횟수를 콘솔에 출력
+	static void RunMicrobenchmarks();
+
+protected:
+	void Initialize() override { AddToControllers(); }
+	#ifdef _DEBUG
+	void RenderImGui() override;
+	#endif
+	void Finalize() override { RemoveFromControllers(); }
+
+	void Reactivate() override { AddToControllers(); }
+
+	// 비활성화 동안 일괄 처리 대상에서 제외 // 예약된 이동량은 버림
+	void OnEnable() override { AddToControllers(); }
+	void OnDisable() override { RemoveFromControllers(); }
+
+	nlohmann::json Serialize() override;
+	void Deserialize(const nlohmann::json& jsonData) override;
+	bool DeserializeField(const std::string& key, const nlohmann::json& value) override;
+
+private:
+	// position에서 displacement만큼 이동을 해결한 위치 반환 // 위치는 바꾸지 않음
+	DirectX::XMVECTOR Resolve(const DirectX::XMVECTOR& position, const DirectX::XMVECTOR& displacement);
+
+	// 일괄 처리 목록에 등록 // 이미 등록되어 있으면 무시
+	void AddToControllers();
+	// 일괄 처리 목록에서 해제 // 마지막 원소를 빈 자리로 옮김
+	void RemoveFromControllers();
+};
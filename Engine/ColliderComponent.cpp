@@ -3,10 +3,14 @@
 
 #include "GameObjectBase.h"
 #include "ModelComponent.h"
+#include "ResourceManager.h"
+#include "JobSystem.h"
+
+#include "Telemetry.h"
 
 #ifdef _DEBUG
 #include "Renderer.h"
-#include "ResourceManager.h"
+#include "RenderBackend.h"
 #endif
 
 using namespace std;
@@ -14,189 +18,455 @@ using namespace DirectX;
 
 REGISTER_TYPE(ColliderComponent)
 
-vector<ColliderComponent*> ColliderComponent::s_colliders = {};
+DynamicAABBTree ColliderComponent::s_broadPhase = {};
+// 기본은 모든 레이어끼리 충돌 // 레벨 지오메트리끼리는 쌍을 만들지 않음
+array<uint32_t, static_cast<size_t>(CollisionLayer::Count)> ColliderComponent::s_layerCollisionMatrix = []()
+	{
+		array<uint32_t, static_cast<size_t>(CollisionLayer::Count)> matrix = {};
+		matrix.fill(ALL_COLLISION_LAYERS);
+		matrix[static_cast<size_t>(CollisionLayer::Level)] &= ~ToLayerMask(CollisionLayer::Level);
+		return matrix;
+	}();
+vector<pair<int32_t, int32_t>> ColliderComponent::s_contacts = {};
 
-GameObjectBase* ColliderComponent::CheckCollision(const XMVECTOR& origin, const XMVECTOR& direction, _Out_ float& distance)
+template<typename Shape>
+bool ColliderComponent::IntersectsAnyShape(const Shape& shape) const
 {
-	GameObjectBase* collidedObject = nullptr;
-	float closestDistance = numeric_limits<float>::max();
-	XMVECTOR dirNormalized = XMVector3Normalize(direction);
+	for (const auto& [box, transformedBox] : m_boundingBoxes) if (shape.Intersects(transformedBox)) return true;
+	for (const auto& [obb, transformedOBB] : m_boundingOrientedBoxes) if (shape.Intersects(transformedOBB)) return true;
+	for (const auto& [frustum, transformedFrustum] : m_boundingFrustums) if (shape.Intersects(transformedFrustum)) return true;
+	for (const auto& [sphere, transformedSphere] : m_boundingSpheres) if (shape.Intersects(transformedSphere)) return true;
+	// DirectXMath 모양에는 캡슐 검사가 없으므로 캡슐 쪽에서 검사
+	for (const auto& [capsule, transformedCapsule] : m_boundingCapsules) if (transformedCapsule.Intersects(shape)) return true;
+	if (m_meshBVH && shape.Intersects(m_worldMeshBounds)) return true;
 
-	for (ColliderComponent* collider : s_colliders)
-	{
-		for (const auto& [box, transformedBox] : collider->m_boundingBoxes)
-		{
-			float dist = 0.0f;
-			if (transformedBox.Intersects(origin, dirNormalized, dist))
-			{
-				if (dist < closestDistance)
-				{
-					closestDistance = dist;
-					collidedObject = collider->m_owner;
-				}
-			}
-		}
-		for (const auto& [obb, transformedOBB] : collider->m_boundingOrientedBoxes)
-		{
-			float dist = 0.0f;
-			if (transformedOBB.Intersects(origin, dirNormalized, dist))
-			{
-				if (dist < closestDistance)
-				{
-					closestDistance = dist;
-					collidedObject = collider->m_owner;
-				}
-			}
-		}
-		for (const auto& [frustum, transformedFrustum] : collider->m_boundingFrustums)
-		{
-			float dist = 0.0f;
-			if (transformedFrustum.Intersects(origin, dirNormalized, dist))
-			{
-				if (dist < closestDistance)
-				{
-					closestDistance = dist;
-					collidedObject = collider->m_owner;
-				}
-			}
-		}
-	}
+	return false;
+}
 
-	distance = closestDistance;
-	return collidedObject;
+bool ColliderComponent::IntersectsCollider(const ColliderComponent& other) const
+{
+	for (const auto& [box, transformedBox] : m_boundingBoxes) if (other.IntersectsAnyShape(transformedBox)) return true;
+	for (const auto& [obb, transformedOBB] : m_boundingOrientedBoxes) if (other.IntersectsAnyShape(transformedOBB)) return true;
+	for (const auto& [frustum, transformedFrustum] : m_boundingFrustums) if (other.IntersectsAnyShape(transformedFrustum)) return true;
+	for (const auto& [sphere, transformedSphere] : m_boundingSpheres) if (other.IntersectsAnyShape(transformedSphere)) return true;
+	for (const auto& [capsule, transformedCapsule] : m_boundingCapsules) if (other.IntersectsAnyShape(transformedCapsule)) return true;
+	if (m_meshBVH && other.IntersectsAnyShape(m_worldMeshBounds)) return true;
+
+	return false;
 }
 
-vector<GameObjectBase*> ColliderComponent::CheckCollision(const BoundingBox& box)
+bool ColliderComponent::IntersectRay(const XMVECTOR& origin, const XMVECTOR& direction, const XMVECTOR& inverseDirection, _Inout_ float& closestDistance) const
 {
-	vector<GameObjectBase*> collidedObjects = {};
+	bool isCloser = false;
 
-	for (ColliderComponent* collider : s_colliders)
+	// 상자, 방향 상자는 4개씩 한 번에 검사
+	for (const AABBPacket& packet : m_worldBoxPackets)
 	{
-		bool isCollided = false;
-		for (const auto& [otherBox, transformedBox] : collider->m_boundingBoxes)
+		const float distance = GetMinimumLane(packet.Intersect(origin, inverseDirection, closestDistance));
+		if (distance < closestDistance)
 		{
-			if (box.Intersects(transformedBox))
-			{
-				isCollided = true;
-				break;
-			}
+			closestDistance = distance;
+			isCloser = true;
 		}
-		if (isCollided)
+	}
+	for (const OBBPacket& packet : m_worldOBBPackets)
+	{
+		const float distance = GetMinimumLane(packet.Intersect(origin, direction, closestDistance));
+		if (distance < closestDistance)
 		{
-			collidedObjects.push_back(collider->m_owner);
-			continue;
+			closestDistance = distance;
+			isCloser = true;
 		}
-
-		for (const auto& [obb, transformedOBB] : collider->m_boundingOrientedBoxes)
+	}
+	for (const auto& [frustum, transformedFrustum] : m_boundingFrustums)
+	{
+		float distance = 0.0f;
+		if (transformedFrustum.Intersects(origin, direction, distance) && distance < closestDistance)
 		{
-			if (box.Intersects(transformedOBB))
-			{
-				isCollided = true;
-				break;
-			}
+			closestDistance = distance;
+			isCloser = true;
 		}
-		if (isCollided)
+	}
+	for (const auto& [sphere, transformedSphere] : m_boundingSpheres)
+	{
+		float distance = 0.0f;
+		if (transformedSphere.Intersects(origin, direction, distance) && distance < closestDistance)
 		{
-			collidedObjects.push_back(collider->m_owner);
-			continue;
+			closestDistance = distance;
+			isCloser = true;
 		}
-
-		for (const auto& [frustum, transformedFrustum] : collider->m_boundingFrustums)
+	}
+	for (const auto& [capsule, transformedCapsule] : m_boundingCapsules)
+	{
+		float distance = 0.0f;
+		if (transformedCapsule.Intersects(origin, direction, distance) && distance < closestDistance)
 		{
-			if (box.Intersects(transformedFrustum))
-			{
-				isCollided = true;
-				break;
-			}
+			closestDistance = distance;
+			isCloser = true;
 		}
-		if (isCollided)
+	}
+
+	// 메쉬는 광선을 로컬로 옮겨 삼각형 검사 // 방향을 정규화하지 않으므로 거리는 월드 거리 그대로
+	if (m_meshBVH)
+	{
+		const XMVECTOR localOrigin = XMVector3TransformCoord(origin, m_inverseWorldMatrix);
+		const XMVECTOR localDirection = XMVector3TransformNormal(direction, m_inverseWorldMatrix);
+
+		TriangleBVH::Hit hit = {};
+		if (m_meshBVH->Raycast(localOrigin, localDirection, closestDistance, hit) && hit.distance < closestDistance)
 		{
-			collidedObjects.push_back(collider->m_owner);
-			continue;
+			closestDistance = hit.distance;
+			isCloser = true;
 		}
 	}
 
-	return collidedObjects;
+	return isCloser;
 }
 
-vector<GameObjectBase*> ColliderComponent::CheckCollision(const BoundingFrustum& frustum)
+bool ColliderComponent::SetMeshModel(const string& modelFileName)
 {
-	vector<GameObjectBase*> collidedObjects = {};
+	m_meshModelFileName = modelFileName;
+	m_meshBVH = modelFileName.empty() ? nullptr : ResourceManager::GetInstance().GetTriangleBVH(modelFileName);
+	m_worldShapesVersion = 0;
 
-	for (ColliderComponent* collider : s_colliders)
+	if (!modelFileName.empty() && !m_meshBVH)
 	{
-		bool isCollided = false;
-		for (const auto& [box, transformedBox] : collider->m_boundingBoxes)
+		cerr << "오류: 메쉬 콜라이더 모델 " << modelFileName << " 사용 불가" << endl;
+		m_meshModelFileName.clear();
+		return false;
+	}
+
+	return true;
+}
+
+void ColliderComponent::SetLayerCollision(CollisionLayer a, CollisionLayer b, bool isColliding)
+{
+	const auto setBit = [&](CollisionLayer layer, CollisionLayer other)
 		{
-			if (frustum.Intersects(transformedBox))
-			{
-				isCollided = true;
-				break;
-			}
-		}
-		if (isCollided)
+			uint32_t& mask = s_layerCollisionMatrix[static_cast<size_t>(layer)];
+			if (isColliding) mask |= ToLayerMask(other);
+			else mask &= ~ToLayerMask(other);
+		};
+	setBit(a, b);
+	setBit(b, a);
+
+	s_broadPhase.ForEachProxy([](int32_t proxyId) { static_cast<ColliderComponent*>(s_broadPhase.GetUserData(proxyId))->UpdateFilter(); });
+}
+
+GameObjectBase* ColliderComponent::CheckCollision(const XMVECTOR& origin, const XMVECTOR& direction, _Out_ float& distance, uint32_t layerMask)
+{
+	TELEMETRY_COUNT("Collider.RayQueries", 1);
+
+	GameObjectBase* collidedObject = nullptr;
+	float closestDistance = numeric_limits<float>::max();
+	XMVECTOR dirNormalized = XMVector3Normalize(direction);
+	const XMVECTOR inverseDirection = GetSafeReciprocal(dirNormalized);
+
+	size_t colliderTestCount = 0;
+	// 넓힌 상자를 지나는 콜라이더만 모양별 검사 // 더 가까운 충돌을 찾을 때마다 먼 노드는 건너뜀
+	s_broadPhase.Raycast
+	(
+		origin, dirNormalized, closestDistance,
+		[&](int32_t proxyId, float maxDistance)
 		{
-			collidedObjects.push_back(collider->m_owner);
-			continue;
-		}
+			colliderTestCount++;
+
+			const ColliderComponent* collider = static_cast<const ColliderComponent*>(s_broadPhase.GetUserData(proxyId));
+			if (collider->IntersectRay(origin, dirNormalized, inverseDirection, closestDistance)) collidedObject = collider->m_owner;
+
+			return min(maxDistance, closestDistance);
+		},
+		layerMask
+	);
+	TELEMETRY_COUNT("Collider.ColliderTests", colliderTestCount);
+
+	distance = closestDistance;
+	return collidedObject;
+}
+
+void ColliderComponent::RaycastBatch(span<const Ray> rays, span<RaycastHit> hits, uint32_t layerMask)
+{
+	TELEMETRY_COUNT("Collider.RayQueries", rays.size());
 
-		for (const auto& [obb, transformedOBB] : collider->m_boundingOrientedBoxes)
+	size_t colliderTestCount = 0;
+	for (size_t first = 0; first < rays.size(); first += RAY_PACKET_WIDTH)
+	{
+		const size_t count = min(RAY_PACKET_WIDTH, rays.size() - first);
+
+		array<Ray, RAY_PACKET_WIDTH> packetRays = {};
+		array<XMVECTOR, RAY_PACKET_WIDTH> inverseDirections = {};
+		for (size_t lane = 0; lane < count; ++lane)
 		{
-			if (frustum.Intersects(transformedOBB))
-			{
-				isCollided = true;
-				break;
-			}
+			const Ray& ray = rays[first + lane];
+			packetRays[lane] = { .origin = ray.origin, .direction = XMVector3Normalize(ray.direction), .maxDistance = ray.maxDistance };
+			inverseDirections[lane] = GetSafeReciprocal(packetRays[lane].direction);
+			hits[first + lane] = {};
 		}
-		if (isCollided)
+
+		RayPacket packet = RayPacket::Load(span<const Ray>(packetRays.data(), count));
+		s_broadPhase.RaycastPacket
+		(
+			packet,
+			[&](int32_t proxyId, uint32_t laneMask)
+			{
+				colliderTestCount++;
+
+				const ColliderComponent* collider = static_cast<const ColliderComponent*>(s_broadPhase.GetUserData(proxyId));
+				for (; laneMask != 0; laneMask &= laneMask - 1)
+				{
+					const size_t lane = static_cast<size_t>(countr_zero(laneMask));
+					const Ray& ray = packetRays[lane];
+					RaycastHit& hit = hits[first + lane];
+
+					float closestDistance = hit.object ? hit.distance : ray.maxDistance;
+					if (!collider->IntersectRay(ray.origin, ray.direction, inverseDirections[lane], closestDistance)) continue;
+
+					hit = { .object = collider->m_owner, .distance = closestDistance };
+					// 이 광선은 이제 더 먼 노드를 검사하지 않음
+					packet.maxDistance = XMVectorSetByIndex(packet.maxDistance, closestDistance, lane);
+				}
+			},
+			layerMask
+		);
+	}
+	TELEMETRY_COUNT("Collider.ColliderTests", colliderTestCount);
+}
+
+FrameVector<GameObjectBase*> ColliderComponent::CheckCollision(const BoundingBox& box, uint32_t layerMask)
+{
+	TELEMETRY_COUNT("Collider.BoxQueries", 1);
+
+	FrameVector<GameObjectBase*> collidedObjects = {};
+
+	size_t colliderTestCount = 0;
+	s_broadPhase.Query
+	(
+		box,
+		[&](int32_t proxyId)
 		{
-			collidedObjects.push_back(collider->m_owner);
-			continue;
-		}
+			colliderTestCount++;
+
+			const ColliderComponent* collider = static_cast<const ColliderComponent*>(s_broadPhase.GetUserData(proxyId));
+			if (collider->IntersectsAnyShape(box)) collidedObjects.push_back(collider->m_owner);
+
+			return true;
+		},
+		layerMask
+	);
+	TELEMETRY_COUNT("Collider.ColliderTests", colliderTestCount);
+
+	return collidedObjects;
+}
+
+FrameVector<GameObjectBase*> ColliderComponent::CheckCollision(const BoundingFrustum& frustum, uint32_t layerMask)
+{
+	TELEMETRY_COUNT("Collider.FrustumQueries", 1);
+
+	FrameVector<GameObjectBase*> collidedObjects = {};
 
-		for (const auto& [frustum, transformedFrustum] : collider->m_boundingFrustums)
+	size_t colliderTestCount = 0;
+	s_broadPhase.Query
+	(
+		frustum,
+		[&](int32_t proxyId)
 		{
-			if (frustum.Intersects(transformedFrustum))
+			colliderTestCount++;
+
+			const ColliderComponent* collider = static_cast<const ColliderComponent*>(s_broadPhase.GetUserData(proxyId));
+			if (collider->IntersectsAnyShape(frustum)) collidedObjects.push_back(collider->m_owner);
+
+			return true;
+		},
+		layerMask
+	);
+	TELEMETRY_COUNT("Collider.ColliderTests", colliderTestCount);
+
+	return collidedObjects;
+}
+
+FrameVector<GameObjectBase*> ColliderComponent::CheckCollision(const BoundingFrustum& frustum, _Inout_ VisibilityCache& cache, uint32_t layerMask)
+{
+	TELEMETRY_COUNT("Collider.FrustumQueries", 1);
+
+	FrameVector<GameObjectBase*> collidedObjects = {};
+
+	// 넓힌 상자는 모양이 그 안에서 움직이는 동안 그대로이므로 감싸는 구로 사용 // 버전은 평면에 걸친 콜라이더의 정밀 검사 결과를 다시 쓸지 판단
+	size_t colliderTestCount = 0;
+	cache.BeginQuery(frustum);
+	s_broadPhase.Query
+	(
+		frustum,
+		[&](int32_t proxyId)
+		{
+			const ColliderComponent* collider = static_cast<const ColliderComponent*>(s_broadPhase.GetUserData(proxyId));
+
+			const DynamicAABBTree::AABB& fatBounds = s_broadPhase.GetFatBounds(proxyId);
+			const XMVECTOR minimum = XMLoadFloat3(&fatBounds.minimum);
+			const XMVECTOR maximum = XMLoadFloat3(&fatBounds.maximum);
+			BoundingSphere bounds = {};
+			XMStoreFloat3(&bounds.Center, XMVectorScale(XMVectorAdd(minimum, maximum), 0.5f));
+			bounds.Radius = XMVectorGetX(XMVector3Length(XMVectorSubtract(maximum, minimum))) * 0.5f;
+
+			if (cache.IsVisible(collider, bounds, collider->m_worldShapesVersion, [&]() { colliderTestCount++; return collider->IntersectsAnyShape(frustum); })) collidedObjects.push_back(collider->m_owner);
+
+			return true;
+		},
+		layerMask
+	);
+	cache.EndQuery();
+	TELEMETRY_COUNT("Collider.ColliderTests", colliderTestCount);
+
+	return collidedObjects;
+}
+
+void ColliderComponent::GatherSweepTargets(const BoundingBox& bounds, _Inout_ CapsuleSweepTargets& targets, uint32_t layerMask, const GameObjectBase* ignoredOwner)
+{
+	TELEMETRY_COUNT("Collider.SweepQueries", 1);
+
+	size_t colliderTestCount = 0;
+	s_broadPhase.Query
+	(
+		bounds,
+		[&](int32_t proxyId)
+		{
+			const ColliderComponent* collider = static_cast<const ColliderComponent*>(s_broadPhase.GetUserData(proxyId));
+			if (collider->m_owner == ignoredOwner) return true;
+			colliderTestCount++;
+
+			const GameObjectBase* owner = collider->m_owner;
+			for (const auto& [box, transformedBox] : collider->m_boundingBoxes) targets.boxes.emplace_back(transformedBox, owner);
+			for (const auto& [obb, transformedOBB] : collider->m_boundingOrientedBoxes) targets.orientedBoxes.emplace_back(transformedOBB, owner);
+			for (const auto& [sphere, transformedSphere] : collider->m_boundingSpheres) targets.spheres.emplace_back(transformedSphere, owner);
+			for (const auto& [capsule, transformedCapsule] : collider->m_boundingCapsules) targets.capsules.emplace_back(transformedCapsule, owner);
+
+			// 메쉬는 범위를 로컬로 옮겨 그 안 삼각형만 월드로 꺼냄
+			if (collider->m_meshBVH)
 			{
-				isCollided = true;
-				break;
+				BoundingBox localBounds = {};
+				bounds.Transform(localBounds, collider->m_inverseWorldMatrix);
+
+				const XMMATRIX& worldMatrix = owner->GetWorldMatrix();
+				collider->m_meshBVH->QueryTriangles
+				(
+					localBounds,
+					[&](const XMVECTOR& v0, const XMVECTOR& v1, const XMVECTOR& v2)
+					{
+						CapsuleSweepTargets::Triangle& triangle = targets.triangles.emplace_back();
+						XMStoreFloat3(&triangle.vertices[0], XMVector3TransformCoord(v0, worldMatrix));
+						XMStoreFloat3(&triangle.vertices[1], XMVector3TransformCoord(v1, worldMatrix));
+						XMStoreFloat3(&triangle.vertices[2], XMVector3TransformCoord(v2, worldMatrix));
+						triangle.userData = owner;
+					}
+				);
 			}
-		}
-		if (isCollided)
+
+			return true;
+		},
+		layerMask
+	);
+	TELEMETRY_COUNT("Collider.ColliderTests", colliderTestCount);
+}
+
+bool ColliderComponent::CheckCollisionWithObject(ColliderComponent* otherCollider)
+{
+	TELEMETRY_COUNT("Collider.PairTests", 1);
+
+	return IntersectsCollider(*otherCollider);
+}
+
+void ColliderComponent::RefreshMovedWorldShapes()
+{
+	PROFILE_FUNCTION();
+
+	// 소유 게임 오브젝트가 움직였거나 모양이 바뀐 콜라이더만 모음 // 정적 콜라이더는 첫 계산 뒤 건너뜀
+	FrameVector<ColliderComponent*> movedColliders = {};
+	s_broadPhase.ForEachProxy
+	(
+		[&](int32_t proxyId)
 		{
-			collidedObjects.push_back(collider->m_owner);
-			continue;
+			ColliderComponent* collider = static_cast<ColliderComponent*>(s_broadPhase.GetUserData(proxyId));
+			if (collider->m_owner->NeedsBoundsUpdate(collider->m_worldShapesVersion)) movedColliders.push_back(collider);
 		}
-	}
+	);
+	TELEMETRY_COUNT("Collider.BoundsTransforms", movedColliders.size());
+	TELEMETRY_COUNT("Collider.BoundsTransformsSkipped", s_broadPhase.GetProxyCount() - movedColliders.size());
+	if (movedColliders.empty()) return;
 
-	return collidedObjects;
+	// 모양 변환은 각자 자기 모양만 쓰므로 순서와 관계없이 같은 결과
+	FrameVector<BoundingBox> worldBounds(movedColliders.size());
+	JobSystem::GetInstance().ParallelFor(movedColliders.size(), 0, [&](size_t i) { worldBounds[i] = movedColliders[i]->UpdateWorldShapes(); });
+
+	size_t reinsertCount = 0;
+	for (size_t i = 0; i < movedColliders.size(); ++i) if (s_broadPhase.MoveProxy(movedColliders[i]->m_proxyId, worldBounds[i])) ++reinsertCount;
+	TELEMETRY_COUNT("Collider.BroadPhaseReinserts", reinsertCount);
 }
 
-bool ColliderComponent::CheckCollisionWithObject(ColliderComponent* otherCollider)
+void ColliderComponent::UpdateContacts()
 {
-	for (const auto& [box, transformedBox] : m_boundingBoxes)
-	{
-		for (const auto& [otherBox, otherTransformedBox] : otherCollider->m_boundingBoxes)
+	PROFILE_FUNCTION();
+
+	// 이번 단계에 겹치는 쌍 // 레이어가 서로 허용하고 넓힌 상자가 겹치는 쌍만 모양 검사
+	FrameVector<pair<int32_t, int32_t>> contacts = {};
+	size_t pairTestCount = 0;
+	s_broadPhase.QueryPairs
+	(
+		[&](int32_t proxyIdA, int32_t proxyIdB)
 		{
-			if (transformedBox.Intersects(otherTransformedBox)) return true;
+			const ColliderComponent* colliderA = static_cast<const ColliderComponent*>(s_broadPhase.GetUserData(proxyIdA));
+			const ColliderComponent* colliderB = static_cast<const ColliderComponent*>(s_broadPhase.GetUserData(proxyIdB));
+			// 정적 오브젝트끼리는 겹침이 바뀌지 않으므로 검사하지 않음
+			if (colliderA->m_owner->IsStatic() && colliderB->m_owner->IsStatic()) return;
+
+			pairTestCount++;
+			if (colliderA->IntersectsCollider(*colliderB)) contacts.emplace_back(proxyIdA, proxyIdB);
 		}
-	}
-	for (const auto& [obb, transformedOBB] : m_boundingOrientedBoxes)
+	);
+	sort(contacts.begin(), contacts.end());
+	TELEMETRY_COUNT("Collider.PairTests", pairTestCount);
+	TELEMETRY_COUNT("Collider.Contacts", contacts.size());
+
+	// 이전 단계와 비교 // 둘 다 정렬되어 있으므로 한 번씩만 훑음
+	// 처리 함수에서 콜라이더가 해제되고 아이디가 재사용될 수 있으므로 전달 전에 콜라이더 포인터로 바꿔 둠
+	struct ContactEvent
 	{
-		for (const auto& [otherOBB, otherTransformedOBB] : otherCollider->m_boundingOrientedBoxes)
+		CollisionEvent event = CollisionEvent::Stay;
+		ColliderComponent* colliderA = nullptr;
+		ColliderComponent* colliderB = nullptr;
+	};
+	FrameVector<ContactEvent> events = {};
+	const auto addEvent = [&](CollisionEvent event, const pair<int32_t, int32_t>& contact)
 		{
-			if (transformedOBB.Intersects(otherTransformedOBB)) return true;
-		}
-	}
-	for (const auto& [frustum, transformedFrustum] : m_boundingFrustums)
+			events.push_back
+			({
+				.event = event,
+				.colliderA = static_cast<ColliderComponent*>(s_broadPhase.GetUserData(contact.first)),
+				.colliderB = static_cast<ColliderComponent*>(s_broadPhase.GetUserData(contact.second))
+			});
+		};
+
+	size_t previousIndex = 0;
+	size_t currentIndex = 0;
+	while (previousIndex < s_contacts.size() || currentIndex < contacts.size())
 	{
-		for (const auto& [otherFrustum, otherTransformedFrustum] : otherCollider->m_boundingFrustums)
+		if (currentIndex == contacts.size() || (previousIndex < s_contacts.size() && s_contacts[previousIndex] < contacts[currentIndex])) addEvent(CollisionEvent::Exit, s_contacts[previousIndex++]);
+		else if (previousIndex == s_contacts.size() || contacts[currentIndex] < s_contacts[previousIndex]) addEvent(CollisionEvent::Enter, contacts[currentIndex++]);
+		else
 		{
-			if (transformedFrustum.Intersects(otherTransformedFrustum)) return true;
+			addEvent(CollisionEvent::Stay, contacts[currentIndex++]);
+			previousIndex++;
 		}
 	}
+	s_contacts.assign(contacts.begin(), contacts.end());
 
-	return false;
+	// 양쪽 소유 게임 오브젝트에 전달 // 앞선 처리 함수에서 해제된 콜라이더가 속한 쌍은 건너뜀
+	for (const auto& [event, colliderA, colliderB] : events)
+	{
+		if (colliderA->m_proxyId == DynamicAABBTree::NULL_NODE || colliderB->m_proxyId == DynamicAABBTree::NULL_NODE) continue;
+
+		static_cast<IBase*>(colliderA->m_owner)->BaseCollision(event, colliderB);
+		if (colliderB->m_proxyId == DynamicAABBTree::NULL_NODE) continue;
+		static_cast<IBase*>(colliderB->m_owner)->BaseCollision(event, colliderA);
+	}
 }
 
 void ColliderComponent::Initialize()
@@ -207,23 +477,7 @@ void ColliderComponent::Initialize()
 	m_boundingShapePixelShader = resourceManager.GetPixelShader("PSColor.hlsl");
 	#endif
 
-	s_colliders.push_back(this);
-}
-
-void ColliderComponent::FixedUpdate()
-{
-	const XMMATRIX& worldMatrix = m_owner->GetWorldMatrix();
-	for (auto& [box, transformedBox] : m_boundingBoxes) box.Transform(transformedBox, worldMatrix);
-	for (auto& [obb, transformedOBB] : m_boundingOrientedBoxes) obb.Transform(transformedOBB, worldMatrix);
-	for (auto& [frustum, transformedFrustum] : m_boundingFrustums) frustum.Transform(transformedFrustum, worldMatrix);
-}
-
-void ColliderComponent::Update()
-{
-	const XMMATRIX& worldMatrix = m_owner->GetWorldMatrix();
-	for (auto& [box, transformedBox] : m_boundingBoxes) box.Transform(transformedBox, worldMatrix);
-	for (auto& [obb, transformedOBB] : m_boundingOrientedBoxes) obb.Transform(transformedOBB, worldMatrix);
-	for (auto& [frustum, transformedFrustum] : m_boundingFrustums) frustum.Transform(transformedFrustum, worldMatrix);
+	AddToColliders();
 }
 
 #ifdef _DEBUG
@@ -238,6 +492,7 @@ void ColliderComponent::Render()
 		{
 			ResourceManager& resourceManager = ResourceManager::GetInstance();
 			com_ptr<ID3D11DeviceContext> deviceContext = renderer.GetDeviceContext();
+			RenderBackend& renderBackend = RenderBackend::GetInstance();
 
 			deviceContext->IASetInputLayout(m_boundingShapeVertexShaderAndInputLayout.second.Get());
 			deviceContext->VSSetShader(m_boundingShapeVertexShaderAndInputLayout.first.Get(), nullptr, 0);
@@ -263,8 +518,8 @@ void ColliderComponent::Render()
 					lineBufferData.linePoints[1] = XMFLOAT4{ boxVertices[endIndex].x, boxVertices[endIndex].y, boxVertices[endIndex].z, 1.0f };
 					lineBufferData.lineColors[0] = XMFLOAT4{ 1.0f, 0.0f, 0.0f, 1.0f };
 					lineBufferData.lineColors[1] = XMFLOAT4{ 1.0f, 0.0f, 0.0f, 1.0f };
-					deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-					deviceContext->Draw(2, 0);
+					renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+					renderBackend.Draw(deviceContext.Get(), 2, 0);
 				}
 			}
 			for (const auto& [obb, transformedOBB] : m_boundingOrientedBoxes)
@@ -277,8 +532,8 @@ void ColliderComponent::Render()
 					lineBufferData.linePoints[1] = XMFLOAT4{ boxVertices[endIndex].x, boxVertices[endIndex].y, boxVertices[endIndex].z, 1.0f };
 					lineBufferData.lineColors[0] = XMFLOAT4{ 0.0f, 1.0f, 0.0f, 1.0f };
 					lineBufferData.lineColors[1] = XMFLOAT4{ 0.0f, 1.0f, 0.0f, 1.0f };
-					deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-					deviceContext->Draw(2, 0);
+					renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+					renderBackend.Draw(deviceContext.Get(), 2, 0);
 				}
 			}
 			for (const auto& [frustum, transformedFrustum] : m_boundingFrustums)
@@ -291,8 +546,79 @@ void ColliderComponent::Render()
 					lineBufferData.linePoints[1] = XMFLOAT4{ boxVertices[endIndex].x, boxVertices[endIndex].y, boxVertices[endIndex].z, 1.0f };
 					lineBufferData.lineColors[0] = XMFLOAT4{ 0.0f, 0.0f, 1.0f, 1.0f };
 					lineBufferData.lineColors[1] = XMFLOAT4{ 0.0f, 0.0f, 1.0f, 1.0f };
-					deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-					deviceContext->Draw(2, 0);
+					renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+					renderBackend.Draw(deviceContext.Get(), 2, 0);
+				}
+			}
+			// 구, 캡슐은 원 몇 개와 옆선으로 표시
+			constexpr size_t CIRCLE_SEGMENT_COUNT = 16;
+			const auto drawLine = [&](const XMVECTOR& start, const XMVECTOR& end, const XMFLOAT4& color)
+				{
+					XMStoreFloat4(&lineBufferData.linePoints[0], XMVectorSetW(start, 1.0f));
+					XMStoreFloat4(&lineBufferData.linePoints[1], XMVectorSetW(end, 1.0f));
+					lineBufferData.lineColors[0] = color;
+					lineBufferData.lineColors[1] = color;
+					renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+					renderBackend.Draw(deviceContext.Get(), 2, 0);
+				};
+			const auto drawCircle = [&](const XMVECTOR& center, const XMVECTOR& axisU, const XMVECTOR& axisV, float radius, const XMFLOAT4& color)
+				{
+					for (size_t i = 0; i < CIRCLE_SEGMENT_COUNT; ++i)
+					{
+						const float startAngle = XM_2PI * static_cast<float>(i) / static_cast<float>(CIRCLE_SEGMENT_COUNT);
+						const float endAngle = XM_2PI * static_cast<float>(i + 1) / static_cast<float>(CIRCLE_SEGMENT_COUNT);
+						drawLine
+						(
+							XMVectorAdd(center, XMVectorScale(XMVectorAdd(XMVectorScale(axisU, cos(startAngle)), XMVectorScale(axisV, sin(startAngle))), radius)),
+							XMVectorAdd(center, XMVectorScale(XMVectorAdd(XMVectorScale(axisU, cos(endAngle)), XMVectorScale(axisV, sin(endAngle))), radius)),
+							color
+						);
+					}
+				};
+
+			for (const auto& [sphere, transformedSphere] : m_boundingSpheres)
+			{
+				const XMVECTOR center = XMLoadFloat3(&transformedSphere.Center);
+				const XMFLOAT4 color = { 1.0f, 0.0f, 1.0f, 1.0f };
+				drawCircle(center, g_XMIdentityR0, g_XMIdentityR1, transformedSphere.Radius, color);
+				drawCircle(center, g_XMIdentityR1, g_XMIdentityR2, transformedSphere.Radius, color);
+				drawCircle(center, g_XMIdentityR2, g_XMIdentityR0, transformedSphere.Radius, color);
+			}
+			for (const auto& [capsule, transformedCapsule] : m_boundingCapsules)
+			{
+				const XMVECTOR pointA = XMLoadFloat3(&transformedCapsule.pointA);
+				const XMVECTOR pointB = XMLoadFloat3(&transformedCapsule.pointB);
+				const XMFLOAT4 color = { 0.0f, 1.0f, 1.0f, 1.0f };
+
+				// 축에 수직인 두 방향 // 끝점이 같으면 y축 기준
+				XMVECTOR axis = XMVectorSubtract(pointB, pointA);
+				axis = XMVectorGetX(XMVector3LengthSq(axis)) > 0.0f ? XMVector3Normalize(axis) : g_XMIdentityR1;
+				const XMVECTOR axisU = XMVector3Normalize(XMVector3Cross(axis, abs(XMVectorGetY(axis)) < 0.9f ? g_XMIdentityR1 : g_XMIdentityR0));
+				const XMVECTOR axisV = XMVector3Cross(axis, axisU);
+
+				drawCircle(pointA, axisU, axisV, transformedCapsule.radius, color);
+				drawCircle(pointB, axisU, axisV, transformedCapsule.radius, color);
+				drawCircle(pointA, axisU, axis, transformedCapsule.radius, color);
+				drawCircle(pointB, axisU, axis, transformedCapsule.radius, color);
+				for (const XMVECTOR& side : { axisU, axisV, XMVectorNegate(axisU), XMVectorNegate(axisV) })
+				{
+					const XMVECTOR offset = XMVectorScale(side, transformedCapsule.radius);
+					drawLine(XMVectorAdd(pointA, offset), XMVectorAdd(pointB, offset), color);
+				}
+			}
+
+			if (m_meshBVH)
+			{
+				m_worldMeshBounds.GetCorners(boxVertices.data());
+
+				for (const auto& [startIndex, endIndex] : BOX_LINE_INDICES)
+				{
+					lineBufferData.linePoints[0] = XMFLOAT4{ boxVertices[startIndex].x, boxVertices[startIndex].y, boxVertices[startIndex].z, 1.0f };
+					lineBufferData.linePoints[1] = XMFLOAT4{ boxVertices[endIndex].x, boxVertices[endIndex].y, boxVertices[endIndex].z, 1.0f };
+					lineBufferData.lineColors[0] = XMFLOAT4{ 1.0f, 1.0f, 0.0f, 1.0f };
+					lineBufferData.lineColors[1] = XMFLOAT4{ 1.0f, 1.0f, 0.0f, 1.0f };
+					renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+					renderBackend.Draw(deviceContext.Get(), 2, 0);
 				}
 			}
 		}
@@ -303,18 +629,32 @@ void ColliderComponent::Render()
 #ifdef _DEBUG
 void ColliderComponent::RenderImGui()
 {
+	int layer = static_cast<int>(m_layer);
+	if (ImGui::Combo("Layer", &layer, COLLISION_LAYER_NAMES.data(), static_cast<int>(COLLISION_LAYER_NAMES.size()))) SetLayer(static_cast<CollisionLayer>(layer));
+	if (ImGui::TreeNode("Collision Mask"))
+	{
+		uint32_t collisionMask = m_collisionMask;
+		for (size_t i = 0; i < COLLISION_LAYER_NAMES.size(); ++i) ImGui::CheckboxFlags(COLLISION_LAYER_NAMES[i], &collisionMask, ToLayerMask(static_cast<CollisionLayer>(i)));
+		if (collisionMask != m_collisionMask) SetCollisionMask(collisionMask);
+
+		ImGui::TreePop();
+	}
+
+	// 모양을 편집했으면 다음 업데이트에서 월드 경계 다시 계산
+	bool isEdited = false;
+
 	if ((ImGui::TreeNode("Bounding Boxes")))
 	{
 		for (auto& [box, transformedBox] : m_boundingBoxes)
 		{
 			ImGui::PushID(&box);
 
-			ImGui::DragFloat3("Center", &box.Center.x, 0.1f);
-			ImGui::DragFloat3("Extents", &box.Extents.x, 0.1f);
+			isEdited |= ImGui::DragFloat3("Center", &box.Center.x, 0.1f);
+			isEdited |= ImGui::DragFloat3("Extents", &box.Extents.x, 0.1f);
 
 			ImGui::PopID();
 		}
-		if (ImGui::Button("Add Bounding Box")) m_boundingBoxes.emplace_back();
+		if (ImGui::Button("Add Bounding Box")) AddBoundingBox({});
 
 		ImGui::TreePop();
 	}
@@ -324,8 +664,8 @@ void ColliderComponent::RenderImGui()
 		{
 			ImGui::PushID(&obb);
 
-			ImGui::DragFloat3("Center", &obb.Center.x, 0.1f);
-			ImGui::DragFloat3("Extents", &obb.Extents.x, 0.1f);
+			isEdited |= ImGui::DragFloat3("Center", &obb.Center.x, 0.1f);
+			isEdited |= ImGui::DragFloat3("Extents", &obb.Extents.x, 0.1f);
 
 			XMVECTOR eulerAngles = ToDegrees(static_cast<XMVECTOR>(static_cast<SimpleMath::Quaternion>(obb.Orientation).ToEuler()));
 			if (ImGui::DragFloat3("Rotation (Degrees)", eulerAngles.m128_f32, 0.1f))
@@ -333,11 +673,12 @@ void ColliderComponent::RenderImGui()
 				XMVECTOR radians = ToRadians(eulerAngles);
 				SimpleMath::Quaternion quaternion = SimpleMath::Quaternion::CreateFromYawPitchRoll(XMVectorGetY(radians), XMVectorGetX(radians), XMVectorGetZ(radians));
 				obb.Orientation = static_cast<XMFLOAT4>(quaternion);
+				isEdited = true;
 			}
 
 			ImGui::PopID();
 		}
-		if (ImGui::Button("Add Bounding Oriented Box")) m_boundingOrientedBoxes.emplace_back();
+		if (ImGui::Button("Add Bounding Oriented Box")) AddBoundingOrientedBox({});
 
 		ImGui::TreePop();
 	}
@@ -347,36 +688,91 @@ void ColliderComponent::RenderImGui()
 		{
 			ImGui::PushID(&frustum);
 
-			ImGui::DragFloat3("Origin", &frustum.Origin.x, 0.1f);
-			ImGui::DragFloat4("Orientation", &frustum.Orientation.x, 0.1f);
-			ImGui::DragFloat("RightSlope", &frustum.RightSlope, 0.1f);
-			ImGui::DragFloat("LeftSlope", &frustum.LeftSlope, 0.1f);
-			ImGui::DragFloat("TopSlope", &frustum.TopSlope, 0.1f);
-			ImGui::DragFloat("BottomSlope", &frustum.BottomSlope, 0.1f);
-			ImGui::DragFloat("Near", &frustum.Near, 0.1f);
-			ImGui::DragFloat("Far", &frustum.Far, 0.1f);
+			isEdited |= ImGui::DragFloat3("Origin", &frustum.Origin.x, 0.1f);
+			isEdited |= ImGui::DragFloat4("Orientation", &frustum.Orientation.x, 0.1f);
+			isEdited |= ImGui::DragFloat("RightSlope", &frustum.RightSlope, 0.1f);
+			isEdited |= ImGui::DragFloat("LeftSlope", &frustum.LeftSlope, 0.1f);
+			isEdited |= ImGui::DragFloat("TopSlope", &frustum.TopSlope, 0.1f);
+			isEdited |= ImGui::DragFloat("BottomSlope", &frustum.BottomSlope, 0.1f);
+			isEdited |= ImGui::DragFloat("Near", &frustum.Near, 0.1f);
+			isEdited |= ImGui::DragFloat("Far", &frustum.Far, 0.1f);
+
+			ImGui::PopID();
+		}
+		if (ImGui::Button("Add Bounding Frustum")) AddBoundingFrustum({});
+
+		ImGui::TreePop();
+	}
+	if ((ImGui::TreeNode("Bounding Spheres")))
+	{
+		for (auto& [sphere, transformedSphere] : m_boundingSpheres)
+		{
+			ImGui::PushID(&sphere);
+
+			isEdited |= ImGui::DragFloat3("Center", &sphere.Center.x, 0.1f);
+			isEdited |= ImGui::DragFloat("Radius", &sphere.Radius, 0.1f, 0.0f, FLT_MAX);
+
+			ImGui::PopID();
+		}
+		if (ImGui::Button("Add Bounding Sphere")) AddBoundingSphere({});
+
+		ImGui::TreePop();
+	}
+	if ((ImGui::TreeNode("Bounding Capsules")))
+	{
+		for (auto& [capsule, transformedCapsule] : m_boundingCapsules)
+		{
+			ImGui::PushID(&capsule);
+
+			isEdited |= ImGui::DragFloat3("Point A", &capsule.pointA.x, 0.1f);
+			isEdited |= ImGui::DragFloat3("Point B", &capsule.pointB.x, 0.1f);
+			isEdited |= ImGui::DragFloat("Radius", &capsule.radius, 0.1f, 0.0f, FLT_MAX);
 
 			ImGui::PopID();
 		}
-		if (ImGui::Button("Add Bounding Frustum")) m_boundingFrustums.emplace_back();
+		if (ImGui::Button("Add Bounding Capsule")) AddBoundingCapsule({});
+
+		ImGui::TreePop();
+	}
+
+	if (ImGui::TreeNode("Mesh Collider"))
+	{
+		array<char, 256> meshModelFileNameBuffer = {};
+		strcpy_s(meshModelFileNameBuffer.data(), meshModelFileNameBuffer.size(), m_meshModelFileName.c_str());
+		if (ImGui::InputText("Model File Name", meshModelFileNameBuffer.data(), sizeof(meshModelFileNameBuffer), ImGuiInputTextFlags_EnterReturnsTrue)) SetMeshModel(meshModelFileNameBuffer.data());
+		if (m_meshBVH) ImGui::Text("Triangles: %zu, Nodes: %zu, %zu KB", m_meshBVH->GetTriangleCount(), m_meshBVH->GetNodeCount(), m_meshBVH->GetMemoryBytes() / 1024);
+
+		// 같은 오브젝트의 모델 컴포넌트 첫 모델 사용
+		if (ImGui::Button("Use Model Component Mesh"))
+		{
+			const ModelComponent* modelComp = m_owner->GetComponent<ModelComponent>();
+			if (modelComp && !modelComp->GetModelAndMaterialFileNames().empty()) SetMeshModel(modelComp->GetModelAndMaterialFileNames().front().first);
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("Clear")) SetMeshModel({});
 
 		ImGui::TreePop();
 	}
 
 	if (ImGui::Button("Load From Model Mesh")) LoadFromModelMesh();
+
+	if (isEdited) m_worldShapesVersion = 0;
 }
 #endif
 
 void ColliderComponent::Finalize()
 {
-	auto it = find(s_colliders.begin(), s_colliders.end(), this);
-	if (it != s_colliders.end()) s_colliders.erase(it);
+	RemoveFromColliders();
 }
 
 nlohmann::json ColliderComponent::Serialize()
 {
 	nlohmann::json jsonData;
 
+	jsonData["layer"] = static_cast<int>(m_layer);
+	jsonData["collisionMask"] = m_collisionMask;
+	jsonData["meshModelFileName"] = m_meshModelFileName;
+
 	jsonData["boundingBoxes"] = nlohmann::json::array();
 	for (const auto& [box, transformedBox] : m_boundingBoxes)
 	{
@@ -408,43 +804,120 @@ nlohmann::json ColliderComponent::Serialize()
 		frustumData["far"] = frustum.Far;
 		jsonData["boundingFrustums"].push_back(frustumData);
 	}
+	jsonData["boundingSpheres"] = nlohmann::json::array();
+	for (const auto& [sphere, transformedSphere] : m_boundingSpheres)
+	{
+		nlohmann::json sphereData;
+		sphereData["center"] = { sphere.Center.x, sphere.Center.y, sphere.Center.z };
+		sphereData["radius"] = sphere.Radius;
+		jsonData["boundingSpheres"].push_back(sphereData);
+	}
+	jsonData["boundingCapsules"] = nlohmann::json::array();
+	for (const auto& [capsule, transformedCapsule] : m_boundingCapsules)
+	{
+		nlohmann::json capsuleData;
+		capsuleData["pointA"] = { capsule.pointA.x, capsule.pointA.y, capsule.pointA.z };
+		capsuleData["pointB"] = { capsule.pointB.x, capsule.pointB.y, capsule.pointB.z };
+		capsuleData["radius"] = capsule.radius;
+		jsonData["boundingCapsules"].push_back(capsuleData);
+	}
 
 	return jsonData;
 }
 
 void ColliderComponent::Deserialize(const nlohmann::json& jsonData)
 {
-	m_boundingBoxes.clear();
-	for (const auto& boxData : jsonData["boundingBoxes"])
-	{
-		BoundingBox box;
-		box.Center = XMFLOAT3{ boxData["center"][0], boxData["center"][1], boxData["center"][2] };
-		box.Extents = XMFLOAT3{ boxData["extents"][0], boxData["extents"][1], boxData["extents"][2] };
-		AddBoundingBox(box);
-	}
-	m_boundingOrientedBoxes.clear();
-	for (const auto& obbData : jsonData["boundingOrientedBoxes"])
-	{
-		BoundingOrientedBox obb;
-		obb.Center = XMFLOAT3{ obbData["center"][0], obbData["center"][1], obbData["center"][2] };
-		obb.Extents = XMFLOAT3{ obbData["extents"][0], obbData["extents"][1], obbData["extents"][2] };
-		obb.Orientation = XMFLOAT4{ obbData["orientation"][0], obbData["orientation"][1], obbData["orientation"][2], obbData["orientation"][3] };
-		AddBoundingOrientedBox(obb);
-	}
-	m_boundingFrustums.clear();
-	for (const auto& frustumData : jsonData["boundingFrustums"])
-	{
-		BoundingFrustum frustum;
-		frustum.Origin = XMFLOAT3{ frustumData["origin"][0], frustumData["origin"][1], frustumData["origin"][2] };
-		frustum.Orientation = XMFLOAT4{ frustumData["orientation"][0], frustumData["orientation"][1], frustumData["orientation"][2], frustumData["orientation"][3] };
-		frustum.RightSlope = frustumData["rightSlope"];
-		frustum.LeftSlope = frustumData["leftSlope"];
-		frustum.TopSlope = frustumData["topSlope"];
-		frustum.BottomSlope = frustumData["bottomSlope"];
-		frustum.Near = frustumData["near"];
-		frustum.Far = frustumData["far"];
-		AddBoundingFrustum(frustum);
+	for (const char* key : { "boundingBoxes", "boundingOrientedBoxes", "boundingFrustums" }) DeserializeField(key, jsonData[key]);
+	// 레이어가 없는 이전 데이터는 기본 레이어, 모든 레이어와 충돌
+	for (const char* key : { "boundingSpheres", "boundingCapsules", "layer", "collisionMask", "meshModelFileName" }) if (jsonData.contains(key)) DeserializeField(key, jsonData[key]);
+}
+
+bool ColliderComponent::DeserializeField(const string& key, const nlohmann::json& value)
+{
+	if (key == "layer")
+	{
+		const int layer = value.get<int>();
+		if (layer < 0 || layer >= static_cast<int>(CollisionLayer::Count))
+		{
+			cerr << "오류: 잘못된 충돌 레이어 " << layer << endl;
+			return false;
+		}
+		SetLayer(static_cast<CollisionLayer>(layer));
+		return true;
+	}
+	if (key == "collisionMask")
+	{
+		SetCollisionMask(value.get<uint32_t>());
+		return true;
+	}
+	if (key == "meshModelFileName") return SetMeshModel(value.get<string>());
+
+	if (key == "boundingBoxes")
+	{
+		m_boundingBoxes.clear();
+		for (const auto& boxData : value)
+		{
+			BoundingBox box;
+			box.Center = XMFLOAT3{ boxData["center"][0], boxData["center"][1], boxData["center"][2] };
+			box.Extents = XMFLOAT3{ boxData["extents"][0], boxData["extents"][1], boxData["extents"][2] };
+			AddBoundingBox(box);
+		}
+	}
+	else if (key == "boundingOrientedBoxes")
+	{
+		m_boundingOrientedBoxes.clear();
+		for (const auto& obbData : value)
+		{
+			BoundingOrientedBox obb;
+			obb.Center = XMFLOAT3{ obbData["center"][0], obbData["center"][1], obbData["center"][2] };
+			obb.Extents = XMFLOAT3{ obbData["extents"][0], obbData["extents"][1], obbData["extents"][2] };
+			obb.Orientation = XMFLOAT4{ obbData["orientation"][0], obbData["orientation"][1], obbData["orientation"][2], obbData["orientation"][3] };
+			AddBoundingOrientedBox(obb);
+		}
+	}
+	else if (key == "boundingFrustums")
+	{
+		m_boundingFrustums.clear();
+		for (const auto& frustumData : value)
+		{
+			BoundingFrustum frustum;
+			frustum.Origin = XMFLOAT3{ frustumData["origin"][0], frustumData["origin"][1], frustumData["origin"][2] };
+			frustum.Orientation = XMFLOAT4{ frustumData["orientation"][0], frustumData["orientation"][1], frustumData["orientation"][2], frustumData["orientation"][3] };
+			frustum.RightSlope = frustumData["rightSlope"];
+			frustum.LeftSlope = frustumData["leftSlope"];
+			frustum.TopSlope = frustumData["topSlope"];
+			frustum.BottomSlope = frustumData["bottomSlope"];
+			frustum.Near = frustumData["near"];
+			frustum.Far = frustumData["far"];
+			AddBoundingFrustum(frustum);
+		}
+	}
+	else if (key == "boundingSpheres")
+	{
+		m_boundingSpheres.clear();
+		for (const auto& sphereData : value)
+		{
+			BoundingSphere sphere;
+			sphere.Center = XMFLOAT3{ sphereData["center"][0], sphereData["center"][1], sphereData["center"][2] };
+			sphere.Radius = sphereData["radius"];
+			AddBoundingSphere(sphere);
+		}
+	}
+	else if (key == "boundingCapsules")
+	{
+		m_boundingCapsules.clear();
+		for (const auto& capsuleData : value)
+		{
+			BoundingCapsule capsule;
+			capsule.pointA = XMFLOAT3{ capsuleData["pointA"][0], capsuleData["pointA"][1], capsuleData["pointA"][2] };
+			capsule.pointB = XMFLOAT3{ capsuleData["pointB"][0], capsuleData["pointB"][1], capsuleData["pointB"][2] };
+			capsule.radius = capsuleData["radius"];
+			AddBoundingCapsule(capsule);
+		}
 	}
+	m_worldShapesVersion = 0;
+
+	return true;
 }
 
 void ColliderComponent::LoadFromModelMesh()
@@ -453,4 +926,118 @@ void ColliderComponent::LoadFromModelMesh()
 	if (!modelComp) return;
 
 	for (const auto& [model, material] : modelComp->GetModelsAndMaterials()) for (const Mesh& mesh : model->meshes) AddBoundingBox(mesh.boundingBox);
-}
\ No newline at end of file
+}
+
+BoundingBox ColliderComponent::UpdateWorldShapes()
+{
+	m_worldShapesVersion = m_owner->GetTransformVersion();
+
+	const XMMATRIX& worldMatrix = m_owner->GetWorldMatrix();
+	for (auto& [box, transformedBox] : m_boundingBoxes) box.Transform(transformedBox, worldMatrix);
+	for (auto& [obb, transformedOBB] : m_boundingOrientedBoxes) obb.Transform(transformedOBB, worldMatrix);
+	for (auto& [frustum, transformedFrustum] : m_boundingFrustums) frustum.Transform(transformedFrustum, worldMatrix);
+	for (auto& [sphere, transformedSphere] : m_boundingSpheres) sphere.Transform(transformedSphere, worldMatrix);
+	for (auto& [capsule, transformedCapsule] : m_boundingCapsules) capsule.Transform(transformedCapsule, worldMatrix);
+	if (m_meshBVH)
+	{
+		BoundingOrientedBox meshBounds = {};
+		BoundingOrientedBox::CreateFromBoundingBox(meshBounds, m_meshBVH->GetBounds());
+		meshBounds.Transform(m_worldMeshBounds, worldMatrix);
+		m_inverseWorldMatrix = XMMatrixInverse(nullptr, worldMatrix);
+	}
+
+	m_worldBoxPackets.assign((m_boundingBoxes.size() + RAY_PACKET_WIDTH - 1) / RAY_PACKET_WIDTH, {});
+	for (size_t i = 0; i < m_boundingBoxes.size(); ++i) m_worldBoxPackets[i / RAY_PACKET_WIDTH].Set(i % RAY_PACKET_WIDTH, m_boundingBoxes[i].second);
+	m_worldOBBPackets.assign((m_boundingOrientedBoxes.size() + RAY_PACKET_WIDTH - 1) / RAY_PACKET_WIDTH, {});
+	for (size_t i = 0; i < m_boundingOrientedBoxes.size(); ++i) m_worldOBBPackets[i / RAY_PACKET_WIDTH].Set(i % RAY_PACKET_WIDTH, m_boundingOrientedBoxes[i].second);
+
+	if (!HasShapes())
+	{
+		XMFLOAT3 position = {};
+		XMStoreFloat3(&position, worldMatrix.r[3]);
+		return BoundingBox(position, {});
+	}
+
+	XMVECTOR minimum = XMVectorReplicate(numeric_limits<float>::max());
+	XMVECTOR maximum = XMVectorReplicate(-numeric_limits<float>::max());
+	const auto mergeCorners = [&](const auto& transformedShape)
+		{
+			array<XMFLOAT3, 8> corners = {};
+			transformedShape.GetCorners(corners.data());
+			for (const XMFLOAT3& corner : corners)
+			{
+				const XMVECTOR point = XMLoadFloat3(&corner);
+				minimum = XMVectorMin(minimum, point);
+				maximum = XMVectorMax(maximum, point);
+			}
+		};
+	for (const auto& [box, transformedBox] : m_boundingBoxes) mergeCorners(transformedBox);
+	for (const auto& [obb, transformedOBB] : m_boundingOrientedBoxes) mergeCorners(transformedOBB);
+	for (const auto& [frustum, transformedFrustum] : m_boundingFrustums) mergeCorners(transformedFrustum);
+	if (m_meshBVH) mergeCorners(m_worldMeshBounds);
+	// 구, 캡슐은 감싸는 상자를 바로 계산 // 꼭짓점이 없고 더 작음
+	const auto mergeBounds = [&](const BoundingBox& bounds)
+		{
+			const XMVECTOR center = XMLoadFloat3(&bounds.Center);
+			const XMVECTOR extents = XMLoadFloat3(&bounds.Extents);
+			minimum = XMVectorMin(minimum, XMVectorSubtract(center, extents));
+			maximum = XMVectorMax(maximum, XMVectorAdd(center, extents));
+		};
+	for (const auto& [sphere, transformedSphere] : m_boundingSpheres)
+	{
+		BoundingBox bounds = {};
+		BoundingBox::CreateFromSphere(bounds, transformedSphere);
+		mergeBounds(bounds);
+	}
+	for (const auto& [capsule, transformedCapsule] : m_boundingCapsules) mergeBounds(transformedCapsule.GetBounds());
+
+	BoundingBox worldBounds = {};
+	BoundingBox::CreateFromPoints(worldBounds, minimum, maximum);
+
+	return worldBounds;
+}
+
+void ColliderComponent::AddToColliders()
+{
+	if (m_proxyId != DynamicAABBTree::NULL_NODE) return;
+
+	m_proxyId = s_broadPhase.CreateProxy(UpdateWorldShapes(), this, ToLayerMask(m_layer), GetPairMask());
+}
+
+void ColliderComponent::UpdateFilter()
+{
+	if (m_proxyId == DynamicAABBTree::NULL_NODE) return;
+
+	s_broadPhase.SetFilter(m_proxyId, ToLayerMask(m_layer), GetPairMask());
+}
+
+void ColliderComponent::RemoveFromColliders(bool notifyOwner)
+{
+	if (m_proxyId == DynamicAABBTree::NULL_NODE) return;
+
+	// 처리 함수에서 다른 콜라이더가 해제될 수 있으므로 목록에서 먼저 빼고 전달
+	FrameVector<ColliderComponent*> others = {};
+	erase_if
+	(
+		s_contacts,
+		[&](const pair<int32_t, int32_t>& contact)
+		{
+			if (contact.first != m_proxyId && contact.second != m_proxyId) return false;
+
+			others.push_back(static_cast<ColliderComponent*>(s_broadPhase.GetUserData(contact.first == m_proxyId ? contact.second : contact.first)));
+			return true;
+		}
+	);
+
+	s_broadPhase.DestroyProxy(m_proxyId);
+	m_proxyId = DynamicAABBTree::NULL_NODE;
+
+	// 앞선 처리 함수에서 해제된 상대는 건너뜀
+	for (ColliderComponent* other : others)
+	{
+		if (other->m_proxyId == DynamicAABBTree::NULL_NODE) continue;
+
+		static_cast<IBase*>(other->m_owner)->BaseCollision(CollisionEvent::Exit, this);
+		if (notifyOwner) static_cast<IBase*>(m_owner)->BaseCollision(CollisionEvent::Exit, other);
+	}
+}
@@ -1,14 +1,53 @@
 #pragma once
 #include "ComponentBase.h"
+#include "FrameArena.h"
+#include "DynamicAABBTree.h"
+#include "RayPacket.h"
+#include "TriangleBVH.h"
+#include "BoundingCapsule.h"
+#include "VisibilityCache.h"
+
+// 충돌 레이어 // 콜라이더마다 하나 // 조회 마스크, 레이어 충돌 행렬은 레이어 비트 조합
+enum class CollisionLayer : uint32_t
+{
+	Default,
+	Level, // 바닥, 벽 등 레벨 지오메트리
+	Player,
+	Enemy,
+
+	Count
+};
+constexpr std::array<const char*, static_cast<size_t>(CollisionLayer::Count)> COLLISION_LAYER_NAMES = { "Default", "Level", "Player", "Enemy" };
+constexpr uint32_t ALL_COLLISION_LAYERS = DynamicAABBTree::ALL_CATEGORIES;
+// 레이어 비트
+constexpr uint32_t ToLayerMask(CollisionLayer layer) { return 1u << static_cast<uint32_t>(layer); }
 
 class ColliderComponent : public ComponentBase
 {
-	static std::vector<ColliderComponent*> s_colliders; // 모든 콜라이더 컴포넌트 배열
+	static DynamicAABBTree s_broadPhase; // 등록된 콜라이더의 월드 경계 트리 // 충돌 검사는 여기서 후보만 추린 뒤 모양별 검사
+	int32_t m_proxyId = DynamicAABBTree::NULL_NODE; // s_broadPhase 내 프록시 아이디 // 등록되지 않았으면 NULL_NODE
+	static std::array<uint32_t, static_cast<size_t>(CollisionLayer::Count)> s_layerCollisionMatrix; // 레이어별로 충돌 쌍을 만드는 상대 레이어 비트 // 대칭
+	static std::vector<std::pair<int32_t, int32_t>> s_contacts; // 이전 고정 단계에서 겹친 콜라이더 쌍의 프록시 아이디 // 오름차순 정렬, 쌍 안에서도 작은 아이디가 앞
 
-	// 로컬 좌표계 기준 경계 상자, 방향 상자, 절두체 쌍 배열 (로컬, 월드)
+	// 로컬 좌표계 기준 경계 상자, 방향 상자, 절두체, 구, 캡슐 쌍 배열 (로컬, 월드)
 	std::vector<std::pair<DirectX::BoundingBox, DirectX::BoundingBox>> m_boundingBoxes = {};
 	std::vector<std::pair<DirectX::BoundingOrientedBox, DirectX::BoundingOrientedBox>> m_boundingOrientedBoxes = {};
 	std::vector<std::pair<DirectX::BoundingFrustum, DirectX::BoundingFrustum>> m_boundingFrustums = {};
+	std::vector<std::pair<DirectX::BoundingSphere, DirectX::BoundingSphere>> m_boundingSpheres = {};
+	std::vector<std::pair<BoundingCapsule, BoundingCapsule>> m_boundingCapsules = {};
+	// 메쉬 콜라이더 // 광선은 모델 삼각형으로 정밀 검사, 겹침 검사는 메쉬 경계 방향 상자로 근사
+	std::string m_meshModelFileName = {}; // 비었으면 메쉬 콜라이더 없음
+	const TriangleBVH* m_meshBVH = nullptr; // 리소스 매니저 캐시 // 로컬 좌표계 기준
+	DirectX::BoundingOrientedBox m_worldMeshBounds = {};
+	DirectX::XMMATRIX m_inverseWorldMatrix = DirectX::XMMatrixIdentity(); // 광선을 메쉬 로컬 좌표계로 옮기는 행렬
+	CollisionLayer m_layer = CollisionLayer::Default; // 충돌 레이어
+	uint32_t m_collisionMask = ALL_COLLISION_LAYERS; // 충돌 쌍을 만드는 상대 레이어 비트 // 레이어 충돌 행렬과 함께 적용
+
+	uint32_t m_worldShapesVersion = 0; // 월드 경계를 마지막으로 계산한 소유 게임 오브젝트 변환 버전 // 모양이 바뀌면 0
+
+	// 월드 경계 상자, 방향 상자를 4개씩 묶은 SoA // 광선 검사용 // 월드 경계와 함께 갱신
+	std::vector<AABBPacket> m_worldBoxPackets = {};
+	std::vector<OBBPacket> m_worldOBBPackets = {};
 
 	#ifdef _DEBUG
 	std::pair<com_ptr<ID3D11VertexShader>, com_ptr<ID3D11InputLayout>> m_boundingShapeVertexShaderAndInputLayout = {}; // 경계 상자 정점 셰이더 및 입력 레이아웃
@@ -16,6 +55,13 @@ class ColliderComponent : public ComponentBase
 	#endif
 
 public:
+	// 선 충돌 검사 결과
+	struct RaycastHit
+	{
+		GameObjectBase* object = nullptr;
+		float distance = std::numeric_limits<float>::max();
+	};
+
 	ColliderComponent() = default;
 	virtual ~ColliderComponent() override = default;
 	ColliderComponent(const ColliderComponent&) = default;
@@ -24,43 +70,110 @@ public:
 	ColliderComponent& operator=(ColliderComponent&&) = default;
 
 	// 로컬 좌표계 기준 경계 상자 추가
-	void AddBoundingBox(const DirectX::BoundingBox& box) { m_boundingBoxes.push_back({ box, {} }); }
+	void AddBoundingBox(const DirectX::BoundingBox& box) { m_boundingBoxes.push_back({ box, {} }); m_worldShapesVersion = 0; }
 	// 로컬 좌표계 기준 경계 방향 상자 추가
-	void AddBoundingOrientedBox(const DirectX::BoundingOrientedBox& obb) { m_boundingOrientedBoxes.push_back({ obb, {} }); }
+	void AddBoundingOrientedBox(const DirectX::BoundingOrientedBox& obb) { m_boundingOrientedBoxes.push_back({ obb, {} }); m_worldShapesVersion = 0; }
 	// 로컬 좌표계 기준 경계 절두체 추가
-	void AddBoundingFrustum(const DirectX::BoundingFrustum& frustum) { m_boundingFrustums.push_back({ frustum, {} }); }
+	void AddBoundingFrustum(const DirectX::BoundingFrustum& frustum) { m_boundingFrustums.push_back({ frustum, {} }); m_worldShapesVersion = 0; }
+	// 로컬 좌표계 기준 경계 구 추가
+	void AddBoundingSphere(const DirectX::BoundingSphere& sphere) { m_boundingSpheres.push_back({ sphere, {} }); m_worldShapesVersion = 0; }
+	// 로컬 좌표계 기준 캡슐 추가 // 캐릭터 크기 오브젝트는 방향 상자보다 검사가 싸고 몸에 더 맞음
+	void AddBoundingCapsule(const BoundingCapsule& capsule) { m_boundingCapsules.push_back({ capsule, {} }); m_worldShapesVersion = 0; }
+	// 모델 삼각형 메쉬 콜라이더 설정 // 빈 이름이면 해제 // 정적 모델만 가능, 실패하면 false
+	bool SetMeshModel(const std::string& modelFileName);
+	const std::string& GetMeshModelFileName() const { return m_meshModelFileName; }
+
+	// 충돌 레이어 // 바꾸면 브로드페이즈 필터 갱신
+	void SetLayer(CollisionLayer layer) { m_layer = layer; UpdateFilter(); }
+	CollisionLayer GetLayer() const { return m_layer; }
+	void SetCollisionMask(uint32_t collisionMask) { m_collisionMask = collisionMask; UpdateFilter(); }
+	uint32_t GetCollisionMask() const { return m_collisionMask; }
+
+	// 레이어 충돌 행렬 설정 // 대칭으로 설정 후 등록된 모든 콜라이더의 브로드페이즈 필터 갱신
+	static void SetLayerCollision(CollisionLayer a, CollisionLayer b, bool isColliding);
+	static bool GetLayerCollision(CollisionLayer a, CollisionLayer b) { return (s_layerCollisionMatrix[static_cast<size_t>(a)] & ToLayerMask(b)) != 0; }
 
-	// 충돌 검사
+	// 충돌 검사 // layerMask에 속한 레이어의 콜라이더만 대상 // 다른 레이어만 있는 하위 트리는 브로드페이즈에서 건너뜀
 	// 선 충돌 검사
-	static GameObjectBase* CheckCollision(const DirectX::XMVECTOR& origin, const DirectX::XMVECTOR& direction, _Out_ float& distance);
-	// 상자 충돌 검사
-	static std::vector<GameObjectBase*> CheckCollision(const DirectX::BoundingBox& box);
-	// 절두체 충돌 검사 // 화면 안에 있는 오브젝트
-	static std::vector<GameObjectBase*> CheckCollision(const DirectX::BoundingFrustum& frustum);
+	static GameObjectBase* CheckCollision(const DirectX::XMVECTOR& origin, const DirectX::XMVECTOR& direction, _Out_ float& distance, uint32_t layerMask = ALL_COLLISION_LAYERS);
+	// 선 묶음 충돌 검사 // 광선 4개씩 트리를 함께 내려가며 검사 // hits[i]에 rays[i] 결과 기록, hits는 rays보다 작으면 안 됨
+	// 방향은 정규화하지 않아도 됨 // 충돌이 없으면 object는 nullptr
+	static void RaycastBatch(std::span<const Ray> rays, std::span<RaycastHit> hits, uint32_t layerMask = ALL_COLLISION_LAYERS);
+	// 상자 충돌 검사 // 결과는 프레임 아레나에 할당되므로 이번 프레임 안에서만 사용
+	static FrameVector<GameObjectBase*> CheckCollision(const DirectX::BoundingBox& box, uint32_t layerMask = ALL_COLLISION_LAYERS);
+	// 절두체 충돌 검사 // 화면 안에 있는 오브젝트 // 결과는 이번 프레임 안에서만 사용
+	static FrameVector<GameObjectBase*> CheckCollision(const DirectX::BoundingFrustum& frustum, uint32_t layerMask = ALL_COLLISION_LAYERS);
+	// 가시성 캐시를 거치는 절두체 충돌 검사 // 트리는 그대로 내려가고, 같은 cache로 반복 호출하면 넓힌 상자가 그대로이고 절두체 평면에서 멀리 있는 콜라이더는 모양별 정밀 검사를 건너뜀
+	static FrameVector<GameObjectBase*> CheckCollision(const DirectX::BoundingFrustum& frustum, _Inout_ VisibilityCache& cache, uint32_t layerMask = ALL_COLLISION_LAYERS);
+	// 캡슐 이동 검사 대상 수집 // 넓힌 상자가 bounds와 겹치는 콜라이더의 월드 경계 모양을 targets에 추가 // 사용자 데이터는 소유 게임 오브젝트
+	// 메쉬는 bounds 안 삼각형을 월드 좌표계로 옮겨 추가 // 절두체는 시야 판정용이므로 제외 // ignoredOwner가 소유한 콜라이더는 건너뜀
+	// 콜라이더를 읽기만 하므로 여러 스레드에서 동시에 호출해도 됨
+	static void GatherSweepTargets(const DirectX::BoundingBox& bounds, _Inout_ CapsuleSweepTargets& targets, uint32_t layerMask = ALL_COLLISION_LAYERS, const GameObjectBase* ignoredOwner = nullptr);
 
-	// 객체 충돌 검사
+	// 객체 충돌 검사 // 상자, 방향 상자, 절두체, 구, 캡슐, 메쉬 경계를 종류와 관계없이 서로 검사
 	bool CheckCollisionWithObject(ColliderComponent* otherCollider);
 
-	bool NeedsFixedUpdate() const override { return true; }
-	bool NeedsUpdate() const override { return true; }
+	// 움직인 콜라이더의 월드 경계 갱신 // 고정 업데이트, 업데이트 단계가 끝난 뒤 씬이 한 번씩 호출
+	// 단계 중에는 콜라이더를 읽기만 하도록 콜라이더마다 갱신하지 않고 여기서 모아 처리 // 모양 변환은 작업 시스템으로, 브로드페이즈 이동은 메인 스레드에서 차례로
+	static void RefreshMovedWorldShapes();
+	// 충돌 쌍 갱신 // 고정 업데이트 단계가 끝난 뒤 씬이 한 번 호출
+	// 브로드페이즈에서 겹치는 쌍을 구해 모양 검사 후 이전 단계와 비교해 양쪽 소유 게임 오브젝트와 컴포넌트에 시작, 유지, 종료 전달
+	static void UpdateContacts();
+	// 이전 고정 단계에서 겹친 쌍 수 // 레이어 충돌 행렬과 양쪽 충돌 마스크가 허용한 쌍만 포함
+	static size_t GetContactCount() { return s_contacts.size(); }
+
+	bool NeedsFixedUpdate() const override { return false; }
+	bool NeedsUpdate() const override { return false; }
 	#ifdef _DEBUG
 	bool NeedsRender() const override { return true; }
 	#else
 	bool NeedsRender() const override { return false; }
 	#endif
 
+	// 월드 경계는 단계가 끝난 뒤 RefreshMovedWorldShapes에서 갱신 // 렌더링은 자기 경계만 읽음
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override { return {}; }
+
 protected:
 	void Initialize() override;
-	void FixedUpdate() override;
-	void Update() override;
 	#ifdef _DEBUG
 	void Render() override;
 	void RenderImGui() override;
 	#endif
 	void Finalize() override;
 
+	// 풀 재사용 시 셰이더 조회 없이 브로드페이즈에만 다시 등록
+	void Reactivate() override { AddToColliders(); }
+
+	// 비활성화 동안 충돌 검사 대상에서 제외
+	void OnEnable() override { AddToColliders(); }
+	void OnDisable() override { RemoveFromColliders(true); }
+
 	nlohmann::json Serialize() override;
 	void Deserialize(const nlohmann::json& jsonData) override;
+	bool DeserializeField(const std::string& key, const nlohmann::json& value) override;
 
 	void LoadFromModelMesh();
+
+private:
+	// 광선 하나와 이 콜라이더의 모든 월드 경계 모양 검사 // closestDistance보다 가까운 충돌이 있으면 갱신 후 true
+	bool IntersectRay(const DirectX::XMVECTOR& origin, const DirectX::XMVECTOR& direction, const DirectX::XMVECTOR& inverseDirection, _Inout_ float& closestDistance) const;
+
+	// 월드 경계 모양 중 하나라도 shape와 겹치면 true
+	template<typename Shape>
+	bool IntersectsAnyShape(const Shape& shape) const;
+	// 월드 경계 모양 중 하나라도 other의 월드 경계 모양과 겹치면 true
+	bool IntersectsCollider(const ColliderComponent& other) const;
+	bool HasShapes() const { return !m_boundingBoxes.empty() || !m_boundingOrientedBoxes.empty() || !m_boundingFrustums.empty() || !m_boundingSpheres.empty() || !m_boundingCapsules.empty() || m_meshBVH; }
+
+	// 월드 경계 모양 갱신 후 모든 모양을 감싸는 상자 반환 // 모양이 없으면 오브젝트 위치의 점
+	DirectX::BoundingBox UpdateWorldShapes();
+
+	// 브로드페이즈에 등록 // 이미 등록되어 있으면 무시
+	void AddToColliders();
+	// 레이어, 충돌 마스크, 레이어 충돌 행렬로 브로드페이즈 분류, 마스크 비트 갱신 // 등록되어 있지 않으면 무시
+	void UpdateFilter();
+	uint32_t GetPairMask() const { return s_layerCollisionMatrix[static_cast<size_t>(m_layer)] & m_collisionMask; }
+	// 브로드페이즈에서 해제 // 이 콜라이더가 속한 충돌 쌍마다 상대에게 종료 전달
+	// notifyOwner가 true면 소유 게임 오브젝트에도 전달 // 종료 중인 소유자에게는 보내지 않도록 Finalize에서는 false
+	void RemoveFromColliders(bool notifyOwner = false);
 };
\ No newline at end of file
@@ -1,13 +1,42 @@
 #include "stdafx.h"
 #include "ComponentBase.h"
 
+#include "GameObjectBase.h"
+#include "DestructionQueue.h"
+
+ComponentBase::~ComponentBase()
+{
+	if (m_destructionIndex != DestructionQueue::INVALID_INDEX) DestructionQueue::GetInstance().Cancel(this);
+}
+
 void ComponentBase::BaseInitialize()
 {
 	m_type = GetTypeName(*this);
+	#if PROFILER_ENABLED
+	m_profileName = Profiler::GetInstance().InternName(m_type);
+	#endif
+	PROFILE_SCOPE(m_profileName);
 
 	Initialize();
 }
 
+void ComponentBase::SetActive(bool isActive)
+{
+	if (GetActive() == isActive) return;
+
+	Base::SetActive(isActive);
+	if (m_owner) m_owner->OnComponentActiveChanged(this);
+}
+
+void ComponentBase::SetAlive(bool isAlive)
+{
+	if (GetAlive() == isAlive) return;
+
+	Base::SetAlive(isAlive);
+	if (isAlive) DestructionQueue::GetInstance().Cancel(this);
+	else DestructionQueue::GetInstance().Enqueue(this);
+}
+
 #ifdef _DEBUG
 void ComponentBase::BaseRenderImGui()
 {
@@ -1,14 +1,21 @@
 #pragma once
 #include "Base.h"
+#include "FrameScheduler.h"
 
 class ComponentBase : public Base
 {
+	friend class StreamingSceneLoader;
+	friend class DestructionQueue;
+
 protected:
 	class GameObjectBase* m_owner = nullptr; // 소유 게임 오브젝트 포인터
 
+private:
+	size_t m_destructionIndex = std::numeric_limits<size_t>::max(); // 제거 대기열 내 인덱스 // 대기 중이 아니면 최댓값
+
 public:
 	ComponentBase() = default;
-	virtual ~ComponentBase() = default;
+	virtual ~ComponentBase(); // 제거 대기 중이면 대기열에서 제외
 	ComponentBase(const ComponentBase&) = default; // 복사
 	ComponentBase& operator=(const ComponentBase&) = default; // 복사 대입
 	ComponentBase(ComponentBase&&) = default; // 이동
@@ -17,25 +24,39 @@ public:
 	void SetOwner(GameObjectBase* owner) { m_owner = owner; }
 	GameObjectBase* GetOwner() const { return m_owner; }
 
+	// 비활성 컴포넌트는 소유 게임 오브젝트의 업데이트, 렌더링 목록에서 빠짐
+	void SetActive(bool isActive) override;
+	// 죽은 컴포넌트는 다음 프레임 시작 시 소유 게임 오브젝트에서 제거
+	void SetAlive(bool isAlive) override;
+
 	virtual bool NeedsFixedUpdate() const = 0;
 	virtual bool NeedsUpdate() const = 0;
 	virtual bool NeedsRender() const = 0;
+
+	// 프레임 단계에서 소유 하위 트리 밖으로 읽고 쓰는 자원 // 선언하지 않으면 단독 실행
+	virtual FrameAccessSet GetFrameAccess(FramePhase phase) const { return FrameAccessSet::Exclusive(); }
+
+protected:
+	// 스트리밍 로더용 키 단위 역직렬화 // 지원하지 않으면 false 반환 후 Deserialize로 대체
+	virtual bool DeserializeField(const std::string& key, const nlohmann::json& value) { return false; }
   
 private:
 	void BaseInitialize() override;
-	void BaseFixedUpdate() override { FixedUpdate(); }
-	void BaseUpdate() override { Update(); }
-	void BaseRender() override { Render(); }
+	void BaseFixedUpdate() override { PROFILE_SCOPE(m_profileName); FixedUpdate(); }
+	void BaseUpdate() override { PROFILE_SCOPE(m_profileName); Update(); }
+	void BaseRender() override { PROFILE_SCOPE(m_profileName); Render(); }
 	#ifdef _DEBUG
 	void BaseRenderImGui() override;
 	#endif
-	void BaseFinalize() override { Finalize(); }
+	void BaseFinalize() override { PROFILE_SCOPE(m_profileName); Finalize(); }
+	void BaseReset() override { PROFILE_SCOPE(m_profileName); Reset(); }
+	void BaseReactivate() override { PROFILE_SCOPE(m_profileName); Reactivate(); }
+	void BaseEnable() override { PROFILE_SCOPE(m_profileName); OnEnable(); }
+	void BaseDisable() override { PROFILE_SCOPE(m_profileName); OnDisable(); }
+	void BaseCollision(CollisionEvent event, ColliderComponent* other) override { PROFILE_SCOPE(m_profileName); DispatchCollision(event, other); }
 
 	// 컴포넌트 직렬화
 	nlohmann::json BaseSerialize() override;
 	// 컴포넌트 역직렬화
 	void BaseDeserialize(const nlohmann::json& jsonData) override { Deserialize(jsonData); }
-
-	// 컴포넌트는 제거 대기 처리가 필요 없으므로 빈 구현
-	void RemovePending() override {};
 };
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "stdafx.h"
+#include "DestructionQueue.h"
+
+#include "SceneBase.h"
+#include "GameObjectBase.h"
+#include "ComponentBase.h"
+
+using namespace std;
+
+void DestructionQueue::Enqueue(ComponentBase* component)
+{
+	lock_guard<mutex> lock(m_mutex);
+
+	if (component->m_destructionIndex != INVALID_INDEX) return;
+
+	component->m_destructionIndex = m_pendingComponents.size();
+	m_pendingComponents.push_back(component);
+}
+
+void DestructionQueue::Enqueue(GameObjectBase* gameObject)
+{
+	lock_guard<mutex> lock(m_mutex);
+
+	if (gameObject->m_destructionIndex != INVALID_INDEX) return;
+
+	gameObject->m_destructionIndex = m_pendingGameObjects.size();
+	m_pendingGameObjects.push_back(gameObject);
+}
+
+void DestructionQueue::Cancel(ComponentBase* component)
+{
+	lock_guard<mutex> lock(m_mutex);
+
+	if (component->m_destructionIndex == INVALID_INDEX) return;
+
+	m_pendingComponents[component->m_destructionIndex] = nullptr;
+	component->m_destructionIndex = INVALID_INDEX;
+}
+
+void DestructionQueue::Cancel(GameObjectBase* gameObject)
+{
+	lock_guard<mutex> lock(m_mutex);
+
+	if (gameObject->m_destructionIndex == INVALID_INDEX) return;
+
+	m_pendingGameObjects[gameObject->m_destructionIndex] = nullptr;
+	gameObject->m_destructionIndex = INVALID_INDEX;
+}
+
+void DestructionQueue::Flush(SceneBase& scene)
+{
+	// 종료 처리 중 새로 요청된 항목까지 모두 제거
+	while (!m_pendingComponents.empty() || !m_pendingGameObjects.empty())
+	{
+		FlushComponents();
+		FlushGameObjects(scene);
+	}
+}
+
+void DestructionQueue::FlushComponents()
+{
+	// 종료 처리 중 추가된 항목도 같은 순회에서 처리
+	for (size_t i = 0; i < m_pendingComponents.size(); ++i)
+	{
+		ComponentBase* component = m_pendingComponents[i];
+		if (!component) continue;
+
+		m_pendingComponents[i] = nullptr;
+		component->m_destructionIndex = INVALID_INDEX;
+
+		if (!component->GetAlive() && component->m_owner) component->m_owner->DestroyComponent(component);
+	}
+	m_pendingComponents.clear();
+}
+
+void DestructionQueue::FlushGameObjects(SceneBase& scene)
+{
+	// 제거할 게임 오브젝트를 소유한 부모(루트는 nullptr)를 자식 깊이와 함께 수집
+	vector<pair<size_t, GameObjectBase*>> owners = {};
+	owners.reserve(m_pendingGameObjects.size());
+	for (GameObjectBase* gameObject : m_pendingGameObjects)
+	{
+		if (!gameObject) continue;
+
+		gameObject->m_destructionIndex = INVALID_INDEX;
+		if (gameObject->GetAlive()) continue;
+
+		size_t depth = 0;
+		for (const GameObjectBase* parent = gameObject->m_parent; parent; parent = parent->m_parent) depth++;
+		owners.emplace_back(depth, gameObject->m_parent);
+	}
+	m_pendingGameObjects.clear();
+
+	// 깊은 쪽부터 처리 // 부모가 풀에 반환되거나 종료되기 전에 제거 대기 중인 자식을 먼저 떼어냄
+	// 같은 부모의 자식은 한 번의 순회로 함께 제거
+	sort(owners.begin(), owners.end(), greater<>());
+	owners.erase(unique(owners.begin(), owners.end()), owners.end());
+
+	for (const auto& [depth, parent] : owners)
+	{
+		if (parent) parent->DestroyDeadChildren();
+		else scene.DestroyDeadRootGameObjects();
+	}
+}
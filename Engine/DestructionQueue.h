@@ -0,0 +1,45 @@
+#pragma once
+
+class GameObjectBase;
+class ComponentBase;
+class SceneBase;
+
+// SetAlive(false)로 제거 요청된 게임 오브젝트, 컴포넌트를 모아 프레임당 한 번 일괄 제거
+// 요청이 없으면 계층 순회 없이 바로 반환 // 대기 중인 객체는 배열 내 인덱스를 저장하여 취소, 소멸 시 O(1)로 자리를 비움
+class DestructionQueue : public Singleton<DestructionQueue>
+{
+	friend class Singleton<DestructionQueue>;
+
+public:
+	static constexpr size_t INVALID_INDEX = std::numeric_limits<size_t>::max();
+
+private:
+	std::mutex m_mutex = {}; // 요청, 취소 보호 // 병렬 프레임 단계 중 SetAlive 호출 대비 // Flush는 메인 스레드에서만 호출
+	std::vector<ComponentBase*> m_pendingComponents = {}; // 제거 대기 중인 컴포넌트 배열 // 취소된 자리는 nullptr
+	std::vector<GameObjectBase*> m_pendingGameObjects = {}; // 제거 대기 중인 게임 오브젝트 배열 // 취소된 자리는 nullptr
+
+public:
+	~DestructionQueue() = default;
+	DestructionQueue(const DestructionQueue&) = delete;
+	DestructionQueue& operator=(const DestructionQueue&) = delete;
+	DestructionQueue(DestructionQueue&&) = delete;
+	DestructionQueue& operator=(DestructionQueue&&) = delete;
+
+	// 제거 요청 // 이미 대기 중이면 무시
+	void Enqueue(ComponentBase* component);
+	void Enqueue(GameObjectBase* gameObject);
+	// 제거 요청 취소 // 다시 살아나거나 먼저 소멸한 경우
+	void Cancel(ComponentBase* component);
+	void Cancel(GameObjectBase* gameObject);
+
+	// 대기 중인 컴포넌트, 게임 오브젝트 제거 // 프레임 시작 시 호출 // 풀링 대상 게임 오브젝트는 풀에 반환
+	void Flush(SceneBase& scene);
+
+private:
+	DestructionQueue() = default;
+
+	// 대기 중인 컴포넌트 제거
+	void FlushComponents();
+	// 대기 중인 게임 오브젝트 제거 // 깊은 자식부터 제거
+	void FlushGameObjects(SceneBase& scene);
+};
@@ -0,0 +1,544 @@
+#include "stdafx.h"
+#include "DynamicAABBTree.h"
+
+#include "Microbenchmark.h"
+
+using namespace std;
+using namespace DirectX;
+
+REGISTER_MICROBENCHMARK(DynamicAABBTree, DynamicAABBTree::RunMicrobenchmarks)
+
+DynamicAABBTree::AABB DynamicAABBTree::AABB::FromBoundingBox(const BoundingBox& box)
+{
+	return
+	{
+		.minimum = { box.Center.x - box.Extents.x, box.Center.y - box.Extents.y, box.Center.z - box.Extents.z },
+		.maximum = { box.Center.x + box.Extents.x, box.Center.y + box.Extents.y, box.Center.z + box.Extents.z }
+	};
+}
+
+BoundingBox DynamicAABBTree::AABB::ToBoundingBox() const
+{
+	return BoundingBox
+	(
+		{ (minimum.x + maximum.x) * 0.5f, (minimum.y + maximum.y) * 0.5f, (minimum.z + maximum.z) * 0.5f },
+		{ (maximum.x - minimum.x) * 0.5f, (maximum.y - minimum.y) * 0.5f, (maximum.z - minimum.z) * 0.5f }
+	);
+}
+
+bool DynamicAABBTree::AABB::Contains(const AABB& other) const
+{
+	return minimum.x <= other.minimum.x && minimum.y <= other.minimum.y && minimum.z <= other.minimum.z &&
+		other.maximum.x <= maximum.x && other.maximum.y <= maximum.y && other.maximum.z <= maximum.z;
+}
+
+bool DynamicAABBTree::AABB::Overlaps(const AABB& other) const
+{
+	return minimum.x <= other.maximum.x && other.minimum.x <= maximum.x &&
+		minimum.y <= other.maximum.y && other.minimum.y <= maximum.y &&
+		minimum.z <= other.maximum.z && other.minimum.z <= maximum.z;
+}
+
+float DynamicAABBTree::AABB::GetSurfaceArea() const
+{
+	const float x = maximum.x - minimum.x;
+	const float y = maximum.y - minimum.y;
+	const float z = maximum.z - minimum.z;
+
+	return 2.0f * (x * y + y * z + z * x);
+}
+
+DynamicAABBTree::AABB DynamicAABBTree::AABB::Merge(const AABB& a, const AABB& b)
+{
+	return
+	{
+		.minimum = { min(a.minimum.x, b.minimum.x), min(a.minimum.y, b.minimum.y), min(a.minimum.z, b.minimum.z) },
+		.maximum = { max(a.maximum.x, b.maximum.x), max(a.maximum.y, b.maximum.y), max(a.maximum.z, b.maximum.z) }
+	};
+}
+
+int32_t DynamicAABBTree::CreateProxy(const BoundingBox& bounds, void* userData, uint32_t categoryBits, uint32_t maskBits)
+{
+	const int32_t proxyId = AllocateNode();
+	Node& node = m_nodes[proxyId];
+
+	node.bounds = AABB::FromBoundingBox(bounds);
+	node.bounds.minimum = { node.bounds.minimum.x - m_fatMargin, node.bounds.minimum.y - m_fatMargin, node.bounds.minimum.z - m_fatMargin };
+	node.bounds.maximum = { node.bounds.maximum.x + m_fatMargin, node.bounds.maximum.y + m_fatMargin, node.bounds.maximum.z + m_fatMargin };
+	node.userData = userData;
+	node.height = 0;
+	node.categoryBits = categoryBits;
+	node.maskBits = maskBits;
+
+	InsertLeaf(proxyId);
+	m_proxyCount++;
+
+	return proxyId;
+}
+
+void DynamicAABBTree::DestroyProxy(int32_t proxyId)
+{
+	RemoveLeaf(proxyId);
+	FreeNode(proxyId);
+	m_proxyCount--;
+}
+
+bool DynamicAABBTree::MoveProxy(int32_t proxyId, const BoundingBox& bounds)
+{
+	const AABB tightBounds = AABB::FromBoundingBox(bounds);
+	if (m_nodes[proxyId].bounds.Contains(tightBounds)) return false;
+
+	RemoveLeaf(proxyId);
+
+	Node& node = m_nodes[proxyId];
+	node.bounds.minimum = { tightBounds.minimum.x - m_fatMargin, tightBounds.minimum.y - m_fatMargin, tightBounds.minimum.z - m_fatMargin };
+	node.bounds.maximum = { tightBounds.maximum.x + m_fatMargin, tightBounds.maximum.y + m_fatMargin, tightBounds.maximum.z + m_fatMargin };
+
+	InsertLeaf(proxyId);
+	m_reinsertCount++;
+
+	return true;
+}
+
+void DynamicAABBTree::SetFilter(int32_t proxyId, uint32_t categoryBits, uint32_t maskBits)
+{
+	m_nodes[proxyId].categoryBits = categoryBits;
+	m_nodes[proxyId].maskBits = maskBits;
+
+	for (int32_t index = m_nodes[proxyId].parent; index != NULL_NODE; index = m_nodes[index].parent)
+	{
+		Node& node = m_nodes[index];
+		node.categoryBits = m_nodes[node.child1].categoryBits | m_nodes[node.child2].categoryBits;
+	}
+}
+
+int32_t DynamicAABBTree::AllocateNode()
+{
+	if (m_freeList == NULL_NODE)
+	{
+		m_nodes.emplace_back();
+		return static_cast<int32_t>(m_nodes.size() - 1);
+	}
+
+	const int32_t node = m_freeList;
+	m_freeList = m_nodes[node].parent;
+	m_nodes[node] = {};
+
+	return node;
+}
+
+void DynamicAABBTree::FreeNode(int32_t node)
+{
+	m_nodes[node] = { .userData = nullptr, .parent = m_freeList, .height = -1 };
+	m_freeList = node;
+}
+
+void DynamicAABBTree::InsertLeaf(int32_t leaf)
+{
+	if (m_root == NULL_NODE)
+	{
+		m_root = leaf;
+		m_nodes[leaf].parent = NULL_NODE;
+		return;
+	}
+
+	// 형제 선택 // 새 부모를 만들 때 늘어나는 표면적과 내려갈 때 조상들이 늘어나는 표면적의 합이 최소인 쪽으로 내려감
+	const AABB leafBounds = m_nodes[leaf].bounds;
+	int32_t sibling = m_root;
+	while (!m_nodes[sibling].IsLeaf())
+	{
+		const Node& node = m_nodes[sibling];
+
+		const float area = node.bounds.GetSurfaceArea();
+		const float combinedArea = AABB::Merge(node.bounds, leafBounds).GetSurfaceArea();
+
+		// 여기서 새 부모를 만드는 비용
+		const float cost = 2.0f * combinedArea;
+		// 더 내려갈 때 이 노드가 늘어나는 비용
+		const float inheritanceCost = 2.0f * (combinedArea - area);
+
+		const auto getDescendCost = [&](int32_t child)
+			{
+				const AABB& childBounds = m_nodes[child].bounds;
+				const float mergedArea = AABB::Merge(childBounds, leafBounds).GetSurfaceArea();
+				if (m_nodes[child].IsLeaf()) return mergedArea + inheritanceCost;
+				return mergedArea - childBounds.GetSurfaceArea() + inheritanceCost;
+			};
+		const float cost1 = getDescendCost(node.child1);
+		const float cost2 = getDescendCost(node.child2);
+
+		if (cost < cost1 && cost < cost2) break;
+
+		sibling = cost1 < cost2 ? node.child1 : node.child2;
+	}
+
+	// 형제 자리에 새 부모 생성
+	const int32_t oldParent = m_nodes[sibling].parent;
+	const int32_t newParent = AllocateNode();
+	{
+		Node& parentNode = m_nodes[newParent];
+		parentNode.parent = oldParent;
+		parentNode.bounds = AABB::Merge(leafBounds, m_nodes[sibling].bounds);
+		parentNode.height = m_nodes[sibling].height + 1;
+		parentNode.categoryBits = m_nodes[leaf].categoryBits | m_nodes[sibling].categoryBits;
+		parentNode.child1 = sibling;
+		parentNode.child2 = leaf;
+	}
+	m_nodes[sibling].parent = newParent;
+	m_nodes[leaf].parent = newParent;
+
+	if (oldParent == NULL_NODE) m_root = newParent;
+	else if (m_nodes[oldParent].child1 == sibling) m_nodes[oldParent].child1 = newParent;
+	else m_nodes[oldParent].child2 = newParent;
+
+	// 조상 경계, 높이 갱신 및 균형 유지
+	for (int32_t index = m_nodes[leaf].parent; index != NULL_NODE; index = m_nodes[index].parent)
+	{
+		index = Balance(index);
+
+		Node& node = m_nodes[index];
+		node.height = 1 + max(m_nodes[node.child1].height, m_nodes[node.child2].height);
+		node.bounds = AABB::Merge(m_nodes[node.child1].bounds, m_nodes[node.child2].bounds);
+		node.categoryBits = m_nodes[node.child1].categoryBits | m_nodes[node.child2].categoryBits;
+	}
+}
+
+void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+{
+	if (leaf == m_root)
+	{
+		m_root = NULL_NODE;
+		return;
+	}
+
+	// 부모를 지우고 형제를 그 자리로 올림
+	const int32_t parent = m_nodes[leaf].parent;
+	const int32_t grandParent = m_nodes[parent].parent;
+	const int32_t sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+	if (grandParent == NULL_NODE)
+	{
+		m_root = sibling;
+		m_nodes[sibling].parent = NULL_NODE;
+		FreeNode(parent);
+		return;
+	}
+
+	if (m_nodes[grandParent].child1 == parent) m_nodes[grandParent].child1 = sibling;
+	else m_nodes[grandParent].child2 = sibling;
+	m_nodes[sibling].parent = grandParent;
+	FreeNode(parent);
+
+	for (int32_t index = grandParent; index != NULL_NODE; index = m_nodes[index].parent)
+	{
+		index = Balance(index);
+
+		Node& node = m_nodes[index];
+		node.height = 1 + max(m_nodes[node.child1].height, m_nodes[node.child2].height);
+		node.bounds = AABB::Merge(m_nodes[node.child1].bounds, m_nodes[node.child2].bounds);
+		node.categoryBits = m_nodes[node.child1].categoryBits | m_nodes[node.child2].categoryBits;
+	}
+}
+
+int32_t DynamicAABBTree::Balance(int32_t a)
+{
+	if (m_nodes[a].IsLeaf() || m_nodes[a].height < 2) return a;
+
+	const int32_t b = m_nodes[a].child1;
+	const int32_t c = m_nodes[a].child2;
+	const int32_t balance = m_nodes[c].height - m_nodes[b].height;
+
+	// 높은 쪽 자식(up)을 a 자리로 올리고, up의 자식 중 높은 쪽은 up에 남기고 낮은 쪽을 a로 내림
+	const auto rotate = [&](int32_t up, int32_t other, bool isUpChild2)
+		{
+			const int32_t f = m_nodes[up].child1;
+			const int32_t g = m_nodes[up].child2;
+
+			m_nodes[up].child1 = a;
+			m_nodes[up].parent = m_nodes[a].parent;
+			m_nodes[a].parent = up;
+
+			if (m_nodes[up].parent == NULL_NODE) m_root = up;
+			else if (m_nodes[m_nodes[up].parent].child1 == a) m_nodes[m_nodes[up].parent].child1 = up;
+			else m_nodes[m_nodes[up].parent].child2 = up;
+
+			const bool isFHigher = m_nodes[f].height > m_nodes[g].height;
+			const int32_t kept = isFHigher ? f : g;
+			const int32_t moved = isFHigher ? g : f;
+
+			m_nodes[up].child2 = kept;
+			if (isUpChild2) m_nodes[a].child2 = moved;
+			else m_nodes[a].child1 = moved;
+			m_nodes[moved].parent = a;
+
+			m_nodes[a].bounds = AABB::Merge(m_nodes[other].bounds, m_nodes[moved].bounds);
+			m_nodes[a].height = 1 + max(m_nodes[other].height, m_nodes[moved].height);
+			m_nodes[a].categoryBits = m_nodes[other].categoryBits | m_nodes[moved].categoryBits;
+			m_nodes[up].bounds = AABB::Merge(m_nodes[a].bounds, m_nodes[kept].bounds);
+			m_nodes[up].height = 1 + max(m_nodes[a].height, m_nodes[kept].height);
+			m_nodes[up].categoryBits = m_nodes[a].categoryBits | m_nodes[kept].categoryBits;
+
+			return up;
+		};
+
+	if (balance > 1) return rotate(c, b, true);
+	if (balance < -1) return rotate(b, c, false);
+
+	return a;
+}
+
+bool DynamicAABBTree::IntersectsRay(const AABB& bounds, const XMFLOAT3& origin, const XMFLOAT3& inverseDirection, float maxDistance, _Out_ float& entryDistance)
+{
+	float tMin = 0.0f;
+	float tMax = maxDistance;
+
+	const array<pair<float, float>, 3> slabs =
+	{
+		pair{ bounds.minimum.x, bounds.maximum.x },
+		pair{ bounds.minimum.y, bounds.maximum.y },
+		pair{ bounds.minimum.z, bounds.maximum.z }
+	};
+	const array<float, 3> origins = { origin.x, origin.y, origin.z };
+	const array<float, 3> inverses = { inverseDirection.x, inverseDirection.y, inverseDirection.z };
+
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		const auto& [slabMin, slabMax] = slabs[axis];
+
+		// 축과 평행한 선 // 평판 밖이면 교차 없음
+		if (isinf(inverses[axis]))
+		{
+			if (origins[axis] < slabMin || origins[axis] > slabMax) return false;
+			continue;
+		}
+
+		float t1 = (slabMin - origins[axis]) * inverses[axis];
+		float t2 = (slabMax - origins[axis]) * inverses[axis];
+		if (t1 > t2) swap(t1, t2);
+
+		tMin = max(tMin, t1);
+		tMax = min(tMax, t2);
+		if (tMin > tMax) return false;
+	}
+
+	entryDistance = tMin;
+	return true;
+}
+
+void DynamicAABBTree::RunMicrobenchmarks()
+{
+	cout << "[콜라이더 브로드페이즈 마이크로벤치마크] 전수 검사 대비 동적 AABB 트리" << endl;
+
+	constexpr size_t QUERY_COUNT = 1000;
+	constexpr float WORLD_HALF_SIZE = 100.0f;
+
+	for (const size_t proxyCount : { 100, 1000, 10000 })
+	{
+		// 같은 씨드로 매번 같은 배치 // 적 크기 상자를 평면 위에 흩뿌림
+		mt19937 engine(MICROBENCHMARK_SEED);
+		uniform_real_distribution<float> position(-WORLD_HALF_SIZE, WORLD_HALF_SIZE);
+		uniform_real_distribution<float> extent(0.3f, 1.0f);
+
+		vector<BoundingBox> boxes(proxyCount);
+		for (BoundingBox& box : boxes) box = BoundingBox({ position(engine), extent(engine), position(engine) }, { extent(engine), extent(engine), extent(engine) });
+
+		DynamicAABBTree tree;
+		vector<int32_t> proxyIds(proxyCount);
+		const double buildElapsed = MeasureMilliseconds([&]() { for (size_t i = 0; i < proxyCount; ++i) proxyIds[i] = tree.CreateProxy(boxes[i], &boxes[i]); });
+
+		// 상자 조회 // 근접 공격 판정 크기
+		vector<BoundingBox> queryBoxes(QUERY_COUNT);
+		for (BoundingBox& box : queryBoxes) box = BoundingBox({ position(engine), 1.0f, position(engine) }, { 2.0f, 2.0f, 2.0f });
+
+		size_t bruteForceHits = 0;
+		const double bruteForceBoxElapsed = MeasureMilliseconds([&]()
+			{
+				for (const BoundingBox& query : queryBoxes) for (const BoundingBox& box : boxes) if (query.Intersects(box)) bruteForceHits++;
+			});
+		size_t treeHits = 0;
+		const double treeBoxElapsed = MeasureMilliseconds([&]()
+			{
+				for (const BoundingBox& query : queryBoxes)
+				{
+					tree.Query(query, [&](int32_t proxyId)
+						{
+							if (query.Intersects(*static_cast<const BoundingBox*>(tree.GetUserData(proxyId)))) treeHits++;
+							return true;
+						});
+				}
+			});
+		if (bruteForceHits != treeHits) cerr << "상자 조회 결과 불일치: 전수 " << bruteForceHits << ", 트리 " << treeHits << endl;
+
+		// 가장 가까운 선 충돌 // 사격 판정
+		vector<pair<XMVECTOR, XMVECTOR>> rays(QUERY_COUNT);
+		for (auto& [origin, direction] : rays)
+		{
+			origin = XMVectorSet(position(engine), 1.0f, position(engine), 0.0f);
+			direction = XMVector3Normalize(XMVectorSet(position(engine), 0.0f, position(engine), 0.0f));
+		}
+
+		double bruteForceClosestSum = 0.0;
+		const double bruteForceRayElapsed = MeasureMilliseconds([&]()
+			{
+				for (const auto& [origin, direction] : rays)
+				{
+					float closestDistance = numeric_limits<float>::max();
+					for (const BoundingBox& box : boxes)
+					{
+						float distance = 0.0f;
+						if (box.Intersects(origin, direction, distance)) closestDistance = min(closestDistance, distance);
+					}
+					if (closestDistance < numeric_limits<float>::max()) bruteForceClosestSum += closestDistance;
+				}
+			});
+		double treeClosestSum = 0.0;
+		const double treeRayElapsed = MeasureMilliseconds([&]()
+			{
+				for (const auto& [origin, direction] : rays)
+				{
+					float closestDistance = numeric_limits<float>::max();
+					tree.Raycast(origin, direction, closestDistance, [&](int32_t proxyId, float maxDistance)
+						{
+							float distance = 0.0f;
+							if (static_cast<const BoundingBox*>(tree.GetUserData(proxyId))->Intersects(origin, direction, distance) && distance < maxDistance)
+							{
+								closestDistance = distance;
+								return distance;
+							}
+							return maxDistance;
+						});
+					if (closestDistance < numeric_limits<float>::max()) treeClosestSum += closestDistance;
+				}
+			});
+		if (abs(bruteForceClosestSum - treeClosestSum) > 0.01 * max(1.0, bruteForceClosestSum)) cerr << "선 조회 결과 불일치: 전수 " << bruteForceClosestSum << ", 트리 " << treeClosestSum << endl;
+
+		// 광선 4개씩 묶어 트리를 함께 내려감
+		double treePacketClosestSum = 0.0;
+		const double treePacketRayElapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t first = 0; first < rays.size(); first += RAY_PACKET_WIDTH)
+				{
+					const size_t count = min(RAY_PACKET_WIDTH, rays.size() - first);
+
+					array<Ray, RAY_PACKET_WIDTH> packetRays = {};
+					for (size_t lane = 0; lane < count; ++lane) packetRays[lane] = { .origin = rays[first + lane].first, .direction = rays[first + lane].second };
+
+					RayPacket packet = RayPacket::Load(span<const Ray>(packetRays.data(), count));
+					array<float, RAY_PACKET_WIDTH> closestDistances = {};
+					closestDistances.fill(numeric_limits<float>::max());
+					tree.RaycastPacket(packet, [&](int32_t proxyId, uint32_t laneMask)
+						{
+							const BoundingBox& box = *static_cast<const BoundingBox*>(tree.GetUserData(proxyId));
+							for (; laneMask != 0; laneMask &= laneMask - 1)
+							{
+								const size_t lane = static_cast<size_t>(countr_zero(laneMask));
+								float distance = 0.0f;
+								if (box.Intersects(packetRays[lane].origin, packetRays[lane].direction, distance) && distance < closestDistances[lane])
+								{
+									closestDistances[lane] = distance;
+									packet.maxDistance = XMVectorSetByIndex(packet.maxDistance, distance, lane);
+								}
+							}
+						});
+
+					for (size_t lane = 0; lane < count; ++lane) if (closestDistances[lane] < numeric_limits<float>::max()) treePacketClosestSum += closestDistances[lane];
+				}
+			});
+		if (abs(bruteForceClosestSum - treePacketClosestSum) > 0.01 * max(1.0, bruteForceClosestSum)) cerr << "선 묶음 조회 결과 불일치: 전수 " << bruteForceClosestSum << ", 트리 " << treePacketClosestSum << endl;
+
+		// 절두체 조회 // 데드아이 화면 안 적 검색
+		const XMMATRIX projection = XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 50.0f);
+		vector<BoundingFrustum> frustums(QUERY_COUNT / 10);
+		for (BoundingFrustum& frustum : frustums)
+		{
+			BoundingFrustum localFrustum(projection);
+			const XMMATRIX world = XMMatrixRotationY(position(engine)) * XMMatrixTranslation(position(engine), 1.0f, position(engine));
+			localFrustum.Transform(frustum, world);
+		}
+
+		bruteForceHits = 0;
+		const double bruteForceFrustumElapsed = MeasureMilliseconds([&]()
+			{
+				for (const BoundingFrustum& frustum : frustums) for (const BoundingBox& box : boxes) if (frustum.Intersects(box)) bruteForceHits++;
+			});
+		treeHits = 0;
+		const double treeFrustumElapsed = MeasureMilliseconds([&]()
+			{
+				for (const BoundingFrustum& frustum : frustums)
+				{
+					tree.Query(frustum, [&](int32_t proxyId)
+						{
+							if (frustum.Intersects(*static_cast<const BoundingBox*>(tree.GetUserData(proxyId)))) treeHits++;
+							return true;
+						});
+				}
+			});
+		if (bruteForceHits != treeHits) cerr << "절두체 조회 결과 불일치: 전수 " << bruteForceHits << ", 트리 " << treeHits << endl;
+
+		// 한 프레임 이동 갱신 // 적 이동 속도로 모든 상자를 옮김
+		const size_t reinsertCount = tree.GetReinsertCount();
+		const double moveElapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t i = 0; i < proxyCount; ++i)
+				{
+					boxes[i].Center.x += 0.05f;
+					tree.MoveProxy(proxyIds[i], boxes[i]);
+				}
+			});
+
+		const auto perQuery = [](double elapsed, size_t count) { return elapsed * 1000.0 / static_cast<double>(count); };
+		cout << "콜라이더 " << proxyCount << "개 (트리 높이 " << tree.GetHeight() << ", 생성 " << buildElapsed << " ms)" << endl;
+		cout << "  상자: 전수 " << perQuery(bruteForceBoxElapsed, queryBoxes.size()) << " us, 트리 " << perQuery(treeBoxElapsed, queryBoxes.size()) << " us (" << bruteForceBoxElapsed / treeBoxElapsed << "배)" << endl;
+		cout << "  선: 전수 " << perQuery(bruteForceRayElapsed, rays.size()) << " us, 트리 " << perQuery(treeRayElapsed, rays.size()) << " us (" << bruteForceRayElapsed / treeRayElapsed << "배)" << endl;
+		cout << "  선 묶음: 트리 " << perQuery(treePacketRayElapsed, rays.size()) << " us (광선 하나씩 대비 " << treeRayElapsed / treePacketRayElapsed << "배)" << endl;
+		cout << "  절두체: 전수 " << perQuery(bruteForceFrustumElapsed, frustums.size()) << " us, 트리 " << perQuery(treeFrustumElapsed, frustums.size()) << " us (" << bruteForceFrustumElapsed / treeFrustumElapsed << "배)" << endl;
+		cout << "  이동 갱신: " << moveElapsed << " ms, 다시 삽입 " << tree.GetReinsertCount() - reinsertCount << "개" << endl;
+	}
+
+	// 레벨 지오메트리가 대부분인 장면에서 적만 찾는 조회 // 조회 뒤 걸러내기와 분류 마스크로 하위 트리 건너뛰기 비교
+	{
+		constexpr size_t LEVEL_COUNT = 9000;
+		constexpr size_t ENEMY_COUNT = 1000;
+		constexpr uint32_t LEVEL_CATEGORY = 1 << 0;
+		constexpr uint32_t ENEMY_CATEGORY = 1 << 1;
+
+		mt19937 engine(MICROBENCHMARK_SEED);
+		uniform_real_distribution<float> position(-WORLD_HALF_SIZE, WORLD_HALF_SIZE);
+		uniform_real_distribution<float> extent(0.3f, 1.0f);
+		uniform_real_distribution<float> levelExtent(1.0f, 4.0f);
+
+		vector<pair<BoundingBox, uint32_t>> boxes(LEVEL_COUNT + ENEMY_COUNT);
+		for (size_t i = 0; i < boxes.size(); ++i)
+		{
+			if (i < LEVEL_COUNT) boxes[i] = { BoundingBox({ position(engine), levelExtent(engine), position(engine) }, { levelExtent(engine), levelExtent(engine), levelExtent(engine) }), LEVEL_CATEGORY };
+			else boxes[i] = { BoundingBox({ position(engine), extent(engine), position(engine) }, { extent(engine), extent(engine), extent(engine) }), ENEMY_CATEGORY };
+		}
+
+		DynamicAABBTree tree;
+		for (auto& [box, category] : boxes) tree.CreateProxy(box, &box, category);
+
+		vector<BoundingBox> queryBoxes(QUERY_COUNT);
+		for (BoundingBox& box : queryBoxes) box = BoundingBox({ position(engine), 1.0f, position(engine) }, { 8.0f, 4.0f, 8.0f });
+
+		const auto countEnemyHits = [&](uint32_t categoryMask, size_t& hits)
+			{
+				for (const BoundingBox& query : queryBoxes)
+				{
+					tree.Query(query, [&](int32_t proxyId)
+						{
+							const auto& [box, category] = *static_cast<const pair<BoundingBox, uint32_t>*>(tree.GetUserData(proxyId));
+							if (category == ENEMY_CATEGORY && query.Intersects(box)) hits++;
+							return true;
+						}, categoryMask);
+				}
+			};
+		size_t filteredHits = 0;
+		const double filteredElapsed = MeasureMilliseconds([&]() { countEnemyHits(ALL_CATEGORIES, filteredHits); });
+		size_t maskedHits = 0;
+		const double maskedElapsed = MeasureMilliseconds([&]() { countEnemyHits(ENEMY_CATEGORY, maskedHits); });
+		if (filteredHits != maskedHits) cerr << "분류 마스크 조회 결과 불일치: 걸러내기 " << filteredHits << ", 마스크 " << maskedHits << endl;
+
+		const auto perQuery = [](double elapsed, size_t count) { return elapsed * 1000.0 / static_cast<double>(count); };
+		cout << "레벨 " << LEVEL_COUNT << "개, 적 " << ENEMY_COUNT << "개에서 적 상자 조회: 조회 뒤 걸러내기 " << perQuery(filteredElapsed, queryBoxes.size()) << " us, 분류 마스크 " << perQuery(maskedElapsed, queryBoxes.size()) << " us (" << filteredElapsed / maskedElapsed << "배)" << endl;
+	}
+}
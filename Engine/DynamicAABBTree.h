@@ -0,0 +1,314 @@
+#pragma once
+#include "RayPacket.h"
+
+// 동적 AABB 트리 // 충돌 검사 브로드페이즈
+// 잎마다 실제 경계를 여유 거리만큼 넓힌 상자 저장 // 실제 경계가 넓힌 상자를 벗어날 때만 다시 삽입
+// 삽입 위치는 표면적 증가가 가장 작은 형제로 고르고, 회전으로 높이 균형 유지
+// 스레드 안전하지 않음 // 갱신과 조회를 동시에 하면 안 됨
+class DynamicAABBTree
+{
+public:
+	static constexpr int32_t NULL_NODE = -1;
+	static constexpr float DEFAULT_FAT_MARGIN = 0.2f; // 적 이동 속도 기준 5~6프레임마다 다시 삽입
+	static constexpr uint32_t ALL_CATEGORIES = 0xFFFFFFFF;
+
+	// 최소, 최대 모서리 상자 // 교차 검사가 BoundingBox보다 단순
+	struct AABB
+	{
+		DirectX::XMFLOAT3 minimum = {};
+		DirectX::XMFLOAT3 maximum = {};
+
+		static AABB FromBoundingBox(const DirectX::BoundingBox& box);
+		DirectX::BoundingBox ToBoundingBox() const;
+
+		bool Contains(const AABB& other) const;
+		bool Overlaps(const AABB& other) const;
+		float GetSurfaceArea() const;
+		static AABB Merge(const AABB& a, const AABB& b);
+	};
+
+private:
+	struct Node
+	{
+		AABB bounds = {}; // 잎이면 넓힌 상자
+		void* userData = nullptr;
+
+		int32_t parent = NULL_NODE; // 빈 노드면 다음 빈 노드
+		int32_t child1 = NULL_NODE;
+		int32_t child2 = NULL_NODE;
+		int32_t height = -1; // 잎 0 // 빈 노드 -1
+
+		uint32_t categoryBits = ALL_CATEGORIES; // 잎이면 프록시 분류 비트 // 내부 노드면 하위 잎 분류 비트 합 // 조회 마스크와 겹치지 않는 하위 트리는 건너뜀
+		uint32_t maskBits = ALL_CATEGORIES; // 잎만 사용 // 쌍 조회에서 상대로 받는 분류 비트
+
+		bool IsLeaf() const { return child1 == NULL_NODE; }
+	};
+
+	// 순회용 스택 // 균형 트리 높이는 잎 수의 로그에 비례하므로 대부분 내부 배열만 사용
+	class NodeStack
+	{
+		static constexpr size_t INLINE_CAPACITY = 128;
+
+		std::array<int32_t, INLINE_CAPACITY> m_inline;
+		std::vector<int32_t> m_overflow = {};
+		size_t m_size = 0;
+
+	public:
+		void Push(int32_t node)
+		{
+			if (m_size < INLINE_CAPACITY) m_inline[m_size] = node;
+			else m_overflow.push_back(node);
+			m_size++;
+		}
+		int32_t Pop()
+		{
+			m_size--;
+			if (m_size < INLINE_CAPACITY) return m_inline[m_size];
+
+			const int32_t node = m_overflow.back();
+			m_overflow.pop_back();
+			return node;
+		}
+		bool IsEmpty() const { return m_size == 0; }
+	};
+
+	std::vector<Node> m_nodes = {}; // 노드 풀 // 인덱스로 참조하므로 재할당돼도 무방
+	int32_t m_root = NULL_NODE;
+	int32_t m_freeList = NULL_NODE;
+	size_t m_proxyCount = 0;
+	float m_fatMargin = DEFAULT_FAT_MARGIN;
+
+	size_t m_reinsertCount = 0; // MoveProxy로 다시 삽입한 누적 횟수
+
+public:
+	explicit DynamicAABBTree(float fatMargin = DEFAULT_FAT_MARGIN) : m_fatMargin(fatMargin) {}
+	~DynamicAABBTree() = default;
+	DynamicAABBTree(const DynamicAABBTree&) = default;
+	DynamicAABBTree& operator=(const DynamicAABBTree&) = default;
+	DynamicAABBTree(DynamicAABBTree&&) = default;
+	DynamicAABBTree& operator=(DynamicAABBTree&&) = default;
+
+	// 프록시 생성 후 아이디 반환 // 아이디는 해제 전까지 유지
+	int32_t CreateProxy(const DirectX::BoundingBox& bounds, void* userData, uint32_t categoryBits = ALL_CATEGORIES, uint32_t maskBits = ALL_CATEGORIES);
+	void DestroyProxy(int32_t proxyId);
+	// 실제 경계 갱신 // 넓힌 상자 안이면 아무것도 안 함 // 다시 삽입했으면 true
+	bool MoveProxy(int32_t proxyId, const DirectX::BoundingBox& bounds);
+	// 분류, 마스크 비트 변경 후 조상 분류 비트 갱신
+	void SetFilter(int32_t proxyId, uint32_t categoryBits, uint32_t maskBits);
+
+	void* GetUserData(int32_t proxyId) const { return m_nodes[proxyId].userData; }
+	const AABB& GetFatBounds(int32_t proxyId) const { return m_nodes[proxyId].bounds; }
+
+	size_t GetProxyCount() const { return m_proxyCount; }
+	size_t GetReinsertCount() const { return m_reinsertCount; }
+	int32_t GetHeight() const { return m_root == NULL_NODE ? 0 : m_nodes[m_root].height; }
+
+	// 모든 프록시마다 callback(proxyId) 호출 // 순서 없음
+	template<typename F>
+	void ForEachProxy(F&& callback) const
+	{
+		for (int32_t proxyId = 0; proxyId < static_cast<int32_t>(m_nodes.size()); ++proxyId) if (m_nodes[proxyId].height == 0) callback(proxyId);
+	}
+
+	// 조회 // 분류 비트가 categoryMask와 겹치는 프록시만 대상
+	// 넓힌 상자가 겹치는 프록시마다 callback(proxyId) 호출 // false를 반환하면 중단
+	template<typename F>
+	void Query(const DirectX::BoundingBox& box, F&& callback, uint32_t categoryMask = ALL_CATEGORIES) const;
+	// 넓힌 상자가 절두체와 겹치는 프록시마다 callback(proxyId) 호출 // false를 반환하면 중단
+	template<typename F>
+	void Query(const DirectX::BoundingFrustum& frustum, F&& callback, uint32_t categoryMask = ALL_CATEGORIES) const;
+	// 선이 넓힌 상자를 maxDistance 안에서 지나는 프록시마다 callback(proxyId, maxDistance) 호출 // direction은 정규화된 방향
+	// callback은 새 최대 거리 반환 // 더 가까운 충돌을 찾으면 그 거리를 반환해 먼 노드를 건너뜀, 0 이하면 중단
+	template<typename F>
+	void Raycast(const DirectX::XMVECTOR& origin, const DirectX::XMVECTOR& direction, float maxDistance, F&& callback, uint32_t categoryMask = ALL_CATEGORIES) const;
+	// 광선 묶음 조회 // 노드마다 광선 4개를 한 번에 검사해 하나라도 지나면 내려감
+	// 넓힌 상자를 지나는 광선이 있는 잎마다 callback(proxyId, laneMask) 호출 // callback이 packet.maxDistance를 줄이면 그 광선은 먼 노드를 건너뜀
+	template<typename F>
+	void RaycastPacket(RayPacket& packet, F&& callback, uint32_t categoryMask = ALL_CATEGORIES) const;
+	// 넓힌 상자가 겹치는 프록시 쌍마다 callback(proxyIdA, proxyIdB) 호출 // 쌍마다 proxyIdA < proxyIdB로 한 번만 호출
+	// 서로의 마스크 비트가 상대 분류 비트와 겹치는 쌍만 대상
+	template<typename F>
+	void QueryPairs(F&& callback) const;
+
+	// 무작위 상자 100 ~ 10000개에 대해 전수 검사와 트리 조회 처리량 비교 결과를 콘솔에 출력
+	static void RunMicrobenchmarks();
+
+private:
+	int32_t AllocateNode();
+	void FreeNode(int32_t node);
+
+	void InsertLeaf(int32_t leaf);
+	void RemoveLeaf(int32_t leaf);
+	// node가 불균형하면 회전 후 새 하위 트리 루트 반환
+	int32_t Balance(int32_t node);
+
+	// 선분과 상자 교차 // 교차하면 진입 거리를 entryDistance에 기록
+	static bool IntersectsRay(const AABB& bounds, const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& inverseDirection, float maxDistance, _Out_ float& entryDistance);
+};
+
+template<typename F>
+void DynamicAABBTree::Query(const DirectX::BoundingBox& box, F&& callback, uint32_t categoryMask) const
+{
+	if (m_root == NULL_NODE) return;
+
+	const AABB queryBounds = AABB::FromBoundingBox(box);
+
+	NodeStack stack;
+	stack.Push(m_root);
+	while (!stack.IsEmpty())
+	{
+		const int32_t nodeId = stack.Pop();
+		const Node& node = m_nodes[nodeId];
+		if ((node.categoryBits & categoryMask) == 0 || !node.bounds.Overlaps(queryBounds)) continue;
+
+		if (node.IsLeaf())
+		{
+			if (!callback(nodeId)) return;
+			continue;
+		}
+
+		stack.Push(node.child1);
+		stack.Push(node.child2);
+	}
+}
+
+template<typename F>
+void DynamicAABBTree::QueryPairs(F&& callback) const
+{
+	if (m_root == NULL_NODE) return;
+
+	// 잎마다 자기 넓힌 상자로 트리를 조회 // 아이디가 더 큰 잎만 전달해 중복 제거
+	NodeStack stack;
+	for (int32_t leafId = 0; leafId < static_cast<int32_t>(m_nodes.size()); ++leafId)
+	{
+		const Node& leaf = m_nodes[leafId];
+		if (leaf.height != 0) continue;
+
+		stack.Push(m_root);
+		while (!stack.IsEmpty())
+		{
+			const int32_t nodeId = stack.Pop();
+			const Node& node = m_nodes[nodeId];
+			if ((node.categoryBits & leaf.maskBits) == 0 || !node.bounds.Overlaps(leaf.bounds)) continue;
+
+			if (node.IsLeaf())
+			{
+				if (nodeId > leafId && (node.maskBits & leaf.categoryBits) != 0) callback(leafId, nodeId);
+				continue;
+			}
+
+			stack.Push(node.child1);
+			stack.Push(node.child2);
+		}
+	}
+}
+
+template<typename F>
+void DynamicAABBTree::Query(const DirectX::BoundingFrustum& frustum, F&& callback, uint32_t categoryMask) const
+{
+	if (m_root == NULL_NODE) return;
+
+	NodeStack stack;
+	stack.Push(m_root);
+	while (!stack.IsEmpty())
+	{
+		const int32_t nodeId = stack.Pop();
+		const Node& node = m_nodes[nodeId];
+		if ((node.categoryBits & categoryMask) == 0) continue;
+
+		const DirectX::ContainmentType containment = frustum.Contains(node.bounds.ToBoundingBox());
+		if (containment == DirectX::DISJOINT) continue;
+
+		if (node.IsLeaf())
+		{
+			if (!callback(nodeId)) return;
+			continue;
+		}
+
+		// 완전히 포함된 하위 트리는 더 검사하지 않고 모든 잎 전달
+		if (containment == DirectX::CONTAINS)
+		{
+			NodeStack subtree;
+			subtree.Push(nodeId);
+			while (!subtree.IsEmpty())
+			{
+				const int32_t subtreeNodeId = subtree.Pop();
+				const Node& subtreeNode = m_nodes[subtreeNodeId];
+				if ((subtreeNode.categoryBits & categoryMask) == 0) continue;
+				if (subtreeNode.IsLeaf())
+				{
+					if (!callback(subtreeNodeId)) return;
+					continue;
+				}
+				subtree.Push(subtreeNode.child1);
+				subtree.Push(subtreeNode.child2);
+			}
+			continue;
+		}
+
+		stack.Push(node.child1);
+		stack.Push(node.child2);
+	}
+}
+
+template<typename F>
+void DynamicAABBTree::Raycast(const DirectX::XMVECTOR& origin, const DirectX::XMVECTOR& direction, float maxDistance, F&& callback, uint32_t categoryMask) const
+{
+	if (m_root == NULL_NODE) return;
+
+	DirectX::XMFLOAT3 rayOrigin = {};
+	DirectX::XMFLOAT3 inverseDirection = {};
+	DirectX::XMStoreFloat3(&rayOrigin, origin);
+	// 0 성분은 무한대가 되며 IntersectsRay에서 축과 평행한 선으로 처리
+	DirectX::XMStoreFloat3(&inverseDirection, DirectX::XMVectorReciprocal(direction));
+
+	NodeStack stack;
+	stack.Push(m_root);
+	while (!stack.IsEmpty())
+	{
+		const int32_t nodeId = stack.Pop();
+		const Node& node = m_nodes[nodeId];
+
+		if ((node.categoryBits & categoryMask) == 0) continue;
+
+		float entryDistance = 0.0f;
+		if (!IntersectsRay(node.bounds, rayOrigin, inverseDirection, maxDistance, entryDistance)) continue;
+
+		if (node.IsLeaf())
+		{
+			maxDistance = callback(nodeId, maxDistance);
+			if (maxDistance <= 0.0f) return;
+			continue;
+		}
+
+		stack.Push(node.child1);
+		stack.Push(node.child2);
+	}
+}
+
+template<typename F>
+void DynamicAABBTree::RaycastPacket(RayPacket& packet, F&& callback, uint32_t categoryMask) const
+{
+	if (m_root == NULL_NODE) return;
+
+	NodeStack stack;
+	stack.Push(m_root);
+	while (!stack.IsEmpty())
+	{
+		const int32_t nodeId = stack.Pop();
+		const Node& node = m_nodes[nodeId];
+		if ((node.categoryBits & categoryMask) == 0) continue;
+
+		const uint32_t laneMask = GetLaneMask(DirectX::XMVectorLess(packet.IntersectBox(node.bounds.minimum, node.bounds.maximum), DirectX::g_XMInfinity));
+		if (laneMask == 0) continue;
+
+		if (node.IsLeaf())
+		{
+			callback(nodeId, laneMask);
+			continue;
+		}
+
+		stack.Push(node.child1);
+		stack.Push(node.child2);
+	}
+}
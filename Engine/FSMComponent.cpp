@@ -38,15 +38,21 @@ json FSMComponent::Serialize()
 
 void FSMComponent::Deserialize(const json& jsonData)
 {
-	if (jsonData.contains("current_state"))
+	for (const auto& [key, value] : jsonData.items()) DeserializeField(key, value);
+}
+
+bool FSMComponent::DeserializeField(const string& key, const json& value)
+{
+	if (key == "current_state")
 	{
-		current_state_ = StringToState(jsonData["current_state"].get<string>());
+		current_state_ = StringToState(value.get<string>());
 	}
-
-	if (jsonData.contains("start_state"))
+	else if (key == "start_state")
 	{
-		start_state_ = StringToState(jsonData["start_state"].get<string>());
+		start_state_ = StringToState(value.get<string>());
 	}
+
+	return true;
 }
 
 ///EOF FSMComponent.cpp
\ No newline at end of file
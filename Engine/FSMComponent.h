@@ -38,6 +38,7 @@ protected:
 	#endif
 	nlohmann::json Serialize() override;
 	void Deserialize(const nlohmann::json& jsonData) override;
+	bool DeserializeField(const std::string& key, const nlohmann::json& value) override;
 
 	StateID current_state_ = 0; 
 	StateID start_state_ = 0;
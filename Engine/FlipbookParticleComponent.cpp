@@ -19,6 +19,20 @@ void FlipbookParticleComponent::Initialize()
 	ApplyFrameToUV();
 }
 
+void FlipbookParticleComponent::Reactivate()
+{
+	ParticleComponent::Reactivate();
+
+	m_accumulatedTime = 0.0f;
+	m_currentFrame = 0;
+	m_playing = auto_play_;
+	ClampFrame();
+
+	const int maxFrames = GetMaxFrames();
+	if (random_start_ && maxFrames > 0) m_currentFrame = RNG::GetInstance().Range(0, maxFrames - 1);
+	ApplyFrameToUV();
+}
+
 void FlipbookParticleComponent::Update()
 {
 	if (!m_playing) return;
@@ -33,6 +33,7 @@ protected:
 	#ifdef _DEBUG
 	void RenderImGui() override;
 	#endif
+	void Reactivate() override;
 
 	nlohmann::json Serialize() override;
 	void Deserialize(const nlohmann::json& jsonData) override;
@@ -0,0 +1,167 @@
+#include "stdafx.h"
+#include "FrameArena.h"
+
+#include "Telemetry.h"
+#include "MemoryTracker.h"
+#include "RenderCommand.h"
+#include "Microbenchmark.h"
+
+using namespace std;
+
+REGISTER_MICROBENCHMARK(FrameArena, FrameArena::RunMicrobenchmarks)
+
+FrameArena::FrameArena() :
+	m_buffer(make_unique<byte[]>(DEFAULT_CAPACITY)),
+	m_capacity(DEFAULT_CAPACITY)
+{
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment)
+{
+	const uintptr_t base = reinterpret_cast<uintptr_t>(m_buffer.get());
+
+	size_t offset = m_offset.load(memory_order_relaxed);
+	size_t alignedOffset = 0;
+	do
+	{
+		// 버퍼 시작 주소가 alignment보다 덜 정렬됐을 수 있으므로 주소 기준으로 정렬
+		alignedOffset = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+	} while (!m_offset.compare_exchange_weak(offset, alignedOffset + size, memory_order_relaxed));
+
+	if (alignedOffset + size <= m_capacity) return m_buffer.get() + alignedOffset;
+
+	return AllocateOverflow(size, alignment);
+}
+
+void FrameArena::Reset()
+{
+	const size_t usedBytes = min(m_offset.load(memory_order_relaxed), m_capacity);
+	m_lastFrameBytes = usedBytes + m_overflowBytes;
+	m_peakBytes = max(m_peakBytes, m_lastFrameBytes);
+
+	TELEMETRY_COUNT("FrameArena.Bytes", m_lastFrameBytes);
+	TELEMETRY_COUNT("FrameArena.OverflowBytes", m_overflowBytes);
+
+	// 용량을 넘었으면 다음 프레임부터 초과분까지 담도록 늘림
+	if (m_overflowBytes > 0)
+	{
+		m_capacity = bit_ceil(m_lastFrameBytes);
+		m_buffer = make_unique<byte[]>(m_capacity);
+
+		m_overflowBlocks.clear();
+		m_overflowBytes = 0;
+	}
+
+	m_offset.store(0, memory_order_relaxed);
+}
+
+void* FrameArena::AllocateOverflow(size_t size, size_t alignment)
+{
+	unique_ptr<byte[]> block = make_unique<byte[]>(size + alignment);
+
+	void* memory = block.get();
+	size_t space = size + alignment;
+	align(alignment, size, memory, space);
+
+	lock_guard<mutex> lock(m_overflowMutex);
+	m_overflowBlocks.push_back(move(block));
+	m_overflowBytes += size;
+
+	return memory;
+}
+
+void FrameArena::RunMicrobenchmarks()
+{
+	FrameArena& frameArena = GetInstance();
+
+	cout << "[프레임 아레나 마이크로벤치마크]" << endl;
+
+	constexpr size_t FRAME_COUNT = 100;
+	constexpr size_t COMMAND_COUNT = 1000;
+	constexpr size_t QUERY_COUNT = 100;
+	constexpr size_t QUERY_RESULT_COUNT = 32;
+
+	// 목록 용량은 프레임을 넘어 재사용하므로 첫 프레임은 빼고 측정 // 프레임당 힙 할당 횟수, 명령어 또는 질의당 시간
+	const auto measureFrames = [&](const auto& recordFrame) -> pair<double, double>
+		{
+			recordFrame();
+			frameArena.Reset();
+
+			const uint64_t allocationCount = MemoryTracker::GetTotalAllocationCount();
+			const chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+			for (size_t frame = 0; frame < FRAME_COUNT; ++frame)
+			{
+				recordFrame();
+				frameArena.Reset();
+			}
+			const double elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - startTime).count();
+
+			return { static_cast<double>(MemoryTracker::GetTotalAllocationCount() - allocationCount) / FRAME_COUNT, elapsed / FRAME_COUNT };
+		};
+
+	// 모델 컴포넌트 렌더 람다 크기의 캡처 // 포인터 몇 개와 행렬 하나
+	struct Capture
+	{
+		const void* owner = nullptr;
+		array<float, 16> world = {};
+		float alpha = 1.0f;
+	};
+	volatile float sink = 0.0f;
+
+	for (const bool isLargeCapture : { false, true })
+	{
+		// 작은 캡처는 참조 하나 // 큰 캡처는 std::function 내부 버퍼를 넘는 크기 // 프레임 아레나 초기화 전에 명령어를 소멸
+		vector<pair<float, function<void()>>> functionCommands = {};
+		const auto [functionAllocations, functionElapsed] = measureFrames([&]()
+			{
+				for (size_t i = 0; i < COMMAND_COUNT; ++i)
+				{
+					if (isLargeCapture) functionCommands.emplace_back(static_cast<float>(i), [capture = Capture{ .alpha = static_cast<float>(i) }, &sink]() { sink = sink + capture.alpha; });
+					else functionCommands.emplace_back(static_cast<float>(i), [&sink]() { sink = sink + 1.0f; });
+				}
+				for (auto& [depth, command] : functionCommands) command();
+				functionCommands.clear();
+			});
+
+		vector<pair<float, RenderCommand>> renderCommands = {};
+		const auto [commandAllocations, commandElapsed] = measureFrames([&]()
+			{
+				for (size_t i = 0; i < COMMAND_COUNT; ++i)
+				{
+					if (isLargeCapture) renderCommands.emplace_back(static_cast<float>(i), [capture = Capture{ .alpha = static_cast<float>(i) }, &sink]() { sink = sink + capture.alpha; });
+					else renderCommands.emplace_back(static_cast<float>(i), [&sink]() { sink = sink + 1.0f; });
+				}
+				for (auto& [depth, command] : renderCommands) command();
+				renderCommands.clear();
+			});
+
+		cout << "렌더 명령어 " << COMMAND_COUNT << "개, " << (isLargeCapture ? "캡처 " + to_string(sizeof(Capture)) + "바이트 이상" : string("참조 캡처")) << " | "
+			<< "std::function: " << functionAllocations << "회/프레임, " << functionElapsed / COMMAND_COUNT << " ns/명령어 | "
+			<< "RenderCommand: " << commandAllocations << "회/프레임, " << commandElapsed / COMMAND_COUNT << " ns/명령어" << endl;
+	}
+
+	// 절두체, 상자 질의 결과처럼 호출마다 새로 만드는 임시 배열
+	vector<const void*> source(QUERY_RESULT_COUNT, nullptr);
+	const auto [vectorAllocations, vectorElapsed] = measureFrames([&]()
+		{
+			for (size_t i = 0; i < QUERY_COUNT; ++i)
+			{
+				vector<const void*> result = {};
+				for (const void* value : source) result.push_back(value);
+				sink = sink + static_cast<float>(result.size());
+			}
+		});
+	const auto [frameVectorAllocations, frameVectorElapsed] = measureFrames([&]()
+		{
+			for (size_t i = 0; i < QUERY_COUNT; ++i)
+			{
+				FrameVector<const void*> result = {};
+				for (const void* value : source) result.push_back(value);
+				sink = sink + static_cast<float>(result.size());
+			}
+		});
+
+	cout << "질의 " << QUERY_COUNT << "회, 결과 " << QUERY_RESULT_COUNT << "개 | "
+		<< "std::vector: " << vectorAllocations << "회/프레임, " << vectorElapsed / QUERY_COUNT << " ns/질의 | "
+		<< "FrameVector: " << frameVectorAllocations << "회/프레임, " << frameVectorElapsed / QUERY_COUNT << " ns/질의" << endl;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+// 프레임 단위 선형 할당기
+// 할당은 포인터를 앞으로 미는 것뿐이고 개별 해제 없이 Renderer::EndFrame에서 한 번에 초기화 // 작업자 스레드에서도 할당 가능
+// 용량을 넘으면 힙 블록으로 대신 할당하고 다음 초기화 때 그만큼 용량을 늘림
+// 여기서 할당한 메모리는 그 프레임의 렌더링이 끝나면 무효 // 프레임을 넘겨 보관하면 안 됨
+class FrameArena : public Singleton<FrameArena>
+{
+	friend class Singleton<FrameArena>;
+
+public:
+	static constexpr size_t DEFAULT_CAPACITY = 1 << 20; // 초기 용량 // 1MB
+
+private:
+	std::unique_ptr<std::byte[]> m_buffer = nullptr;
+	size_t m_capacity = 0;
+	std::atomic<size_t> m_offset = 0; // 사용한 바이트 수 // 용량을 넘을 수 있음
+
+	std::mutex m_overflowMutex = {};
+	std::vector<std::unique_ptr<std::byte[]>> m_overflowBlocks = {}; // 용량 초과분 // 초기화 때 해제
+	size_t m_overflowBytes = 0;
+
+	size_t m_lastFrameBytes = 0; // 직전 프레임 사용량 // 초과분 포함
+	size_t m_peakBytes = 0; // 실행 중 최대 사용량
+
+public:
+	~FrameArena() = default;
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+	FrameArena(FrameArena&&) = delete;
+	FrameArena& operator=(FrameArena&&) = delete;
+
+	// alignment는 2의 거듭제곱
+	void* Allocate(size_t size, size_t alignment);
+	// 모든 할당 무효화 // 다른 스레드가 할당 중이 아닐 때 메인 스레드에서만 호출
+	void Reset();
+
+	size_t GetCapacity() const { return m_capacity; }
+	size_t GetLastFrameBytes() const { return m_lastFrameBytes; }
+	size_t GetPeakBytes() const { return m_peakBytes; }
+
+	// 렌더 명령어 기록과 임시 질의 결과를 std::function, std::vector와 비교해 프레임당 힙 할당 횟수와 시간을 콘솔에 출력
+	static void RunMicrobenchmarks();
+
+private:
+	FrameArena();
+
+	void* AllocateOverflow(size_t size, size_t alignment);
+};
+
+// 프레임 아레나 기반 STL 할당기 // 해제는 아무것도 안 함
+template<typename T>
+struct FrameAllocator
+{
+	using value_type = T;
+
+	FrameAllocator() = default;
+	template<typename U>
+	FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+	T* allocate(size_t count) { return static_cast<T*>(FrameArena::GetInstance().Allocate(count * sizeof(T), alignof(T))); }
+	void deallocate(T*, size_t) noexcept {}
+
+	template<typename U>
+	bool operator==(const FrameAllocator<U>&) const noexcept { return true; }
+};
+
+// 프레임 안에서만 쓰는 임시 컨테이너 // 함수 결과로 돌려줄 때는 호출한 쪽도 프레임을 넘겨 보관하지 않아야 함
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+template<typename Key, typename Value>
+using FrameUnorderedMap = std::unordered_map<Key, Value, std::hash<Key>, std::equal_to<Key>, FrameAllocator<std::pair<const Key, Value>>>;
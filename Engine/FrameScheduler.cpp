@@ -0,0 +1,194 @@
+#include "stdafx.h"
+#include "FrameScheduler.h"
+
+#include "GameObjectBase.h"
+#include "JobSystem.h"
+#include "Renderer.h"
+#include "Profiler.h"
+#include "Telemetry.h"
+
+using namespace std;
+
+namespace
+{
+	constexpr array<const char*, static_cast<size_t>(FramePhase::Count)> PHASE_NAMES = { "FixedUpdate", "Update", "Render" };
+}
+
+void FrameScheduler::Run(FramePhase phase, const vector<GameObjectBase*>& rootGameObjects)
+{
+	const size_t phaseIndex = static_cast<size_t>(phase);
+	PROFILE_SCOPE(PHASE_NAMES[phaseIndex]);
+
+	FrameSchedulerStats& stats = m_stats[phaseIndex];
+	stats = {};
+
+	// 배치 구성 // 루트 배열은 실행 중 활성 상태 변경으로 바뀔 수 있으므로 먼저 배치에 복사
+	m_batchCount = 0;
+
+	for (const FrameSystem& system : m_systems[phaseIndex]) GetBatch(system.access).systems.push_back(&system);
+	for (GameObjectBase* rootGameObject : rootGameObjects) GetBatch(rootGameObject->CollectFrameAccess(phase)).rootGameObjects.push_back(rootGameObject);
+
+	// 배치 순서대로 실행 // 배치 사이는 장벽
+	const bool canRunParallel = !m_isDeterministic && JobSystem::GetInstance().GetWorkerCount() > 0;
+	for (size_t i = 0; i < m_batchCount; ++i)
+	{
+		Batch& batch = m_batches[i];
+		const bool isParallel = canRunParallel && !batch.isSerial && batch.systems.size() + batch.rootGameObjects.size() > 1;
+
+		RunBatch(phase, batch, isParallel);
+
+		if (isParallel)
+		{
+			stats.parallelRootCount += batch.rootGameObjects.size();
+			stats.largestParallelBatchRootCount = max(stats.largestParallelBatchRootCount, batch.rootGameObjects.size());
+		}
+		else stats.serialRootCount += batch.rootGameObjects.size();
+	}
+	stats.batchCount = m_batchCount;
+
+	TELEMETRY_COUNT("FrameScheduler.ParallelRoots", stats.parallelRootCount);
+	TELEMETRY_COUNT("FrameScheduler.SerialRoots", stats.serialRootCount);
+}
+
+void FrameScheduler::AddSystem(FramePhase phase, const string& name, const FrameAccessSet& access, function<void()> function)
+{
+	m_systems[static_cast<size_t>(phase)].push_back({ name, access, move(function) });
+}
+
+void FrameScheduler::RemoveSystem(const string& name)
+{
+	for (vector<FrameSystem>& systems : m_systems) erase_if(systems, [&](const FrameSystem& system) { return system.name == name; });
+}
+
+void FrameScheduler::PrintStats() const
+{
+	cout << "[프레임 스케줄러] 마지막 프레임 기준" << (m_isDeterministic ? " (결정적 모드)" : "") << endl;
+	for (size_t i = 0; i < PHASE_NAMES.size(); ++i)
+	{
+		const FrameSchedulerStats& stats = m_stats[i];
+		cout << PHASE_NAMES[i] << ": 배치 " << stats.batchCount << "개, 병렬 루트 " << stats.parallelRootCount << "개 (가장 큰 배치 " << stats.largestParallelBatchRootCount << "개), 단독 루트 " << stats.serialRootCount << "개" << endl;
+	}
+}
+
+#ifdef _DEBUG
+void FrameScheduler::RenderImGui()
+{
+	ImGui::Separator();
+	ImGui::Text("[Frame Scheduler]");
+
+	ImGui::Checkbox("Deterministic", &m_isDeterministic);
+
+	if (ImGui::BeginTable("FrameScheduler", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+	{
+		ImGui::TableSetupColumn("Phase");
+		ImGui::TableSetupColumn("Batches");
+		ImGui::TableSetupColumn("Parallel");
+		ImGui::TableSetupColumn("Serial");
+		ImGui::TableSetupColumn("Largest");
+		ImGui::TableHeadersRow();
+
+		for (size_t i = 0; i < PHASE_NAMES.size(); ++i)
+		{
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::Text("%s", PHASE_NAMES[i]);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", m_stats[i].batchCount);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", m_stats[i].parallelRootCount);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", m_stats[i].serialRootCount);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", m_stats[i].largestParallelBatchRootCount);
+		}
+
+		ImGui::EndTable();
+	}
+}
+#endif
+
+FrameScheduler::Batch& FrameScheduler::GetBatch(const FrameAccessSet& access)
+{
+	const bool isSerial = access.IsExclusive();
+
+	// 단독 실행은 모든 배치와 충돌하므로 마지막 배치가 단독 배치일 때만 합침
+	// 그 외에는 충돌하는 마지막 배치 바로 다음 배치에 넣어 충돌하는 항목끼리의 순서 유지
+	size_t batchIndex = m_batchCount;
+	if (isSerial)
+	{
+		if (m_batchCount > 0 && m_batches[m_batchCount - 1].isSerial) batchIndex = m_batchCount - 1;
+	}
+	else
+	{
+		batchIndex = 0;
+		for (size_t i = m_batchCount; i > 0; --i)
+		{
+			const Batch& batch = m_batches[i - 1];
+			if (batch.isSerial || batch.access.ConflictsWith(access))
+			{
+				batchIndex = i;
+				break;
+			}
+		}
+	}
+
+	if (batchIndex == m_batchCount)
+	{
+		if (m_batchCount == m_batches.size()) m_batches.emplace_back();
+
+		Batch& batch = m_batches[m_batchCount++];
+		batch.access = {};
+		batch.isSerial = isSerial;
+		batch.systems.clear();
+		batch.rootGameObjects.clear();
+	}
+
+	Batch& batch = m_batches[batchIndex];
+	batch.access |= access;
+
+	return batch;
+}
+
+void FrameScheduler::RunBatch(FramePhase phase, Batch& batch, bool isParallel)
+{
+	const size_t systemCount = batch.systems.size();
+	const auto runTask = [&](size_t index)
+		{
+			if (index < systemCount)
+			{
+				batch.systems[index]->function();
+				return;
+			}
+
+			// 앞 배치에서 비활성화된 루트는 건너뜀
+			Base* rootGameObject = batch.rootGameObjects[index - systemCount];
+			if (!rootGameObject->GetActive()) return;
+
+			switch (phase)
+			{
+			case FramePhase::FixedUpdate:
+				rootGameObject->BaseFixedUpdate();
+				break;
+
+			case FramePhase::Update:
+				rootGameObject->BaseUpdate();
+				break;
+
+			case FramePhase::Render:
+				rootGameObject->BaseRender();
+				break;
+			}
+		};
+
+	PROFILE_SCOPE(isParallel ? "ParallelBatch" : "SerialBatch");
+
+	const size_t taskCount = systemCount + batch.rootGameObjects.size();
+	if (!isParallel)
+	{
+		for (size_t i = 0; i < taskCount; ++i) runTask(i);
+		return;
+	}
+
+	JobSystem& jobSystem = JobSystem::GetInstance();
+	Renderer& renderer = Renderer::GetInstance();
+
+	// 렌더 함수는 작업자별 목록에 기록한 뒤 배치가 끝나면 병합
+	if (phase == FramePhase::Render) renderer.BeginParallelRecording(jobSystem.GetWorkerCount());
+	jobSystem.ParallelFor(taskCount, 0, runTask);
+	if (phase == FramePhase::Render) renderer.EndParallelRecording();
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+class GameObjectBase;
+
+// 프레임 단계 // 단계 사이에는 항상 장벽이 있음
+enum class FramePhase
+{
+	FixedUpdate,
+	Update,
+	Render,
+
+	Count
+};
+
+// 루트 하위 트리가 자기 하위 트리 밖에서 읽거나 쓰는 공유 자원
+// 하위 트리 안의 변환, 컴포넌트 상태는 적지 않음 // 렌더 함수 목록은 작업자별로 기록 후 병합하므로 적지 않음
+// 같은 종류의 자기 데이터만 갱신하는 루트끼리 쓰기로 충돌하지 않도록, 공유 구조 갱신은 단계 중에 하지 않고 모아 두었다가 단계가 끝난 뒤 한 번에 반영
+// 예) 콜라이더 월드 경계, 브로드페이즈 이동은 ColliderComponent::RefreshMovedWorldShapes, 예약 이동과 적 분리 격자는 CharacterControllerComponent::ResolveQueuedMoves
+enum class FrameAccess : uint32_t
+{
+	None = 0,
+	Transform = 1 << 0, // 다른 하위 트리가 읽는 게임 오브젝트 변환 // 자기 변환이라도 다른 하위 트리가 읽으면 쓰기
+	Collider = 1 << 1, // 콜라이더 월드 경계 및 브로드페이즈 // 경계는 단계가 끝난 뒤 갱신하므로 단계 중 쓰기는 콜라이더 등록, 해제뿐
+	Animation = 1 << 2, // 공유 애니메이션 데이터
+	Audio = 1 << 3, // 사운드 매니저
+	Camera = 1 << 4, // 카메라 행렬 및 메인 카메라
+	Navigation = 1 << 5, // 네비게이션 매니저
+	Scene = 1 << 6, // 씬 구조 // 게임 오브젝트 생성, 루트 활성화 변경 등
+	Gameplay = 1 << 7, // 다른 하위 트리나 게임 쪽 전역 게임플레이 상태 // 플레이어 체력, 적 상태, 적 분리 격자 등
+
+	All = 0xFFFFFFFF
+};
+constexpr FrameAccess operator|(FrameAccess a, FrameAccess b) { return static_cast<FrameAccess>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b)); }
+constexpr FrameAccess operator&(FrameAccess a, FrameAccess b) { return static_cast<FrameAccess>(static_cast<uint32_t>(a) & static_cast<uint32_t>(b)); }
+
+// 읽기, 쓰기 집합 // 한쪽의 쓰기가 다른 쪽의 읽기나 쓰기와 겹치면 같은 배치에서 실행하지 않음
+struct FrameAccessSet
+{
+	FrameAccess read = FrameAccess::None;
+	FrameAccess write = FrameAccess::None;
+
+	// 선언하지 않은 파생 클래스용 // 모든 자원을 쓰는 것으로 보고 단독 실행
+	static constexpr FrameAccessSet Exclusive() { return { FrameAccess::All, FrameAccess::All }; }
+
+	bool IsExclusive() const { return write == FrameAccess::All; }
+	bool ConflictsWith(const FrameAccessSet& other) const
+	{
+		return (write & (other.read | other.write)) != FrameAccess::None || (other.write & read) != FrameAccess::None;
+	}
+
+	FrameAccessSet& operator|=(const FrameAccessSet& other)
+	{
+		read = read | other.read;
+		write = write | other.write;
+		return *this;
+	}
+};
+
+// 게임 오브젝트에 속하지 않는 단계별 시스템 // 루트 하위 트리와 같은 규칙으로 배치에 들어감
+struct FrameSystem
+{
+	std::string name = {}; // 시스템 이름 // 제거 시 사용
+	FrameAccessSet access = {}; // 접근 집합
+	std::function<void()> function = nullptr; // 실행 함수
+};
+
+struct FrameSchedulerStats
+{
+	size_t batchCount = 0; // 배치 수
+	size_t parallelRootCount = 0; // 병렬 배치에서 실행한 루트 수
+	size_t serialRootCount = 0; // 단독 실행한 루트 수
+	size_t largestParallelBatchRootCount = 0; // 병렬 배치 중 가장 많은 루트 수
+};
+
+// 단계별로 루트 게임 오브젝트를 접근 집합이 겹치지 않는 배치로 묶어 실행
+// 배치 안의 루트 하위 트리는 작업 시스템으로 병렬 실행하고, 배치 사이에는 장벽을 둠
+// 접근 집합이 겹치는 루트끼리는 원래 순서를 유지 // 결정적 모드에서는 같은 배치 순서로 메인 스레드에서만 실행
+class FrameScheduler : public Singleton<FrameScheduler>
+{
+	friend class Singleton<FrameScheduler>;
+
+	struct Batch
+	{
+		FrameAccessSet access = {}; // 배치에 속한 루트들의 접근 집합 합
+		bool isSerial = false; // 단독 실행 루트만 담은 배치 여부 // 모든 배치와 충돌
+		std::vector<const FrameSystem*> systems = {};
+		std::vector<GameObjectBase*> rootGameObjects = {};
+	};
+
+	std::array<std::vector<FrameSystem>, static_cast<size_t>(FramePhase::Count)> m_systems = {}; // 단계별 시스템 배열 // 루트보다 먼저 배치
+
+	std::vector<Batch> m_batches = {}; // 배치 배열 // 용량 재사용
+	size_t m_batchCount = 0; // 이번 단계에서 사용 중인 배치 수
+
+	bool m_isDeterministic = false; // 결정적(단일 스레드) 실행 여부 // 디버깅용
+	std::array<FrameSchedulerStats, static_cast<size_t>(FramePhase::Count)> m_stats = {}; // 단계별 마지막 실행 통계
+
+public:
+	~FrameScheduler() = default;
+	FrameScheduler(const FrameScheduler&) = delete;
+	FrameScheduler& operator=(const FrameScheduler&) = delete;
+	FrameScheduler(FrameScheduler&&) = delete;
+	FrameScheduler& operator=(FrameScheduler&&) = delete;
+
+	// 시스템 및 루트 게임 오브젝트 하위 트리의 단계 실행 // 모두 끝나야 반환
+	void Run(FramePhase phase, const std::vector<GameObjectBase*>& rootGameObjects);
+
+	// 시스템 등록, 제거 // 단계 실행 중에는 호출하지 않음
+	void AddSystem(FramePhase phase, const std::string& name, const FrameAccessSet& access, std::function<void()> function);
+	void RemoveSystem(const std::string& name);
+
+	void SetDeterministic(bool isDeterministic) { m_isDeterministic = isDeterministic; }
+	bool IsDeterministic() const { return m_isDeterministic; }
+	const FrameSchedulerStats& GetStats(FramePhase phase) const { return m_stats[static_cast<size_t>(phase)]; }
+	// 단계별 마지막 실행의 배치 수, 병렬, 단독 루트 수를 콘솔에 출력
+	void PrintStats() const;
+
+	#ifdef _DEBUG
+	void RenderImGui();
+	#endif
+
+private:
+	FrameScheduler() = default;
+
+	// 접근 집합이 겹치는 마지막 배치 다음 배치 얻기 // 없으면 새로 추가
+	Batch& GetBatch(const FrameAccessSet& access);
+	// 배치의 시스템 및 루트 하위 트리 단계 실행
+	void RunBatch(FramePhase phase, Batch& batch, bool isParallel);
+};
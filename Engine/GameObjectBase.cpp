@@ -2,6 +2,12 @@
 #include "GameObjectBase.h"
 
 #include "SceneManager.h"
+#include "ObjectPoolManager.h"
+#include "BinarySerializer.h"
+#include "DestructionQueue.h"
+#include "Telemetry.h"
+#include "MemoryTracker.h"
+#include "FrameArena.h"
 
 using namespace std;
 using namespace DirectX;
@@ -12,8 +18,14 @@ GameObjectBase* GameObjectBase::s_selectedObject = nullptr;
 
 GameObjectBase::GameObjectBase()
 {
-	static UINT idIndex = 0;
-	m_id = idIndex++;
+	// 백그라운드 씬 로드에서도 생성되므로 원자적으로 증가
+	static atomic<UINT> idIndex = 0;
+	m_id = idIndex.fetch_add(1, memory_order_relaxed);
+}
+
+GameObjectBase::~GameObjectBase()
+{
+	if (m_destructionIndex != DestructionQueue::INVALID_INDEX) DestructionQueue::GetInstance().Cancel(this);
 }
 
 void GameObjectBase::MoveDirection(float distance, Direction direction)
@@ -104,6 +116,8 @@ XMVECTOR GameObjectBase::GetWorldDirectionVector(Direction direction)
 
 ComponentBase* GameObjectBase::CreateComponent(const string& typeName)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Scene);
+
 	unique_ptr<ComponentBase> component = TypeRegistry::GetInstance().CreateComponent(typeName);
 	ComponentBase* componentPtr = component.get();
 
@@ -127,32 +141,37 @@ ComponentBase* GameObjectBase::CreateComponent(const string& typeName)
 
 GameObjectBase* GameObjectBase::CreateChildGameObject(const string& typeName)
 {
-	unique_ptr<GameObjectBase> childGameObject = TypeRegistry::GetInstance().CreateGameObject(typeName);
-	GameObjectBase* childGameObjectPtr = childGameObject.get();
+	MEMORY_TAG_SCOPE(MemoryTag::Scene);
 
-	childGameObject->m_parent = this;
-	childGameObject->BaseInitialize();
-
-	m_childrens.push_back(move(childGameObject));
+	GameObjectBase* childGameObjectPtr = AttachChild(TypeRegistry::GetInstance().CreateGameObject(typeName));
+	childGameObjectPtr->BaseInitialize();
 
 	return childGameObjectPtr;
 }
 
 GameObjectBase* GameObjectBase::CreatePrefabChildGameObject(const string& prefabFileName)
 {
-	return CreateFromJson(*SceneManager::GetInstance().GetPrefabData(prefabFileName));
+	// 풀링 대상 프리팹이면 풀에서 꺼내서 사용
+	ObjectPoolManager& objectPoolManager = ObjectPoolManager::GetInstance();
+	if (objectPoolManager.IsPooled(prefabFileName))
+	{
+		return AttachChild(objectPoolManager.Acquire(prefabFileName, this));
+	}
+
+	GameObjectBase* childGameObjectPtr = CreateFromJson(*SceneManager::GetInstance().GetPrefabData(prefabFileName));
+	childGameObjectPtr->m_prefabFileName = prefabFileName;
+	TELEMETRY_COUNT("Scene.PrefabInstantiations", 1);
+
+	return childGameObjectPtr;
 }
 
 GameObjectBase* GameObjectBase::CreateFromJson(const nlohmann::json& jsonData)
 {
-	unique_ptr<GameObjectBase> childGameObject = TypeRegistry::GetInstance().CreateGameObject(jsonData["type"].get<string>());
-	GameObjectBase* childGameObjectPtr = childGameObject.get();
-
-	childGameObject->m_parent = this;
-	childGameObject->BaseDeserialize(jsonData);
-	childGameObject->BaseInitialize();
+	MEMORY_TAG_SCOPE(MemoryTag::Scene);
 
-	m_childrens.push_back(move(childGameObject));
+	GameObjectBase* childGameObjectPtr = AttachChild(TypeRegistry::GetInstance().CreateGameObject(jsonData["type"].get<string>()));
+	childGameObjectPtr->BaseDeserialize(jsonData);
+	childGameObjectPtr->BaseInitialize();
 
 	return childGameObjectPtr;
 }
@@ -179,6 +198,13 @@ void GameObjectBase::BaseInitialize()
 {
 	m_type = GetTypeName(*this);
 	if (m_name.empty()) m_name = m_type + "_" + to_string(m_id);
+	#if PROFILER_ENABLED
+	m_profileName = Profiler::GetInstance().InternName(m_type);
+	#endif
+	PROFILE_SCOPE(m_profileName);
+
+	// 일단 활성 상태로 초기화한 뒤 비활성이면 해제 // 컴포넌트는 초기화 시 전역 목록에 등록됨
+	m_isActiveInHierarchy = true;
 
 	#ifdef NDEBUG
 	Initialize();
@@ -187,10 +213,15 @@ void GameObjectBase::BaseInitialize()
 	// 컴포넌트와 자식 오브젝트 초기화
 	for (auto& [typeIndex, component] : m_components) static_cast<Base*>(component.get())->BaseInitialize();
 	for (auto& child : m_childrens) child->BaseInitialize();
+
+	m_isInitialized = true;
+	ApplyInitialActiveState();
 }
 
 void GameObjectBase::BaseFixedUpdate()
 {
+	PROFILE_SCOPE(m_profileName);
+
 	#ifdef NDEBUG
 	FixedUpdate();
 	#endif
@@ -198,18 +229,17 @@ void GameObjectBase::BaseFixedUpdate()
 	// 월드 행렬 업데이트
 	UpdateWorldMatrix();
 
-	// 제거할 컴포넌트 및 자식 게임 오브젝트 제거
-	RemovePending();
-
 	// 컴포넌트 고정 업데이트
-	for (Base*& component : m_fixedUpdateComponents) component->BaseFixedUpdate();
+	ForEachComponent(m_fixedUpdateComponents, [](Base* component) { component->BaseFixedUpdate(); });
 
-	// 자식 게임 오브젝트 고정 업데이트
-	for (auto& child : m_childrens) child->BaseFixedUpdate();
+	// 활성 자식 게임 오브젝트 고정 업데이트
+	ForEachActiveChild([](GameObjectBase* child) { child->BaseFixedUpdate(); });
 }
 
 void GameObjectBase::BaseUpdate()
 {
+	PROFILE_SCOPE(m_profileName);
+
 	#ifdef NDEBUG
 	Update();
 	#endif
@@ -217,28 +247,26 @@ void GameObjectBase::BaseUpdate()
 	// 월드 행렬 업데이트
 	UpdateWorldMatrix();
 
-	// 제거할 컴포넌트 및 자식 게임 오브젝트 제거
-	RemovePending();
-
 	// 컴포넌트 업데이트
-	for (Base*& component : m_updateComponents) component->BaseUpdate();
+	ForEachComponent(m_updateComponents, [](Base* component) { component->BaseUpdate(); });
 
-	// 제거할 자식 게임 오브젝트 제거;
-	// 자식 게임 오브젝트 업데이트
-	for (auto& child : m_childrens) child->BaseUpdate();
+	// 활성 자식 게임 오브젝트 업데이트
+	ForEachActiveChild([](GameObjectBase* child) { child->BaseUpdate(); });
 }
 
 void GameObjectBase::BaseRender()
 {
+	PROFILE_SCOPE(m_profileName);
+
 	#ifdef NDEBUG
 	Render();
 	#endif
 
 	// 컴포넌트 렌더링
-	for (Base*& component : m_renderComponents) component->BaseRender();
+	ForEachComponent(m_renderComponents, [](Base* component) { component->BaseRender(); });
 
-	// 자식 게임 오브젝트 렌더링
-	for (auto& child : m_childrens) child->BaseRender();
+	// 활성 자식 게임 오브젝트 렌더링
+	ForEachActiveChild([](GameObjectBase* child) { child->BaseRender(); });
 }
 
 #ifdef _DEBUG
@@ -252,6 +280,10 @@ void GameObjectBase::BaseRenderImGui()
 	if (ImGui::Button("Save As Prefab")) SaveAsPrefab();
 	ImGui::SameLine();
 
+	bool isActive = GetActive();
+	if (ImGui::Checkbox("##Active", &isActive)) SetActive(isActive);
+	ImGui::SameLine();
+
 	static array<char, 256> nameBuffer = {};
 	strcpy_s(nameBuffer.data(), nameBuffer.size(), m_name.c_str());
 	if (ImGui::InputText("", nameBuffer.data(), sizeof(nameBuffer))) m_name = nameBuffer.data();
@@ -274,6 +306,8 @@ void GameObjectBase::BaseRenderImGui()
 		};
 		// 크기
 		if (ImGui::DragFloat3("Scale", &m_scale.m128_f32[0], 0.01f)) SetDirty();
+		// 정적 여부 // 정적 오브젝트는 옮겨도 컴포넌트 월드 경계가 따라가지 않음
+		ImGui::Checkbox("Static", &m_isStatic);
 
 		RenderImGui();
 
@@ -349,6 +383,8 @@ void GameObjectBase::BaseRenderImGui()
 
 void GameObjectBase::BaseFinalize()
 {
+	PROFILE_SCOPE(m_profileName);
+
 	if (s_selectedObject == this) s_selectedObject = nullptr;
 
 	#ifdef NDEBUG
@@ -360,6 +396,171 @@ void GameObjectBase::BaseFinalize()
 
 	// 자식 게임 오브젝트 종료
 	for (auto& child : m_childrens) child->BaseFinalize();
+
+	m_isInitialized = false;
+	m_isActiveInHierarchy = false;
+}
+
+void GameObjectBase::BaseReset()
+{
+	PROFILE_SCOPE(m_profileName);
+
+	if (s_selectedObject == this) s_selectedObject = nullptr;
+
+	#ifdef NDEBUG
+	Reset();
+	#endif
+
+	// 컴포넌트 풀 반환 처리
+	for (auto& [typeIndex, component] : m_components) component->BaseReset();
+
+	// 자식 게임 오브젝트 풀 반환 처리
+	for (auto& child : m_childrens) child->BaseReset();
+
+	m_isInitialized = false;
+	m_isActiveInHierarchy = false;
+}
+
+void GameObjectBase::BaseReactivate()
+{
+	PROFILE_SCOPE(m_profileName);
+
+	SetAlive(true);
+	Base::SetActive(true);
+	m_isActiveInHierarchy = true;
+
+	// 사용 중 비활성화된 컴포넌트 다시 활성화 // 초기화 전이므로 목록만 복원
+	for (auto& [typeIndex, component] : m_components) component->SetActive(true);
+
+	#ifdef NDEBUG
+	Reactivate();
+	#endif
+
+	// 컴포넌트 재사용 처리
+	for (auto& [typeIndex, component] : m_components) component->BaseReactivate();
+
+	// 자식 게임 오브젝트 재사용 처리
+	for (auto& child : m_childrens) child->BaseReactivate();
+
+	m_isInitialized = true;
+	ApplyInitialActiveState();
+}
+
+void GameObjectBase::BaseEnable()
+{
+	PROFILE_SCOPE(m_profileName);
+
+	if (m_isActiveInHierarchy || !GetActive() || (m_parent && !m_parent->m_isActiveInHierarchy)) return;
+	m_isActiveInHierarchy = true;
+
+	#ifdef NDEBUG
+	OnEnable();
+	#endif
+
+	for (auto& [typeIndex, component] : m_components) if (component->GetActive()) component->BaseEnable();
+	ForEachActiveChild([](GameObjectBase* child) { child->BaseEnable(); });
+}
+
+void GameObjectBase::BaseDisable()
+{
+	PROFILE_SCOPE(m_profileName);
+
+	if (!m_isActiveInHierarchy) return;
+	m_isActiveInHierarchy = false;
+
+	#ifdef NDEBUG
+	OnDisable();
+	#endif
+
+	for (auto& [typeIndex, component] : m_components) if (component->GetActive()) component->BaseDisable();
+	ForEachActiveChild([](GameObjectBase* child) { child->BaseDisable(); });
+}
+
+void GameObjectBase::BaseCollision(CollisionEvent event, ColliderComponent* other)
+{
+	PROFILE_SCOPE(m_profileName);
+
+	#ifdef NDEBUG
+	DispatchCollision(event, other);
+	#endif
+
+	for (auto& [typeIndex, component] : m_components) if (component->GetActive()) component->BaseCollision(event, other);
+}
+
+void GameObjectBase::ApplyInitialActiveState()
+{
+	if (GetActive()) AddToActiveList();
+	else RemoveFromActiveList();
+
+	if (!GetActive() || (m_parent && !m_parent->m_isActiveInHierarchy)) BaseDisable();
+}
+
+void GameObjectBase::SetActive(bool isActive)
+{
+	if (GetActive() == isActive) return;
+
+	Base::SetActive(isActive);
+	if (isActive) AddToActiveList();
+	else RemoveFromActiveList();
+
+	// 초기화 전이면 초기화 시 처리
+	if (!m_isInitialized) return;
+
+	if (isActive) BaseEnable();
+	else BaseDisable();
+}
+
+void GameObjectBase::SetAlive(bool isAlive)
+{
+	if (GetAlive() == isAlive) return;
+
+	Base::SetAlive(isAlive);
+	if (isAlive) DestructionQueue::GetInstance().Cancel(this);
+	else DestructionQueue::GetInstance().Enqueue(this);
+}
+
+void GameObjectBase::RestoreFromPrefab(const nlohmann::json& jsonData)
+{
+	SetAlive(true);
+	DeserializeTransform(jsonData);
+	m_isActiveInHierarchy = true;
+
+	// 사용 중 비활성화된 컴포넌트 다시 활성화 // 초기화 전이므로 목록만 복원
+	for (auto& [typeIndex, component] : m_components) component->SetActive(true);
+
+	// 사용 중 제거된 컴포넌트 다시 생성 // 남아 있는 컴포넌트는 재사용
+	vector<Base*> recreatedComponents = {};
+	for (const auto& componentData : jsonData["components"])
+	{
+		const string typeName = componentData["type"].get<string>();
+		if (any_of(m_components.begin(), m_components.end(), [&](const auto& component) { return component.second->GetType() == typeName; })) continue;
+
+		if (ComponentBase* component = AddComponentFromJson(componentData)) recreatedComponents.push_back(component);
+	}
+
+	#ifdef NDEBUG
+	Reactivate();
+	#endif
+
+	for (auto& [typeIndex, component] : m_components)
+	{
+		if (find(recreatedComponents.begin(), recreatedComponents.end(), component.get()) != recreatedComponents.end()) component->BaseInitialize();
+		else component->BaseReactivate();
+	}
+
+	// 자식 게임 오브젝트는 이름으로 프리팹 데이터와 대응
+	for (auto& child : m_childrens)
+	{
+		auto it = find_if(jsonData["childGameObjects"].begin(), jsonData["childGameObjects"].end(), [&](const nlohmann::json& childData) { return childData.contains("name") && childData["name"].get<string>() == child->m_name; });
+
+		if (it != jsonData["childGameObjects"].end()) child->RestoreFromPrefab(*it);
+		else child->BaseReactivate();
+	}
+
+	SetDirty();
+
+	m_isInitialized = true;
+	ApplyInitialActiveState();
 }
 
 nlohmann::json GameObjectBase::BaseSerialize()
@@ -371,6 +572,8 @@ nlohmann::json GameObjectBase::BaseSerialize()
 
 	// 기본 게임 오브젝트 데이터 저장
 	jsonData["name"] = m_name;
+	if (!GetActive()) jsonData["active"] = false;
+	if (m_isStatic) jsonData["static"] = true;
 	jsonData["position"] = { m_position.m128_f32[0], m_position.m128_f32[1], m_position.m128_f32[2], m_position.m128_f32[3] };
 	jsonData["rotation"] = { m_quaternion.m128_f32[0], m_quaternion.m128_f32[1], m_quaternion.m128_f32[2], m_quaternion.m128_f32[3] };
 	jsonData["scale"] = { m_scale.m128_f32[0], m_scale.m128_f32[1], m_scale.m128_f32[2], m_scale.m128_f32[3] };
@@ -395,7 +598,32 @@ nlohmann::json GameObjectBase::BaseSerialize()
 void GameObjectBase::BaseDeserialize(const nlohmann::json& jsonData)
 {
 	// 기본 게임 오브젝트 데이터 로드
+	DeserializeTransform(jsonData);
+
+	// 파생 클래스의 데이터 로드
+	Deserialize(jsonData);
+
+	// 컴포넌트들 로드
+	for (const auto& componentData : jsonData["components"]) AddComponentFromJson(componentData);
+	
+	// 자식 게임 오브젝트들 로드
+	for (const auto& childData : jsonData["childGameObjects"])
+	{
+		string typeName = childData["type"].get<string>();
+		GameObjectBase* childGameObject = AttachChild(TypeRegistry::GetInstance().CreateGameObject(typeName));
+
+		childGameObject->BaseDeserialize(childData);
+	}
+
+	SetDirty();
+}
+
+void GameObjectBase::DeserializeTransform(const nlohmann::json& jsonData)
+{
 	if (jsonData.contains("name")) m_name = jsonData["name"].get<string>();
+	// 활성 목록, 활성화 처리는 초기화 또는 풀 재사용 시 반영
+	Base::SetActive(jsonData.value("active", true));
+	m_isStatic = jsonData.value("static", false);
 
 	if (jsonData.contains("position"))
 	{
@@ -428,40 +656,87 @@ void GameObjectBase::BaseDeserialize(const nlohmann::json& jsonData)
 			jsonData["scale"][3].get<float>()
 		);
 	}
+}
 
-	// 파생 클래스의 데이터 로드
-	Deserialize(jsonData);
+ComponentBase* GameObjectBase::AddComponentFromJson(const nlohmann::json& componentData)
+{
+	unique_ptr<ComponentBase> component = TypeRegistry::GetInstance().CreateComponent(componentData["type"].get<string>());
 
-	// 컴포넌트들 로드
-	for (const auto& componentData : jsonData["components"])
-	{
-		string typeName = componentData["type"].get<string>();
-		unique_ptr<ComponentBase> component = TypeRegistry::GetInstance().CreateComponent(typeName);
+	static_cast<Base*>(component.get())->BaseDeserialize(componentData);
 
-		if (m_components[type_index(typeid(*component))]) cerr << "오류: 게임 오브젝트 '" << m_name << "'에 이미 컴포넌트 '" << typeName << "'가 존재합니다." << endl;
+	return AttachComponent(move(component));
+}
 
-		component->SetOwner(this);
-		if (component->NeedsFixedUpdate()) m_fixedUpdateComponents.push_back(component.get());
-		if (component->NeedsUpdate()) m_updateComponents.push_back(component.get());
-		if (component->NeedsRender()) m_renderComponents.push_back(component.get());
+void GameObjectBase::OnComponentActiveChanged(ComponentBase* component)
+{
+	// 다른 컴포넌트의 업데이트 중에 바뀌면 순회 중인 목록을 건드리지 않도록 순회가 끝난 뒤 갱신
+	if (m_isIteratingComponents) m_pendingActiveChangedComponents.push_back(component);
+	else UpdateComponentLists(component);
 
-		Base* basePtr = static_cast<Base*>(component.get());
-		basePtr->BaseDeserialize(componentData);
-		m_components[type_index(typeid(*component))] = move(component);
-	}
-	
-	// 자식 게임 오브젝트들 로드
-	for (const auto& childData : jsonData["childGameObjects"])
-	{
-		string typeName = childData["type"].get<string>();
-		unique_ptr<GameObjectBase> childGameObject = TypeRegistry::GetInstance().CreateGameObject(typeName);
+	if (!m_isInitialized || !m_isActiveInHierarchy) return;
 
-		childGameObject->m_parent = this;
-		childGameObject->BaseDeserialize(childData);
-		m_childrens.push_back(move(childGameObject));
+	Base* componentPtr = component;
+	if (component->GetActive()) componentPtr->BaseEnable();
+	else componentPtr->BaseDisable();
+}
+
+GameObjectBase* GameObjectBase::AttachChild(unique_ptr<GameObjectBase> child)
+{
+	GameObjectBase* childPtr = child.get();
+
+	child->m_parent = this;
+	child->LinkActiveList(&m_activeChildrens);
+	m_childrens.push_back(move(child));
+
+	return childPtr;
+}
+
+void GameObjectBase::LinkActiveList(vector<GameObjectBase*>* activeList)
+{
+	RemoveFromActiveList();
+
+	m_activeList = activeList;
+	if (GetActive()) AddToActiveList();
+}
+
+void GameObjectBase::AddToActiveList()
+{
+	if (!m_activeList || m_activeIndex != INVALID_ACTIVE_INDEX) return;
+
+	m_activeIndex = m_activeList->size();
+	m_activeList->push_back(this);
+}
+
+void GameObjectBase::RemoveFromActiveList()
+{
+	if (!m_activeList || m_activeIndex == INVALID_ACTIVE_INDEX) return;
+
+	GameObjectBase* last = m_activeList->back();
+	(*m_activeList)[m_activeIndex] = last;
+	last->m_activeIndex = m_activeIndex;
+	m_activeList->pop_back();
+
+	m_activeIndex = INVALID_ACTIVE_INDEX;
+}
+
+ComponentBase* GameObjectBase::AttachComponent(unique_ptr<ComponentBase> component)
+{
+	ComponentBase* componentPtr = component.get();
+
+	if (m_components[type_index(typeid(*component))])
+	{
+		cerr << "오류: 게임 오브젝트 '" << m_name << "'에 이미 컴포넌트 '" << GetTypeName(*component) << "'가 존재합니다." << endl;
+		return nullptr;
 	}
 
-	SetDirty();
+	component->SetOwner(this);
+	if (component->NeedsFixedUpdate()) m_fixedUpdateComponents.push_back(componentPtr);
+	if (component->NeedsUpdate()) m_updateComponents.push_back(componentPtr);
+	if (component->NeedsRender()) m_renderComponents.push_back(componentPtr);
+
+	m_components[type_index(typeid(*component))] = move(component);
+
+	return componentPtr;
 }
 
 void GameObjectBase::SaveAsPrefab()
@@ -470,50 +745,85 @@ void GameObjectBase::SaveAsPrefab()
 
 	const filesystem::path prefabFilePath = "../Asset/Prefab/" + m_name + ".json";
 
-	ofstream prefabFile(prefabFilePath);
-	prefabFile << BaseSerialize().dump(4);
-	prefabFile.close();
+	if (!BinarySerializer::GetInstance().Save(BaseSerialize(), prefabFilePath)) return;
 
 	SceneManager::GetInstance().LoadAllPrefabs();
 
 	cout << "게임 오브젝트 '" << m_name << " 저장 완료!" << endl;
 }
 
-void GameObjectBase::RemovePending()
+void GameObjectBase::UpdateComponentLists(ComponentBase* component)
 {
-	// 제거할 자식 게임 오브젝트 제거
-	erase_if
-	(
-		m_childrens, [](const unique_ptr<GameObjectBase>& gameObject)
-		{
-			if (!gameObject->GetAlive())
-			{
-				gameObject->BaseFinalize();
-				return true;
-			}
-			return false;
-		}
-	);
-	// 제거할 컴포넌트 제거
-	erase_if
-	(
-		m_components, [&](const auto& component)
+	Base* componentPtr = component;
+	const auto updateList = [&](vector<Base*>& components, bool isNeeded)
 		{
-			if (!component.second->GetAlive())
-			{
-				component.second->BaseFinalize();
-				
-				// 업데이트 및 렌더링 목록에서 제거
-				ComponentBase* compBasePtr = dynamic_cast<ComponentBase*>(component.second.get());
-				if (compBasePtr->NeedsFixedUpdate()) erase_if(m_fixedUpdateComponents, [&](Base* fixedUpdateComponent) { return fixedUpdateComponent == compBasePtr; });
-				if (compBasePtr->NeedsUpdate()) erase_if(m_updateComponents, [&](Base* updateComponent) { return updateComponent == compBasePtr; });
-				if (compBasePtr->NeedsRender()) erase_if(m_renderComponents, [&](Base* renderComponent) { return renderComponent == compBasePtr; });
-
-				return true;
-			}
-			return false;
-		}
-	);
+			if (!isNeeded) return;
+
+			// 순회 중 여러 번 바뀌었을 수 있으므로 현재 상태 기준으로 한 번만 등록
+			erase(components, componentPtr);
+			if (component->GetActive()) components.push_back(componentPtr);
+		};
+	updateList(m_fixedUpdateComponents, component->NeedsFixedUpdate());
+	updateList(m_updateComponents, component->NeedsUpdate());
+	updateList(m_renderComponents, component->NeedsRender());
+}
+
+template<typename F>
+void GameObjectBase::ForEachComponent(vector<Base*>& components, F&& function)
+{
+	const bool wasIterating = m_isIteratingComponents;
+	m_isIteratingComponents = true;
+
+	// 앞선 컴포넌트가 비활성화한 컴포넌트는 목록에 남아 있어도 건너뜀
+	for (size_t i = 0; i < components.size(); ++i) if (components[i]->GetActive()) function(components[i]);
+
+	m_isIteratingComponents = wasIterating;
+	if (wasIterating) return;
+
+	for (ComponentBase* component : m_pendingActiveChangedComponents) UpdateComponentLists(component);
+	m_pendingActiveChangedComponents.clear();
+}
+
+template<typename F>
+void GameObjectBase::ForEachActiveChild(F&& function)
+{
+	if (m_activeChildrens.empty()) return;
+
+	// 비활성화는 마지막 원소를 빈 자리로 옮기므로 인덱스로 순회하면 옮겨진 자식을 건너뜀
+	const FrameVector<GameObjectBase*> children(m_activeChildrens.begin(), m_activeChildrens.end());
+	for (GameObjectBase* child : children) if (child->GetActive()) function(child);
+}
+
+void GameObjectBase::DestroyComponent(ComponentBase* component)
+{
+	auto it = m_components.find(type_index(typeid(*component)));
+	if (it == m_components.end() || it->second.get() != component) return;
+
+	Base* componentPtr = component;
+	componentPtr->BaseFinalize();
+
+	// 업데이트 및 렌더링 목록에서 제거
+	if (component->NeedsFixedUpdate()) erase(m_fixedUpdateComponents, componentPtr);
+	if (component->NeedsUpdate()) erase(m_updateComponents, componentPtr);
+	if (component->NeedsRender()) erase(m_renderComponents, componentPtr);
+
+	m_components.erase(it);
+}
+
+void GameObjectBase::DestroyDeadChildren()
+{
+	// 풀링 대상은 풀에 반환, 나머지는 종료 후 해제 // 종료 처리 중 자식이 추가될 수 있으므로 인덱스로 순회
+	ObjectPoolManager& objectPoolManager = ObjectPoolManager::GetInstance();
+	DestructionQueue& destructionQueue = DestructionQueue::GetInstance();
+	for (size_t i = 0; i < m_childrens.size(); ++i)
+	{
+		if (!m_childrens[i] || m_childrens[i]->GetAlive()) continue;
+
+		destructionQueue.Cancel(m_childrens[i].get());
+		objectPoolManager.Release(move(m_childrens[i]));
+	}
+
+	erase(m_childrens, nullptr);
 }
 
 void GameObjectBase::ApplyWorldMatrix(const XMMATRIX& worldMatrix)
@@ -545,6 +855,53 @@ void GameObjectBase::SetDirty()
 	for (auto& child : m_childrens) child->SetDirty();
 }
 
+FrameAccessSet GameObjectBase::GetFrameAccess(FramePhase phase) const
+{
+	// 기본 게임 오브젝트는 자기 하위 트리의 변환만 갱신
+	if (typeid(*this) == typeid(GameObjectBase)) return {};
+
+	return FrameAccessSet::Exclusive();
+}
+
+FrameAccessSet GameObjectBase::CollectFrameAccess(FramePhase phase) const
+{
+	FrameAccessSet access = GetFrameAccess(phase);
+	if (access.IsExclusive()) return access;
+
+	const vector<Base*>* components = nullptr;
+	switch (phase)
+	{
+	case FramePhase::FixedUpdate:
+		components = &m_fixedUpdateComponents;
+		break;
+
+	case FramePhase::Update:
+		components = &m_updateComponents;
+		break;
+
+	case FramePhase::Render:
+		components = &m_renderComponents;
+		break;
+
+	default:
+		return FrameAccessSet::Exclusive();
+	}
+
+	for (const Base* component : *components)
+	{
+		access |= static_cast<const ComponentBase*>(component)->GetFrameAccess(phase);
+		if (access.IsExclusive()) return access;
+	}
+
+	for (const GameObjectBase* child : m_activeChildrens)
+	{
+		access |= child->CollectFrameAccess(phase);
+		if (access.IsExclusive()) return access;
+	}
+
+	return access;
+}
+
 const XMMATRIX& GameObjectBase::UpdateWorldMatrix()
 {
 	if (m_isDirty)
@@ -566,6 +923,7 @@ const XMMATRIX& GameObjectBase::UpdateWorldMatrix()
 		}
 
 		m_isDirty = false;
+		m_transformVersion++;
 
 		m_worldData.worldMatrix = XMMatrixTranspose(m_worldMatrix);
 		m_worldData.normalMatrix = XMMatrixTranspose(m_inverseScaleSquareMatrix * m_worldMatrix);
@@ -13,9 +13,18 @@ enum class Direction // 방향 열거형
 
 class GameObjectBase : public Base
 {
+	friend class ComponentBase;
+	friend class SceneBase;
+	friend class ObjectPoolManager;
+	friend class BinarySerializer;
+	friend class StreamingSceneLoader;
+	friend class DestructionQueue;
+	friend class FrameScheduler;
+
 protected:
 	UINT m_id = 0; // 고유 ID
 	std::string m_name; // 이름
+	std::string m_prefabFileName; // 생성에 사용한 프리팹 파일 이름 // 프리팹으로 생성하지 않았으면 비어 있음
 
 	// 변환 관련 멤버 변수
 	DirectX::XMMATRIX m_worldMatrix = DirectX::XMMatrixIdentity(); // 월드 행렬
@@ -32,11 +41,15 @@ protected:
 	DirectX::XMVECTOR m_euler = DirectX::XMVectorZero(); // 오일러
 	DirectX::XMVECTOR m_scale = DirectX::XMVectorSet(1.0f, 1.0f, 1.0f, 1.0f); // 크기
 	bool m_isDirty = true; // 위치 갱신 필요 여부
+	uint32_t m_transformVersion = 0; // 월드 행렬 버전 // 월드 행렬을 다시 계산할 때마다 증가 // 아직 계산하지 않았으면 0
+	bool m_isStatic = false; // 정적 여부 // 로드 후 움직이지 않는 레벨 지오메트리
 
 	std::unordered_map<std::type_index, std::unique_ptr<Base>> m_components = {}; // 컴포넌트 맵
 	std::vector<Base*> m_fixedUpdateComponents = {}; // 고정 업데이트할 컴포넌트 배열
 	std::vector<Base*> m_updateComponents = {}; // 업데이트할 컴포넌트 배열
 	std::vector<Base*> m_renderComponents = {}; // 렌더링할 컴포넌트 배열
+	bool m_isIteratingComponents = false; // 업데이트, 렌더링 목록 순회 중 여부
+	std::vector<ComponentBase*> m_pendingActiveChangedComponents = {}; // 순회 중 활성 상태가 바뀌어 순회가 끝난 뒤 목록을 갱신할 컴포넌트 배열
 
 	// 선택된 게임 오브젝트 포인터 (에디터 전용)
 	static GameObjectBase* s_selectedObject;
@@ -44,10 +57,20 @@ protected:
 protected:
 	GameObjectBase* m_parent = nullptr; // 부모 게임 오브젝트 포인터
 	std::vector<std::unique_ptr<GameObjectBase>> m_childrens = {}; // 소유한 자식 게임 오브젝트 배열
+	std::vector<GameObjectBase*> m_activeChildrens = {}; // 활성 자식 게임 오브젝트 배열 // 업데이트, 렌더링은 이 배열만 순회 // 비활성화하면 마지막 원소가 빈 자리로 옮겨지므로 순서는 유지되지 않음
+
+private:
+	static constexpr size_t INVALID_ACTIVE_INDEX = std::numeric_limits<size_t>::max();
+
+	std::vector<GameObjectBase*>* m_activeList = nullptr; // 소속된 활성 목록 // 부모의 활성 자식 배열 또는 씬의 활성 루트 배열
+	size_t m_activeIndex = INVALID_ACTIVE_INDEX; // 활성 목록 내 인덱스 // 목록에 없으면 INVALID_ACTIVE_INDEX
+	bool m_isActiveInHierarchy = false; // 자신과 모든 부모가 활성 상태인지 여부 // 초기화 전에는 false
+	bool m_isInitialized = false; // 초기화 또는 풀 재사용 처리 완료 여부
+	size_t m_destructionIndex = std::numeric_limits<size_t>::max(); // 제거 대기열 내 인덱스 // 대기 중이 아니면 최댓값
 
 public:
 	GameObjectBase(); // 무조건 CreateGameObject로 생성
-	virtual ~GameObjectBase() = default;
+	virtual ~GameObjectBase(); // 제거 대기 중이면 대기열에서 제외
 	GameObjectBase(const GameObjectBase&) = default; // 복사
 	GameObjectBase& operator=(const GameObjectBase&) = default; // 복사 대입
 	GameObjectBase(GameObjectBase&&) = default; // 이동
@@ -55,6 +78,7 @@ public:
 
 	UINT GetID() const { return m_id; }
 	const std::string& GetName() const { return m_name; }
+	const std::string& GetPrefabFileName() const { return m_prefabFileName; }
 	static GameObjectBase* GetSelectedObject() { return s_selectedObject; }
 	static void SetSelectedObject(GameObjectBase* selected) { s_selectedObject = selected; }
 
@@ -95,6 +119,13 @@ public:
 	const DirectX::XMVECTOR& GetScale() const { return m_scale; }
 
 	const DirectX::XMMATRIX& GetWorldMatrix() const { return m_worldMatrix; }
+	uint32_t GetTransformVersion() const { return m_transformVersion; }
+	// 정적 여부 설정 // 정적 오브젝트의 컴포넌트 월드 경계는 로드 후 한 번만 계산하므로 움직이려면 먼저 해제
+	void SetStatic(bool isStatic) { m_isStatic = isStatic; }
+	bool IsStatic() const { return m_isStatic; }
+	// 컴포넌트 월드 경계를 다시 계산해야 하는지 여부 // boundsVersion은 컴포넌트가 마지막으로 경계를 계산한 변환 버전, 무효화했으면 0
+	// 움직였을 때만 true // 정적 오브젝트는 한 번 계산한 뒤로는 false
+	bool NeedsBoundsUpdate(uint32_t boundsVersion) const { return boundsVersion != m_transformVersion && !(m_isStatic && boundsVersion != 0); }
 	const WorldNormalBuffer& GetWorldNormalBuffer() const { return m_worldData; }
 	void ApplyWorldMatrix(const DirectX::XMMATRIX& worldMatrix);
 
@@ -114,9 +145,19 @@ public:
 	GameObjectBase* CreatePrefabChildGameObject(const std::string& prefabFileName); // 프리팹 자식 게임 오브젝트 생성 // 게임 오브젝트 베이스 포인터 반환
 	GameObjectBase* CreateFromJson(const nlohmann::json& jsonData); // JSON 데이터로부터 게임 오브젝트 생성
 
+	// 활성화 여부 설정 // 부모(또는 씬)의 활성 목록에서 O(1)로 추가, 제거하고 하위 트리 활성화, 비활성화 처리
+	void SetActive(bool isActive) override;
+	// 자신과 모든 부모가 활성 상태인지 여부
+	bool IsActiveInHierarchy() const { return m_isActiveInHierarchy; }
+	// 죽은 게임 오브젝트는 다음 프레임 시작 시 부모(또는 씬)에서 제거 // 풀링 대상은 풀에 반환
+	void SetAlive(bool isAlive) override;
+
 	GameObjectBase* GetChildGameObject(const std::string& name); // 이름으로 자식 게임 오브젝트 검색 // 없으면 nullptr 반환
 	GameObjectBase* GetGameObjectRecursive(const std::string& name); // 이름으로 재귀적으로 게임 오브젝트 검색 // 없으면 nullptr 반환
 
+	// 프레임 단계에서 자기 하위 트리 밖으로 읽고 쓰는 자원 // 파생 클래스는 선언하지 않으면 단독 실행
+	virtual FrameAccessSet GetFrameAccess(FramePhase phase) const;
+
 private:
 	// 게임 오브젝트 초기화
 	void BaseInitialize() override;
@@ -133,6 +174,21 @@ private:
 	// 게임 오브젝트 종료
 	void BaseFinalize() override;
 
+	// 게임 오브젝트 풀 반환 처리
+	void BaseReset() override;
+	// 게임 오브젝트 풀 재사용 처리
+	void BaseReactivate() override;
+	// 하위 트리 활성화 처리 // 이미 활성 상태거나 부모가 비활성이면 무시
+	void BaseEnable() override;
+	// 하위 트리 비활성화 처리 // 이미 비활성 상태면 무시
+	void BaseDisable() override;
+	// 자신과 활성 컴포넌트에 충돌 상태 변화 전달 // 자식에게는 전달하지 않음
+	void BaseCollision(CollisionEvent event, ColliderComponent* other) override;
+	// 초기화, 재사용 직후 자신 또는 부모가 비활성이면 비활성화 처리
+	void ApplyInitialActiveState();
+	// 프리팹 데이터로 변환 및 제거된 컴포넌트 복원 후 재사용 처리
+	void RestoreFromPrefab(const nlohmann::json& jsonData);
+
 	// 게임 오브젝트 직렬화
 	nlohmann::json BaseSerialize() override;
 	// 게임 오브젝트 역직렬화
@@ -140,8 +196,41 @@ private:
 
 	void SaveAsPrefab(); // 프리팹 저장
 
-	// 제거 대기 중인 컴포넌트 및 자식 게임 오브젝트 제거
-	void RemovePending() override;
+	// JSON 데이터로부터 컴포넌트 생성 및 역직렬화 // 초기화는 호출하지 않음
+	ComponentBase* AddComponentFromJson(const nlohmann::json& componentData);
+	// 역직렬화된 컴포넌트 소유 및 업데이트, 렌더링 목록 등록 // 이미 같은 타입이 있으면 nullptr 반환
+	ComponentBase* AttachComponent(std::unique_ptr<ComponentBase> component);
+	// 컴포넌트 활성화 여부 변경 시 업데이트, 렌더링 목록 갱신
+	void OnComponentActiveChanged(ComponentBase* component);
+
+	// 자식 게임 오브젝트 소유 및 활성 목록 연결
+	GameObjectBase* AttachChild(std::unique_ptr<GameObjectBase> child);
+	// 활성 목록 연결 // 활성 상태면 목록에 추가 // nullptr이면 연결 해제
+	void LinkActiveList(std::vector<GameObjectBase*>* activeList);
+	// 활성 목록에 추가
+	void AddToActiveList();
+	// 활성 목록에서 제거 // 마지막 원소를 빈 자리로 옮김
+	void RemoveFromActiveList();
+	// JSON 데이터로부터 변환 로드
+	void DeserializeTransform(const nlohmann::json& jsonData);
+
+	// 죽은 컴포넌트 제거 및 업데이트, 렌더링 목록에서 해제
+	void DestroyComponent(ComponentBase* component);
+	// 컴포넌트 활성화 여부에 맞게 업데이트, 렌더링 목록에 추가 또는 제거
+	void UpdateComponentLists(ComponentBase* component);
+	// 업데이트, 렌더링 목록 순회 // 인덱스로 순회하므로 순회 중 추가된 컴포넌트도 포함
+	// 순회 중 활성 상태가 바뀐 컴포넌트는 순회가 끝난 뒤 목록 갱신 // 그동안 비활성화된 컴포넌트는 건너뜀
+	template<typename F>
+	void ForEachComponent(std::vector<Base*>& components, F&& function);
+	// 활성 자식 순회 // 순회 중 활성 목록이 바뀌어도 빠지는 자식이 없도록 순회 시작 시점의 목록을 복사해 순회
+	// 앞선 형제가 비활성화한 자식은 건너뛰고, 순회 중 활성화된 자식은 다음 순회부터 포함
+	template<typename F>
+	void ForEachActiveChild(F&& function);
+	// 죽은 자식 게임 오브젝트를 풀에 반환하거나 종료 후 제거 // 한 번의 순회로 처리
+	void DestroyDeadChildren();
+
+	// 자신, 단계 목록의 컴포넌트, 활성 자식의 접근 집합 합 // 단독 실행이 확정되면 바로 반환
+	FrameAccessSet CollectFrameAccess(FramePhase phase) const;
 
 	// 위치 갱신 필요로 설정 // 자식 게임 오브젝트도 설정
 	void SetDirty();
@@ -190,9 +279,8 @@ inline T* GameObjectBase::CreateChildGameObject()
 	std::unique_ptr<T> child = std::make_unique<T>();
 
 	T* childPtr = child.get();
-	child->m_parent = this;
-	child->BaseInitialize();
-	m_childrens.push_back(std::move(child));
+	AttachChild(std::move(child));
+	static_cast<GameObjectBase*>(childPtr)->BaseInitialize();
 
 	return childPtr;
 }
\ No newline at end of file
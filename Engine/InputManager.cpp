@@ -1,6 +1,8 @@
 #include "stdafx.h" 
 #include "InputManager.h"
 
+#include "InputRecorder.h"
+
 using namespace std;
 
 void InputManager::Initialize(HWND hWnd)
@@ -21,10 +23,13 @@ void InputManager::ClearInput()
 
 void InputManager::HandleMessage(UINT msg, WPARAM wParam, LPARAM lParam)
 {
+	// 재생 중에는 실제 입력 무시
+	if (InputRecorder::GetInstance().IsReplaying()) return;
+
 	switch (msg)
 	{
 	case WM_MOUSEWHEEL:
-		m_wheelDelta += GET_WHEEL_DELTA_WPARAM(wParam);
+		ProcessEvent({ .type = InputEventType::Wheel, .x = static_cast<int16_t>(GET_WHEEL_DELTA_WPARAM(wParam)) });
 		break;
 
 	case WM_INPUT:
@@ -78,56 +83,61 @@ void InputManager::ProcessRawKeyboard(const RAWKEYBOARD& keyboard)
 
 	bool isKeyDown = !(keyboard.Flags & RI_KEY_BREAK);
 
-	if (isKeyDown)
-	{
-		if (!m_keyState[vKey]) m_keyDownState[vKey] = true;
-		m_keyState[vKey] = true;
-	}
-	else
-	{
-		m_keyUpState[vKey] = true;
-		m_keyState[vKey] = false;
-	}
+	ProcessEvent({ .type = isKeyDown ? InputEventType::KeyDown : InputEventType::KeyUp, .key = static_cast<uint8_t>(vKey) });
 }
 
 void InputManager::ProcessRawMouse(const RAWMOUSE& mouse)
 {
-	if (mouse.usButtonFlags & RI_MOUSE_LEFT_BUTTON_DOWN)
-	{
-		if (!m_keyState[VK_LBUTTON]) m_keyDownState[VK_LBUTTON] = true;
-		m_keyState[VK_LBUTTON] = true;
-	}
-	if (mouse.usButtonFlags & RI_MOUSE_LEFT_BUTTON_UP)
-	{
-		m_keyUpState[VK_LBUTTON] = true;
-		m_keyState[VK_LBUTTON] = false;
-	}
-	if (mouse.usButtonFlags & RI_MOUSE_RIGHT_BUTTON_DOWN)
-	{
-		if (!m_keyState[VK_RBUTTON]) m_keyDownState[VK_RBUTTON] = true;
-		m_keyState[VK_RBUTTON] = true;
-	}
-	if (mouse.usButtonFlags & RI_MOUSE_RIGHT_BUTTON_UP)
-	{
-		m_keyUpState[VK_RBUTTON] = true;
-		m_keyState[VK_RBUTTON] = false;
-	}
-	if (mouse.usButtonFlags & RI_MOUSE_MIDDLE_BUTTON_DOWN)
-	{
-		if (!m_keyState[VK_MBUTTON]) m_keyDownState[VK_MBUTTON] = true;
-		m_keyState[VK_MBUTTON] = true;
-	}
-	if (mouse.usButtonFlags & RI_MOUSE_MIDDLE_BUTTON_UP)
+	if (mouse.usButtonFlags & RI_MOUSE_LEFT_BUTTON_DOWN) ProcessEvent({ .type = InputEventType::KeyDown, .key = VK_LBUTTON });
+	if (mouse.usButtonFlags & RI_MOUSE_LEFT_BUTTON_UP) ProcessEvent({ .type = InputEventType::KeyUp, .key = VK_LBUTTON });
+	if (mouse.usButtonFlags & RI_MOUSE_RIGHT_BUTTON_DOWN) ProcessEvent({ .type = InputEventType::KeyDown, .key = VK_RBUTTON });
+	if (mouse.usButtonFlags & RI_MOUSE_RIGHT_BUTTON_UP) ProcessEvent({ .type = InputEventType::KeyUp, .key = VK_RBUTTON });
+	if (mouse.usButtonFlags & RI_MOUSE_MIDDLE_BUTTON_DOWN) ProcessEvent({ .type = InputEventType::KeyDown, .key = VK_MBUTTON });
+	if (mouse.usButtonFlags & RI_MOUSE_MIDDLE_BUTTON_UP) ProcessEvent({ .type = InputEventType::KeyUp, .key = VK_MBUTTON });
+
+	const auto toInt16 = [](long value) { return static_cast<int16_t>(clamp<long>(value, numeric_limits<int16_t>::min(), numeric_limits<int16_t>::max())); };
+
+	if (mouse.lLastX != 0 || mouse.lLastY != 0) ProcessEvent({ .type = InputEventType::MouseDelta, .x = toInt16(mouse.lLastX), .y = toInt16(mouse.lLastY) });
+
+	POINT mousePosition = {};
+	GetCursorPos(&mousePosition);
+	ScreenToClient(m_hWnd, &mousePosition);
+	if (mousePosition.x != m_mousePos.x || mousePosition.y != m_mousePos.y) ProcessEvent({ .type = InputEventType::MousePosition, .x = toInt16(mousePosition.x), .y = toInt16(mousePosition.y) });
+}
+
+void InputManager::ApplyEvent(const InputEvent& event)
+{
+	switch (event.type)
 	{
-		m_keyUpState[VK_MBUTTON] = true;
-		m_keyState[VK_MBUTTON] = false;
-	}
+	case InputEventType::KeyDown:
+		if (!m_keyState[event.key]) m_keyDownState[event.key] = true;
+		m_keyState[event.key] = true;
+		break;
 
-	m_mouseDelta.x += static_cast<int>(mouse.lLastX);
-	m_mouseDelta.y += static_cast<int>(mouse.lLastY);
+	case InputEventType::KeyUp:
+		m_keyUpState[event.key] = true;
+		m_keyState[event.key] = false;
+		break;
 
-	GetCursorPos(&m_mousePos);
-	ScreenToClient(m_hWnd, &m_mousePos);
+	case InputEventType::MouseDelta:
+		m_mouseDelta.x += event.x;
+		m_mouseDelta.y += event.y;
+		break;
+
+	case InputEventType::MousePosition:
+		m_mousePos = { event.x, event.y };
+		break;
+
+	case InputEventType::Wheel:
+		m_wheelDelta += event.x;
+		break;
+	}
+}
+
+void InputManager::ProcessEvent(const InputEvent& event)
+{
+	InputRecorder::GetInstance().RecordEvent(event);
+	ApplyEvent(event);
 }
 
 bool InputManager::GetKeyDown(KeyCode key) const
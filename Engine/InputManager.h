@@ -1,6 +1,8 @@
 #pragma once
 #include "KeyCode.h"
 
+struct InputEvent;
+
 class InputManager : public Singleton<InputManager>
 {
 	HWND m_hWnd = nullptr;
@@ -15,6 +17,7 @@ class InputManager : public Singleton<InputManager>
 
 public:
     friend class Singleton<InputManager>;
+    friend class InputRecorder;
 
     using UINT = unsigned int;
     using WPARAM = std::uintptr_t;
@@ -42,4 +45,9 @@ private:
 	void ProcessRawMouse(const RAWMOUSE& mouse);
 
     int MapKeyCodeToVKey(KeyCode key) const;
+
+    // 해석된 입력 이벤트 적용 // 실제 입력은 기록 후 적용, 재생 입력은 InputRecorder에서 적용
+    void ApplyEvent(const InputEvent& event);
+    // 실제 입력 이벤트 기록 및 적용
+    void ProcessEvent(const InputEvent& event);
 };
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "stdafx.h"
+#include "InputRecorder.h"
+
+#include "InputManager.h"
+#include "TimeManager.h"
+#include "RNG.h"
+
+using namespace std;
+
+bool InputRecorder::StartRecording(const filesystem::path& filePath)
+{
+	m_recordFile.open(filePath, ios::binary | ios::trunc);
+	if (!m_recordFile)
+	{
+		cerr << "입력 기록 파일 열기 실패: " << filePath.string() << endl;
+		return false;
+	}
+
+	m_seed = random_device{}();
+	RNG::GetInstance().Initialize(m_seed);
+
+	m_recordFile.write(reinterpret_cast<const char*>(&FILE_MAGIC), sizeof(FILE_MAGIC));
+	m_recordFile.write(reinterpret_cast<const char*>(&FILE_VERSION), sizeof(FILE_VERSION));
+	m_recordFile.write(reinterpret_cast<const char*>(&m_seed), sizeof(m_seed));
+
+	m_mode = Mode::Record;
+
+	return true;
+}
+
+bool InputRecorder::StartReplay(const filesystem::path& filePath)
+{
+	ifstream file(filePath, ios::binary);
+	if (!file)
+	{
+		cerr << "입력 기록 파일 열기 실패: " << filePath.string() << endl;
+		return false;
+	}
+
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+	file.read(reinterpret_cast<char*>(&version), sizeof(version));
+	file.read(reinterpret_cast<char*>(&m_seed), sizeof(m_seed));
+	if (!file || magic != FILE_MAGIC || version != FILE_VERSION)
+	{
+		cerr << "입력 기록 파일 형식 오류: " << filePath.string() << endl;
+		return false;
+	}
+
+	m_replayFrames.clear();
+	m_replayEvents.clear();
+
+	while (true)
+	{
+		ReplayFrame frame = {};
+		uint16_t eventCount = 0;
+		file.read(reinterpret_cast<char*>(&frame.deltaTime), sizeof(frame.deltaTime));
+		file.read(reinterpret_cast<char*>(&eventCount), sizeof(eventCount));
+		if (!file) break;
+
+		frame.firstEvent = m_replayEvents.size();
+		frame.eventCount = eventCount;
+		m_replayEvents.resize(frame.firstEvent + eventCount);
+		file.read(reinterpret_cast<char*>(m_replayEvents.data() + frame.firstEvent), sizeof(InputEvent) * eventCount);
+		if (!file)
+		{
+			// 기록 도중 종료된 파일 // 마지막 프레임은 버림
+			m_replayEvents.resize(frame.firstEvent);
+			break;
+		}
+
+		m_replayFrames.push_back(frame);
+	}
+
+	RNG::GetInstance().Initialize(m_seed);
+
+	m_replayFrameIndex = 0;
+	m_mode = Mode::Replay;
+
+	cout << "입력 재생: " << m_replayFrames.size() << "프레임, 이벤트 " << m_replayEvents.size() << "개, 시드 " << m_seed << endl;
+
+	return true;
+}
+
+void InputRecorder::Finalize()
+{
+	if (m_recordFile.is_open()) m_recordFile.close();
+
+	// 재생을 마친 뒤에는 실제 시간으로 복귀
+	if (m_mode == Mode::Replay) TimeManager::GetInstance().SetFixedDeltaTime(0.0f);
+
+	m_mode = Mode::None;
+}
+
+void InputRecorder::BeginFrame()
+{
+	if (m_mode != Mode::Replay || IsReplayFinished()) return;
+
+	const ReplayFrame& frame = m_replayFrames[m_replayFrameIndex++];
+
+	InputManager& inputManager = InputManager::GetInstance();
+	for (size_t i = 0; i < frame.eventCount; ++i) inputManager.ApplyEvent(m_replayEvents[frame.firstEvent + i]);
+
+	TimeManager::GetInstance().SetFixedDeltaTime(frame.deltaTime);
+}
+
+void InputRecorder::EndFrame(float deltaTime)
+{
+	if (m_mode != Mode::Record) return;
+
+	// 한 프레임의 이벤트가 uint16 범위를 넘으면 나머지는 버림
+	const uint16_t eventCount = static_cast<uint16_t>(min<size_t>(m_frameEvents.size(), numeric_limits<uint16_t>::max()));
+
+	m_recordFile.write(reinterpret_cast<const char*>(&deltaTime), sizeof(deltaTime));
+	m_recordFile.write(reinterpret_cast<const char*>(&eventCount), sizeof(eventCount));
+	m_recordFile.write(reinterpret_cast<const char*>(m_frameEvents.data()), sizeof(InputEvent) * eventCount);
+
+	m_frameEvents.clear();
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+// 기록, 재생 단위 입력 이벤트 // 원시 입력을 해석한 결과
+enum class InputEventType : uint8_t
+{
+	KeyDown, // key
+	KeyUp, // key
+	MouseDelta, // x, y
+	MousePosition, // x, y // 클라이언트 좌표
+	Wheel, // x
+
+	Count
+};
+
+#pragma pack(push, 1)
+struct InputEvent
+{
+	InputEventType type = InputEventType::KeyDown;
+	uint8_t key = 0; // 가상 키 코드
+	int16_t x = 0;
+	int16_t y = 0;
+};
+#pragma pack(pop)
+
+// 프레임 단위 입력 기록 및 재생 // 성능 비교용 재현 실행
+// 파일 형식: 헤더(식별자, 버전, 난수 시드) 후 프레임마다 [델타 타임(float), 이벤트 수(uint16), 이벤트 배열]
+// 재생 중에는 실제 입력을 무시하고, 델타 타임을 기록값으로 고정하며, 난수 시드를 기록값으로 설정
+class InputRecorder : public Singleton<InputRecorder>
+{
+	friend class Singleton<InputRecorder>;
+
+	static constexpr uint32_t FILE_MAGIC = 0x31524941; // "AIR1"
+	static constexpr uint32_t FILE_VERSION = 1;
+
+	enum class Mode
+	{
+		None,
+		Record,
+		Replay
+	};
+
+	struct ReplayFrame
+	{
+		float deltaTime = 0.0f; // 기록된 델타 타임 // 시간 배율 적용 전
+		size_t firstEvent = 0; // 이벤트 배열 내 시작 인덱스
+		size_t eventCount = 0;
+	};
+
+	Mode m_mode = Mode::None;
+	uint32_t m_seed = 0; // 난수 시드
+
+	// 기록
+	std::ofstream m_recordFile = {};
+	std::vector<InputEvent> m_frameEvents = {}; // 이번 프레임에 기록할 이벤트 배열
+
+	// 재생
+	std::vector<ReplayFrame> m_replayFrames = {};
+	std::vector<InputEvent> m_replayEvents = {};
+	size_t m_replayFrameIndex = 0; // 다음에 재생할 프레임 인덱스
+
+public:
+	~InputRecorder() = default;
+	InputRecorder(const InputRecorder&) = delete;
+	InputRecorder& operator=(const InputRecorder&) = delete;
+	InputRecorder(InputRecorder&&) = delete;
+	InputRecorder& operator=(InputRecorder&&) = delete;
+
+	// 기록 시작 // 새 난수 시드를 만들어 파일에 저장 // 실패하면 false
+	bool StartRecording(const std::filesystem::path& filePath);
+	// 재생 시작 // 파일 전체를 읽고 기록된 난수 시드 사용 // 실패하면 false
+	bool StartReplay(const std::filesystem::path& filePath);
+	// 기록 파일 닫기
+	void Finalize();
+
+	bool IsRecording() const { return m_mode == Mode::Record; }
+	bool IsReplaying() const { return m_mode == Mode::Replay; }
+	// 모든 기록 프레임을 재생했는지 여부
+	bool IsReplayFinished() const { return IsReplaying() && m_replayFrameIndex >= m_replayFrames.size(); }
+	size_t GetReplayFrameCount() const { return m_replayFrames.size(); }
+	// 난수 시드 // 기록, 재생 중이 아니면 0
+	uint32_t GetSeed() const { return m_seed; }
+
+	// 입력 이벤트 기록 // InputManager에서 실제 입력 해석 후 호출
+	void RecordEvent(const InputEvent& event) { if (m_mode == Mode::Record) m_frameEvents.push_back(event); }
+
+	// 메시지 처리 직후 호출 // 재생 중이면 이번 프레임 이벤트 적용 및 델타 타임 고정
+	void BeginFrame();
+	// 시간 갱신 직후 호출 // 기록 중이면 이번 프레임 이벤트와 델타 타임 저장
+	void EndFrame(float deltaTime);
+
+private:
+	InputRecorder() = default;
+};
@@ -0,0 +1,315 @@
+#include "stdafx.h"
+#include "JobSystem.h"
+
+#include "Profiler.h"
+#include "Microbenchmark.h"
+
+using namespace std;
+
+REGISTER_MICROBENCHMARK(JobSystem, []() { JobSystem::GetInstance().RunMicrobenchmarks(); })
+
+namespace
+{
+	thread_local size_t t_workerIndex = JobSystem::NOT_WORKER; // 현재 스레드의 작업자 인덱스
+}
+
+void JobSystem::Initialize(size_t workerCount)
+{
+	m_mainThreadId = this_thread::get_id();
+
+	if (workerCount == 0)
+	{
+		const unsigned int hardwareThreadCount = thread::hardware_concurrency();
+		workerCount = hardwareThreadCount > 1 ? hardwareThreadCount - 1 : 1;
+	}
+
+	m_isRunning = true;
+
+	m_workQueues.reserve(workerCount);
+	for (size_t i = 0; i < workerCount; ++i) m_workQueues.push_back(make_unique<WorkQueue>());
+
+	m_workers.reserve(workerCount);
+	for (size_t i = 0; i < workerCount; ++i) m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+}
+
+void JobSystem::Finalize()
+{
+	if (!m_isRunning) return;
+
+	// 작업자는 큐가 빌 때까지 남은 작업을 처리한 뒤 종료
+	{
+		lock_guard<mutex> lock(m_wakeMutex);
+		m_isRunning = false;
+	}
+	m_wakeCondition.notify_all();
+
+	for (thread& worker : m_workers) worker.join();
+	m_workers.clear();
+	m_workQueues.clear();
+
+	ExecuteMainThreadJobs();
+}
+
+void JobSystem::Schedule(function<void()> function, JobCounter* counter)
+{
+	if (counter) counter->m_pendingCount.fetch_add(1, memory_order_relaxed);
+
+	Job job = { move(function), counter };
+
+	// 작업자가 없으면 호출 스레드에서 바로 실행
+	if (m_workQueues.empty()) Execute(job);
+	else Enqueue(move(job));
+}
+
+void JobSystem::ScheduleAfter(JobCounter& dependency, function<void()> function, JobCounter* counter)
+{
+	if (counter) counter->m_pendingCount.fetch_add(1, memory_order_relaxed);
+
+	Job job = { move(function), counter };
+
+	// 마지막 완료 처리는 같은 뮤텍스 안에서 카운터를 0으로 만들므로 잠근 상태에서 보면 완료 여부가 확정됨
+	{
+		lock_guard<mutex> lock(dependency.m_continuationMutex);
+		if (!dependency.IsDone())
+		{
+			dependency.m_continuations.push_back(move(job));
+			return;
+		}
+	}
+
+	if (m_workQueues.empty()) Execute(job);
+	else Enqueue(move(job));
+}
+
+void JobSystem::ScheduleOnMainThread(function<void()> function, JobCounter* counter)
+{
+	if (counter) counter->m_pendingCount.fetch_add(1, memory_order_relaxed);
+
+	lock_guard<mutex> lock(m_mainThreadMutex);
+	m_mainThreadJobs.push_back({ move(function), counter });
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+	const bool isMainThread = IsMainThread();
+
+	while (!counter.IsDone())
+	{
+		// 기다리는 작업이 메인 스레드 작업에 의존할 수 있으므로 메인 스레드는 메인 스레드 작업도 처리
+		if (isMainThread) ExecuteMainThreadJobs();
+
+		Job job;
+		if (TryDequeue(job)) Execute(job);
+		else this_thread::yield();
+	}
+
+	// 마지막 완료 처리가 카운터 사용을 끝낼 때까지 대기 // 반환 후 카운터 해제 가능
+	lock_guard<mutex> lock(counter.m_continuationMutex);
+}
+
+void JobSystem::ExecuteMainThreadJobs()
+{
+	vector<Job> jobs;
+	{
+		lock_guard<mutex> lock(m_mainThreadMutex);
+		if (m_mainThreadJobs.empty()) return;
+
+		jobs.swap(m_mainThreadJobs);
+	}
+
+	for (Job& job : jobs) Execute(job);
+	m_stats.mainThreadJobCount.fetch_add(jobs.size(), memory_order_relaxed);
+}
+
+size_t JobSystem::GetCurrentWorkerIndex()
+{
+	return t_workerIndex;
+}
+
+void JobSystem::RunMicrobenchmarks()
+{
+	cout << "[작업 시스템 마이크로벤치마크] 작업자 스레드 " << GetWorkerCount() << "개" << endl;
+
+	// 빈 작업 예약 및 실행 비용 // 작업자가 아닌 스레드에서 예약하면 큐에 순환 분배
+	constexpr size_t JOB_COUNT = 100000;
+	{
+		JobCounter counter;
+		const double elapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t i = 0; i < JOB_COUNT; ++i) Schedule([]() {}, &counter);
+				Wait(counter);
+			});
+		cout << "메인 스레드에서 예약: " << elapsed * 1000000.0 / JOB_COUNT << " ns/작업" << endl;
+	}
+
+	// 훔치기 비용 // 작업자 하나의 큐에 모든 작업을 예약하면 나머지 작업자가 훔쳐서 실행
+	{
+		const uint64_t stolenJobCount = m_stats.stolenJobCount.load();
+
+		JobCounter counter;
+		const double elapsed = MeasureMilliseconds([&]()
+			{
+				Schedule([&]() { for (size_t i = 0; i < JOB_COUNT; ++i) Schedule([]() {}, &counter); }, &counter);
+				Wait(counter);
+			});
+		cout << "작업자에서 예약: " << elapsed * 1000000.0 / JOB_COUNT << " ns/작업, 훔친 작업 " << m_stats.stolenJobCount.load() - stolenJobCount << "개" << endl;
+	}
+
+	// 연속 작업 지연 // 앞 작업이 끝나야 다음 작업이 예약되는 사슬
+	constexpr size_t CHAIN_LENGTH = 10000;
+	{
+		JobCounter counter;
+		function<void(size_t)> scheduleChain = [&](size_t remaining)
+			{
+				if (remaining == 0) return;
+
+				JobCounter* link = new JobCounter();
+				Schedule([]() {}, link);
+				ScheduleAfter(*link, [&, link, remaining]() { delete link; scheduleChain(remaining - 1); }, &counter);
+			};
+
+		const double elapsed = MeasureMilliseconds([&]()
+			{
+				scheduleChain(CHAIN_LENGTH);
+				Wait(counter);
+			});
+		cout << "연속 작업: " << elapsed * 1000000.0 / CHAIN_LENGTH << " ns/단계" << endl;
+	}
+
+	// 병렬 반복 처리량
+	constexpr size_t ELEMENT_COUNT = 1 << 22;
+	{
+		vector<float> values(ELEMENT_COUNT);
+		const auto work = [&](size_t i) { values[i] = sqrtf(static_cast<float>(i)) * sinf(static_cast<float>(i)); };
+
+		const double serialElapsed = MeasureMilliseconds([&]() { for (size_t i = 0; i < ELEMENT_COUNT; ++i) work(i); });
+		const double parallelElapsed = MeasureMilliseconds([&]() { ParallelFor(ELEMENT_COUNT, 0, work); });
+		cout << "병렬 반복 " << ELEMENT_COUNT << "개: 직렬 " << serialElapsed << " ms, 병렬 " << parallelElapsed << " ms (" << serialElapsed / parallelElapsed << "배)" << endl;
+	}
+}
+
+void JobSystem::WorkerLoop(size_t workerIndex)
+{
+	t_workerIndex = workerIndex;
+
+	while (true)
+	{
+		Job job;
+		if (TryDequeue(job))
+		{
+			Execute(job);
+			continue;
+		}
+
+		unique_lock<mutex> lock(m_wakeMutex);
+		if (!m_isRunning && m_queuedJobCount.load() == 0) break;
+
+		m_sleepingWorkerCount.fetch_add(1);
+		m_wakeCondition.wait(lock, [&]() { return m_queuedJobCount.load() > 0 || !m_isRunning; });
+		m_sleepingWorkerCount.fetch_sub(1);
+	}
+
+	t_workerIndex = NOT_WORKER;
+}
+
+void JobSystem::Enqueue(Job&& job)
+{
+	// 작업자 스레드는 자기 큐에, 그 외 스레드는 큐를 돌아가며 예약
+	const size_t queueIndex = t_workerIndex != NOT_WORKER ? t_workerIndex : m_nextQueueIndex.fetch_add(1, memory_order_relaxed) % m_workQueues.size();
+
+	WorkQueue& queue = *m_workQueues[queueIndex];
+	{
+		lock_guard<mutex> lock(queue.mutex);
+		queue.jobs.push_back(move(job));
+	}
+	m_queuedJobCount.fetch_add(1);
+
+	// 잠든 작업자가 있을 때만 깨움 // 잠들기 직전의 작업자는 깨우기 뮤텍스를 잡고 있으므로 알림을 놓치지 않음
+	if (m_sleepingWorkerCount.load() == 0) return;
+
+	{
+		lock_guard<mutex> lock(m_wakeMutex);
+	}
+	m_wakeCondition.notify_one();
+}
+
+bool JobSystem::TryDequeue(Job& job)
+{
+	const size_t queueCount = m_workQueues.size();
+	if (queueCount == 0) return false;
+
+	// 자기 큐는 뒤에서 꺼냄 // 방금 예약한 작업이 캐시에 남아 있을 가능성이 높음
+	if (t_workerIndex != NOT_WORKER)
+	{
+		WorkQueue& queue = *m_workQueues[t_workerIndex];
+
+		lock_guard<mutex> lock(queue.mutex);
+		if (!queue.jobs.empty())
+		{
+			job = move(queue.jobs.back());
+			queue.jobs.pop_back();
+			m_queuedJobCount.fetch_sub(1);
+
+			return true;
+		}
+	}
+
+	// 다른 큐는 앞에서 훔침 // 다른 스레드가 사용 중인 큐는 건너뜀
+	const size_t startIndex = t_workerIndex != NOT_WORKER ? t_workerIndex + 1 : 0;
+	for (size_t i = 0; i < queueCount; ++i)
+	{
+		const size_t queueIndex = (startIndex + i) % queueCount;
+		if (queueIndex == t_workerIndex) continue;
+
+		WorkQueue& queue = *m_workQueues[queueIndex];
+
+		unique_lock<mutex> lock(queue.mutex, try_to_lock);
+		if (!lock.owns_lock() || queue.jobs.empty()) continue;
+
+		job = move(queue.jobs.front());
+		queue.jobs.pop_front();
+		m_queuedJobCount.fetch_sub(1);
+
+		if (t_workerIndex != NOT_WORKER) m_stats.stolenJobCount.fetch_add(1, memory_order_relaxed);
+
+		return true;
+	}
+
+	return false;
+}
+
+void JobSystem::Execute(Job& job)
+{
+	{
+		PROFILE_SCOPE("Job");
+		job.function();
+	}
+	m_stats.executedJobCount.fetch_add(1, memory_order_relaxed);
+
+	if (job.counter) Complete(*job.counter);
+}
+
+void JobSystem::Complete(JobCounter& counter)
+{
+	// 마지막 작업이 아니면 잠금 없이 감소
+	uint32_t pendingCount = counter.m_pendingCount.load(memory_order_relaxed);
+	while (pendingCount > 1)
+	{
+		if (counter.m_pendingCount.compare_exchange_weak(pendingCount, pendingCount - 1, memory_order_acq_rel)) return;
+	}
+
+	// 마지막 작업은 연속 작업 뮤텍스 안에서 0으로 만들고, 이후로는 카운터를 건드리지 않음
+	vector<Job> continuations;
+	{
+		lock_guard<mutex> lock(counter.m_continuationMutex);
+		if (counter.m_pendingCount.fetch_sub(1, memory_order_acq_rel) != 1) return;
+
+		continuations.swap(counter.m_continuations);
+	}
+
+	for (Job& continuation : continuations)
+	{
+		if (m_workQueues.empty()) Execute(continuation);
+		else Enqueue(move(continuation));
+	}
+}
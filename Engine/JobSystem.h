@@ -0,0 +1,149 @@
+#pragma once
+
+class JobCounter;
+
+// 작업 단위 // 완료 시 counter 감소
+struct Job
+{
+	std::function<void()> function = nullptr; // 실행할 함수
+	JobCounter* counter = nullptr; // 완료 시 감소시킬 카운터 // 없으면 nullptr
+};
+
+// 작업 완료 카운터 // 작업 예약 시 증가, 완료 시 감소 // 0이 되면 이어서 실행할 작업(연속 작업) 예약
+// Wait으로 완료를 확인한 뒤에만 재사용 가능
+class JobCounter
+{
+	friend class JobSystem;
+
+	std::atomic<uint32_t> m_pendingCount = 0; // 완료되지 않은 작업 수
+	std::mutex m_continuationMutex = {}; // 연속 작업 배열 보호
+	std::vector<Job> m_continuations = {}; // 카운터가 0이 되면 예약할 작업 배열
+
+public:
+	JobCounter() = default;
+	~JobCounter() = default;
+	JobCounter(const JobCounter&) = delete;
+	JobCounter& operator=(const JobCounter&) = delete;
+	JobCounter(JobCounter&&) = delete;
+	JobCounter& operator=(JobCounter&&) = delete;
+
+	bool IsDone() const { return m_pendingCount.load(std::memory_order_acquire) == 0; }
+};
+
+struct JobSystemStats
+{
+	std::atomic<uint64_t> executedJobCount = 0; // 실행한 작업 수
+	std::atomic<uint64_t> stolenJobCount = 0; // 다른 작업자 큐에서 가져온 작업 수
+	std::atomic<uint64_t> mainThreadJobCount = 0; // 메인 스레드에서 실행한 메인 스레드 전용 작업 수
+};
+
+// 코어별 작업자 스레드와 작업 훔치기(work stealing) 큐로 구성된 작업 시스템
+// 작업자는 자기 큐의 뒤에서 꺼내고, 비면 다른 작업자 큐의 앞에서 훔침 // 대기(Wait) 중인 스레드는 멈추지 않고 다른 작업을 대신 실행
+// 디바이스 컨텍스트 등 메인 스레드에서만 다룰 수 있는 작업은 메인 스레드 큐에 예약하고 프레임 시작 시 실행
+class JobSystem : public Singleton<JobSystem>
+{
+	friend class Singleton<JobSystem>;
+
+public:
+	static constexpr size_t NOT_WORKER = std::numeric_limits<size_t>::max();
+
+private:
+
+	// 작업자별 작업 큐 // 소유 작업자는 뒤, 훔치는 작업자는 앞에서 꺼냄
+	struct WorkQueue
+	{
+		std::mutex mutex = {};
+		std::deque<Job> jobs = {};
+	};
+
+	std::vector<std::thread> m_workers = {}; // 작업자 스레드 배열
+	std::vector<std::unique_ptr<WorkQueue>> m_workQueues = {}; // 작업자별 작업 큐 배열
+	std::atomic<size_t> m_nextQueueIndex = 0; // 작업자가 아닌 스레드에서 예약할 때 사용할 큐 인덱스 // 순환 분배
+
+	std::atomic<size_t> m_queuedJobCount = 0; // 큐에 대기 중인 작업 수 // 작업자 깨우기 판단용
+	std::atomic<size_t> m_sleepingWorkerCount = 0; // 잠든 작업자 수 // 0이면 예약 시 깨우기 생략
+	std::mutex m_wakeMutex = {}; // 작업자 깨우기 조건 변수 보호
+	std::condition_variable m_wakeCondition = {}; // 작업 예약 시 작업자 깨우기
+	std::atomic<bool> m_isRunning = false; // 작업자 스레드 실행 여부
+
+	std::mutex m_mainThreadMutex = {}; // 메인 스레드 작업 큐 보호
+	std::vector<Job> m_mainThreadJobs = {}; // 메인 스레드에서 실행할 작업 배열
+	std::thread::id m_mainThreadId = {}; // 메인 스레드 ID // Initialize를 호출한 스레드
+
+	JobSystemStats m_stats = {};
+
+public:
+	~JobSystem() = default;
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+	JobSystem(JobSystem&&) = delete;
+	JobSystem& operator=(JobSystem&&) = delete;
+
+	// 작업자 스레드 생성 // workerCount가 0이면 (하드웨어 스레드 수 - 1)개 생성 // 메인 스레드에서 호출
+	void Initialize(size_t workerCount = 0);
+	// 남은 작업을 모두 실행한 뒤 작업자 스레드 종료
+	void Finalize();
+
+	// 작업 예약 // 작업자가 없으면 바로 실행
+	void Schedule(std::function<void()> function, JobCounter* counter = nullptr);
+	// dependency의 작업이 모두 끝난 뒤 실행할 작업 예약 // 이미 끝났으면 바로 예약
+	void ScheduleAfter(JobCounter& dependency, std::function<void()> function, JobCounter* counter = nullptr);
+	// 메인 스레드 전용 작업 예약 // ExecuteMainThreadJobs 또는 메인 스레드의 Wait에서 실행
+	void ScheduleOnMainThread(std::function<void()> function, JobCounter* counter = nullptr);
+
+	// counter의 작업이 모두 끝날 때까지 대기 // 대기 중 다른 작업을 대신 실행하므로 작업자 안에서 호출해도 교착되지 않음
+	void Wait(JobCounter& counter);
+
+	// [0, count) 구간을 batchSize 단위로 나눠 병렬 실행 // function(index) // batchSize가 0이면 작업자 수로 자동 분할
+	// 첫 구간은 호출 스레드가 직접 실행 // 모든 구간이 끝나야 반환
+	template<typename Function>
+	void ParallelFor(size_t count, size_t batchSize, Function&& function);
+
+	// 메인 스레드 작업 실행 // 프레임 시작 시 호출
+	void ExecuteMainThreadJobs();
+
+	size_t GetWorkerCount() const { return m_workers.size(); }
+	bool IsMainThread() const { return std::this_thread::get_id() == m_mainThreadId; }
+	// 현재 스레드의 작업자 인덱스 // 작업자가 아니면 NOT_WORKER
+	static size_t GetCurrentWorkerIndex();
+	const JobSystemStats& GetStats() const { return m_stats; }
+
+	// 작업 예약, 훔치기, 병렬 반복 비용 측정 결과를 콘솔에 출력
+	void RunMicrobenchmarks();
+
+private:
+	JobSystem() = default;
+
+	// 작업자 스레드 루프
+	void WorkerLoop(size_t workerIndex);
+
+	// 큐에 작업 추가 후 작업자 깨우기
+	void Enqueue(Job&& job);
+	// 실행할 작업 얻기 // 자기 큐를 먼저 보고 비었으면 다른 큐에서 훔침
+	bool TryDequeue(Job& job);
+	// 작업 실행 및 카운터 감소
+	void Execute(Job& job);
+	// 카운터 감소 // 0이 되면 연속 작업 예약
+	void Complete(JobCounter& counter);
+};
+
+template<typename Function>
+inline void JobSystem::ParallelFor(size_t count, size_t batchSize, Function&& function)
+{
+	if (count == 0) return;
+
+	// 작업자 한 명당 네 구간 정도로 나눠 불균형 완화
+	if (batchSize == 0) batchSize = std::max<size_t>(1, count / ((GetWorkerCount() + 1) * 4));
+
+	JobCounter counter;
+	for (size_t begin = batchSize; begin < count; begin += batchSize)
+	{
+		const size_t end = std::min(begin + batchSize, count);
+		Schedule([&function, begin, end]() { for (size_t i = begin; i < end; ++i) function(i); }, &counter);
+	}
+
+	const size_t firstEnd = std::min(batchSize, count);
+	for (size_t i = 0; i < firstEnd; ++i) function(i);
+
+	Wait(counter);
+}
@@ -7,6 +7,9 @@ public:
 	bool NeedsUpdate() const override { return true; }
 	bool NeedsRender() const override { return false; }
 
+	// 업데이트에서 사운드 매니저의 리스너 갱신
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override { return { .write = FrameAccess::Audio }; }
+
 protected:
 	void Initialize() override;
 	void Update() override;
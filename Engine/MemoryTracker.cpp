@@ -0,0 +1,332 @@
+#include "stdafx.h"
+#include "MemoryTracker.h"
+
+#include "Telemetry.h"
+
+using namespace std;
+
+namespace
+{
+	constexpr uint32_t HEADER_MAGIC = 0xA110CA7E; // 해제되지 않은 블록 표시 // 이중 해제 확인용
+
+	struct AllocationHeader
+	{
+		uint64_t size = 0;
+		uint32_t magic = 0;
+		MemoryTag tag = MemoryTag::Untagged;
+	};
+	static_assert(sizeof(AllocationHeader) <= MemoryTracker::HEADER_SIZE);
+
+	struct TagStatistics
+	{
+		atomic<int64_t> liveBytes = 0;
+		atomic<int64_t> peakBytes = 0;
+		atomic<int64_t> liveAllocationCount = 0;
+		atomic<uint64_t> allocationCount = 0; // 누적 할당 횟수
+		atomic<uint64_t> allocatedBytes = 0; // 누적 할당 바이트 수
+	};
+
+	// 정적 초기화 전 할당도 셀 수 있도록 상수 초기화
+	constinit array<TagStatistics, MemoryTracker::TAG_COUNT> s_tagStatistics = {};
+	constinit atomic<int64_t> s_totalLiveBytes = 0;
+	constinit atomic<int64_t> s_totalPeakBytes = 0;
+
+	// 최댓값 갱신
+	void UpdatePeak(atomic<int64_t>& peak, int64_t value)
+	{
+		int64_t currentPeak = peak.load(memory_order_relaxed);
+		while (value > currentPeak && !peak.compare_exchange_weak(currentPeak, value, memory_order_relaxed));
+	}
+
+	string FormatBytes(int64_t bytes)
+	{
+		ostringstream stream = {};
+		const double absoluteBytes = static_cast<double>(bytes < 0 ? -bytes : bytes);
+		if (absoluteBytes >= 1024.0 * 1024.0) stream << fixed << setprecision(2) << static_cast<double>(bytes) / (1024.0 * 1024.0) << " MB";
+		else if (absoluteBytes >= 1024.0) stream << fixed << setprecision(2) << static_cast<double>(bytes) / 1024.0 << " KB";
+		else stream << bytes << " B";
+
+		return stream.str();
+	}
+}
+
+// 전역 operator new, delete 교체
+// 정렬 지정 버전까지 모두 교체하므로 이 모듈에서 해제하는 주소는 항상 아래 operator new가 반환한 주소 // 머리는 언제나 같은 블록 안에 있음
+// nothrow 버전의 기본 구현은 아래 버전을 호출하므로 따로 교체하지 않음
+void* operator new(size_t size)
+{
+	void* block = malloc(size + MemoryTracker::HEADER_SIZE);
+	if (!block) throw bad_alloc();
+
+	return MemoryTracker::OnAllocate(block, size);
+}
+
+void* operator new[](size_t size)
+{
+	void* block = malloc(size + MemoryTracker::HEADER_SIZE);
+	if (!block) throw bad_alloc();
+
+	return MemoryTracker::OnAllocate(block, size);
+}
+
+// 정렬 지정 버전은 머리 뒤 사용자 주소가 정렬되도록 머리 앞을 alignment까지 채움
+void* operator new(size_t size, align_val_t alignment)
+{
+	const size_t headerOffset = max(static_cast<size_t>(alignment), MemoryTracker::HEADER_SIZE);
+	void* block = _aligned_malloc(size + headerOffset, headerOffset);
+	if (!block) throw bad_alloc();
+
+	return MemoryTracker::OnAllocate(block, size, headerOffset);
+}
+
+void* operator new[](size_t size, align_val_t alignment)
+{
+	const size_t headerOffset = max(static_cast<size_t>(alignment), MemoryTracker::HEADER_SIZE);
+	void* block = _aligned_malloc(size + headerOffset, headerOffset);
+	if (!block) throw bad_alloc();
+
+	return MemoryTracker::OnAllocate(block, size, headerOffset);
+}
+
+void operator delete(void* memory) noexcept { if (memory) free(MemoryTracker::OnDeallocate(memory)); }
+void operator delete[](void* memory) noexcept { if (memory) free(MemoryTracker::OnDeallocate(memory)); }
+void operator delete(void* memory, size_t) noexcept { if (memory) free(MemoryTracker::OnDeallocate(memory)); }
+void operator delete[](void* memory, size_t) noexcept { if (memory) free(MemoryTracker::OnDeallocate(memory)); }
+void operator delete(void* memory, align_val_t alignment) noexcept { if (memory) _aligned_free(MemoryTracker::OnDeallocate(memory, max(static_cast<size_t>(alignment), MemoryTracker::HEADER_SIZE))); }
+void operator delete[](void* memory, align_val_t alignment) noexcept { if (memory) _aligned_free(MemoryTracker::OnDeallocate(memory, max(static_cast<size_t>(alignment), MemoryTracker::HEADER_SIZE))); }
+void operator delete(void* memory, size_t, align_val_t alignment) noexcept { if (memory) _aligned_free(MemoryTracker::OnDeallocate(memory, max(static_cast<size_t>(alignment), MemoryTracker::HEADER_SIZE))); }
+void operator delete[](void* memory, size_t, align_val_t alignment) noexcept { if (memory) _aligned_free(MemoryTracker::OnDeallocate(memory, max(static_cast<size_t>(alignment), MemoryTracker::HEADER_SIZE))); }
+
+MemoryTracker::MemoryTracker()
+{
+	Telemetry& telemetry = Telemetry::GetInstance();
+	for (size_t i = 0; i < TAG_COUNT; ++i)
+	{
+		m_telemetryCounterIds[i] =
+		{
+			telemetry.RegisterCounter("Memory." + string(TAG_NAMES[i]) + ".Allocations"),
+			telemetry.RegisterCounter("Memory." + string(TAG_NAMES[i]) + ".AllocatedBytes")
+		};
+	}
+
+	m_sceneSnapshot = TakeSnapshot("Startup");
+}
+
+void* MemoryTracker::OnAllocate(void* block, size_t size, size_t headerOffset)
+{
+	const MemoryTag tag = s_currentTag;
+	byte* memory = static_cast<byte*>(block) + headerOffset;
+	::new (memory - HEADER_SIZE) AllocationHeader{ .size = size, .magic = HEADER_MAGIC, .tag = tag };
+
+	TagStatistics& statistics = s_tagStatistics[static_cast<size_t>(tag)];
+	statistics.allocationCount.fetch_add(1, memory_order_relaxed);
+	statistics.allocatedBytes.fetch_add(size, memory_order_relaxed);
+	statistics.liveAllocationCount.fetch_add(1, memory_order_relaxed);
+	UpdatePeak(statistics.peakBytes, statistics.liveBytes.fetch_add(static_cast<int64_t>(size), memory_order_relaxed) + static_cast<int64_t>(size));
+	UpdatePeak(s_totalPeakBytes, s_totalLiveBytes.fetch_add(static_cast<int64_t>(size), memory_order_relaxed) + static_cast<int64_t>(size));
+
+	return memory;
+}
+
+void* MemoryTracker::OnDeallocate(void* memory, size_t headerOffset)
+{
+	AllocationHeader* header = reinterpret_cast<AllocationHeader*>(static_cast<byte*>(memory) - HEADER_SIZE);
+	assert(header->magic == HEADER_MAGIC && "이중 해제이거나 교체한 operator new가 할당하지 않은 주소");
+	header->magic = 0;
+
+	TagStatistics& statistics = s_tagStatistics[static_cast<size_t>(header->tag)];
+	statistics.liveAllocationCount.fetch_sub(1, memory_order_relaxed);
+	statistics.liveBytes.fetch_sub(static_cast<int64_t>(header->size), memory_order_relaxed);
+	s_totalLiveBytes.fetch_sub(static_cast<int64_t>(header->size), memory_order_relaxed);
+
+	return static_cast<byte*>(memory) - headerOffset;
+}
+
+void MemoryTracker::EndFrame()
+{
+	uint64_t frameAllocationCount = 0;
+	uint64_t frameAllocatedBytes = 0;
+
+	for (size_t i = 0; i < TAG_COUNT; ++i)
+	{
+		const TagStatistics& statistics = s_tagStatistics[i];
+		const uint64_t allocationCount = statistics.allocationCount.load(memory_order_relaxed);
+		const uint64_t allocatedBytes = statistics.allocatedBytes.load(memory_order_relaxed);
+
+		m_lastFrameAllocationCounts[i] = allocationCount - m_frameBeginAllocationCounts[i];
+		m_lastFrameAllocatedBytes[i] = allocatedBytes - m_frameBeginAllocatedBytes[i];
+		m_frameBeginAllocationCounts[i] = allocationCount;
+		m_frameBeginAllocatedBytes[i] = allocatedBytes;
+
+		frameAllocationCount += m_lastFrameAllocationCounts[i];
+		frameAllocatedBytes += m_lastFrameAllocatedBytes[i];
+
+		// 예산 확인 // 넘는 순간 한 번만 경고
+		const int64_t liveBytes = statistics.liveBytes.load(memory_order_relaxed);
+		const bool isOverBudget = m_budgets[i] > 0 && liveBytes > m_budgets[i];
+		if (isOverBudget && !m_isOverBudget[i]) cerr << "메모리 예산 초과: " << TAG_NAMES[i] << " " << FormatBytes(liveBytes) << " / " << FormatBytes(m_budgets[i]) << endl;
+		m_isOverBudget[i] = isOverBudget;
+	}
+
+	// 텔레메트리 기록 자체의 할당은 다음 프레임 값에 포함
+	Telemetry& telemetry = Telemetry::GetInstance();
+	for (size_t i = 0; i < TAG_COUNT; ++i)
+	{
+		telemetry.AddCounter(m_telemetryCounterIds[i].first, m_lastFrameAllocationCounts[i]);
+		telemetry.AddCounter(m_telemetryCounterIds[i].second, m_lastFrameAllocatedBytes[i]);
+	}
+	TELEMETRY_COUNT("Memory.HeapAllocations", frameAllocationCount);
+	TELEMETRY_COUNT("Memory.HeapAllocatedBytes", frameAllocatedBytes);
+}
+
+bool MemoryTracker::LoadBudgets(const filesystem::path& filePath)
+{
+	ifstream file(filePath);
+	if (!file)
+	{
+		cerr << "메모리 예산 파일 열기 실패: " << filePath.string() << endl;
+		return false;
+	}
+
+	const nlohmann::json jsonData = nlohmann::json::parse(file, nullptr, false);
+	if (jsonData.is_discarded() || !jsonData.is_object())
+	{
+		cerr << "메모리 예산 파일 파싱 실패: " << filePath.string() << endl;
+		return false;
+	}
+
+	for (const auto& [tagName, megabytes] : jsonData.items())
+	{
+		const auto tagIt = find_if(TAG_NAMES.begin(), TAG_NAMES.end(), [&](const char* name) { return tagName == name; });
+		if (tagIt == TAG_NAMES.end())
+		{
+			cerr << "알 수 없는 메모리 태그: " << tagName << endl;
+			continue;
+		}
+
+		SetBudget(static_cast<MemoryTag>(tagIt - TAG_NAMES.begin()), static_cast<size_t>(megabytes.get<double>() * 1024.0 * 1024.0));
+	}
+
+	return true;
+}
+
+uint64_t MemoryTracker::GetTotalAllocationCount()
+{
+	uint64_t allocationCount = 0;
+	for (const TagStatistics& statistics : s_tagStatistics) allocationCount += statistics.allocationCount.load(memory_order_relaxed);
+
+	return allocationCount;
+}
+
+MemorySnapshot MemoryTracker::TakeSnapshot(const string& label) const
+{
+	MemorySnapshot snapshot = { .label = label };
+	for (size_t i = 0; i < TAG_COUNT; ++i)
+	{
+		snapshot.liveBytes[i] = s_tagStatistics[i].liveBytes.load(memory_order_relaxed);
+		snapshot.liveAllocationCounts[i] = s_tagStatistics[i].liveAllocationCount.load(memory_order_relaxed);
+	}
+
+	return snapshot;
+}
+
+MemorySnapshot MemoryTracker::Diff(const MemorySnapshot& from, const MemorySnapshot& to)
+{
+	MemorySnapshot diff = { .label = from.label + " -> " + to.label };
+	for (size_t i = 0; i < TAG_COUNT; ++i)
+	{
+		diff.liveBytes[i] = to.liveBytes[i] - from.liveBytes[i];
+		diff.liveAllocationCounts[i] = to.liveAllocationCounts[i] - from.liveAllocationCounts[i];
+	}
+
+	return diff;
+}
+
+void MemoryTracker::PrintSnapshot(const MemorySnapshot& snapshot)
+{
+	cout << "[메모리] " << snapshot.label << endl;
+	for (size_t i = 0; i < TAG_COUNT; ++i)
+	{
+		if (snapshot.liveBytes[i] == 0 && snapshot.liveAllocationCounts[i] == 0) continue;
+		cout << setw(12) << left << TAG_NAMES[i] << FormatBytes(snapshot.liveBytes[i]) << " (" << snapshot.liveAllocationCounts[i] << "개)" << endl;
+	}
+}
+
+void MemoryTracker::OnSceneLoadStarted()
+{
+	m_sceneLoadSnapshot = TakeSnapshot("Load");
+	m_preloadedSceneDiff = {};
+}
+
+void MemoryTracker::OnSceneLoadFinished()
+{
+	m_preloadedSceneDiff = Diff(m_sceneLoadSnapshot, TakeSnapshot("Loaded"));
+}
+
+void MemoryTracker::OnSceneChanged(const string& nextSceneName)
+{
+	// 직전 전환 시점과 같은 위치에서 찍으므로 차이는 이전 씬이 해제하지 않고 남긴 메모리 // 캐시 증가분도 포함
+	// 백그라운드로 미리 읽은 다음 씬 데이터는 이미 살아 있으므로 빼고 비교 // 다음 비교 기준에서도 제외
+	MemorySnapshot snapshot = TakeSnapshot(nextSceneName);
+	for (size_t i = 0; i < TAG_COUNT; ++i)
+	{
+		snapshot.liveBytes[i] -= m_preloadedSceneDiff.liveBytes[i];
+		snapshot.liveAllocationCounts[i] -= m_preloadedSceneDiff.liveAllocationCounts[i];
+	}
+	m_preloadedSceneDiff = {};
+
+	m_lastSceneDiff = Diff(m_sceneSnapshot, snapshot);
+	PrintSnapshot(m_lastSceneDiff);
+
+	m_sceneSnapshot = move(snapshot);
+}
+
+int64_t MemoryTracker::GetLiveBytes(MemoryTag tag) const { return s_tagStatistics[static_cast<size_t>(tag)].liveBytes.load(memory_order_relaxed); }
+int64_t MemoryTracker::GetPeakBytes(MemoryTag tag) const { return s_tagStatistics[static_cast<size_t>(tag)].peakBytes.load(memory_order_relaxed); }
+int64_t MemoryTracker::GetTotalLiveBytes() const { return s_totalLiveBytes.load(memory_order_relaxed); }
+int64_t MemoryTracker::GetTotalPeakBytes() const { return s_totalPeakBytes.load(memory_order_relaxed); }
+
+#ifdef _DEBUG
+void MemoryTracker::RenderImGui()
+{
+	ImGui::Begin("Memory");
+
+	ImGui::Text("Live %s, Peak %s", FormatBytes(GetTotalLiveBytes()).c_str(), FormatBytes(GetTotalPeakBytes()).c_str());
+
+	if (ImGui::BeginTable("Tags", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+	{
+		ImGui::TableSetupColumn("Tag");
+		ImGui::TableSetupColumn("Live");
+		ImGui::TableSetupColumn("Peak");
+		ImGui::TableSetupColumn("Allocs/Frame");
+		ImGui::TableSetupColumn("Budget");
+		ImGui::TableHeadersRow();
+
+		for (size_t i = 0; i < TAG_COUNT; ++i)
+		{
+			const TagStatistics& statistics = s_tagStatistics[i];
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::Text("%s", TAG_NAMES[i]);
+			ImGui::TableNextColumn();
+			if (m_isOverBudget[i]) ImGui::TextColored({ 1.0f, 0.3f, 0.3f, 1.0f }, "%s", FormatBytes(statistics.liveBytes.load(memory_order_relaxed)).c_str());
+			else ImGui::Text("%s", FormatBytes(statistics.liveBytes.load(memory_order_relaxed)).c_str());
+			ImGui::TableNextColumn(); ImGui::Text("%s", FormatBytes(statistics.peakBytes.load(memory_order_relaxed)).c_str());
+			ImGui::TableNextColumn(); ImGui::Text("%llu", m_lastFrameAllocationCounts[i]);
+			ImGui::TableNextColumn(); ImGui::Text("%s", m_budgets[i] > 0 ? FormatBytes(m_budgets[i]).c_str() : "-");
+		}
+
+		ImGui::EndTable();
+	}
+
+	ImGui::Separator();
+	ImGui::Text("Scene diff: %s", m_lastSceneDiff.label.c_str());
+	for (size_t i = 0; i < TAG_COUNT; ++i)
+	{
+		if (m_lastSceneDiff.liveBytes[i] == 0) continue;
+		ImGui::Text("%s: %s (%lld)", TAG_NAMES[i], FormatBytes(m_lastSceneDiff.liveBytes[i]).c_str(), m_lastSceneDiff.liveAllocationCounts[i]);
+	}
+
+	ImGui::End();
+}
+#endif
@@ -0,0 +1,123 @@
+#pragma once
+
+// 힙 할당 분류 태그
+enum class MemoryTag : uint8_t
+{
+	Untagged,
+	Texture, // 텍스처 데이터 캐시
+	Model, // 모델, 메쉬
+	Animation, // 애니메이션 클립
+	Prefab, // 프리팹 캐시
+	Node, // 노트 데이터
+	Scene, // 씬, 게임 오브젝트, 컴포넌트
+
+	Count
+};
+
+// 범위 안에서 이 스레드의 힙 할당을 태그로 분류 // 중첩되면 안쪽 태그 우선
+#define MEMORY_TAG_SCOPE(tag) const MemoryTagScope memoryTagScope(tag)
+
+// 태그별 현재 메모리 상태
+struct MemorySnapshot
+{
+	std::string label = {};
+	std::array<int64_t, static_cast<size_t>(MemoryTag::Count)> liveBytes = {};
+	std::array<int64_t, static_cast<size_t>(MemoryTag::Count)> liveAllocationCounts = {};
+};
+
+// 힙 할당 추적
+// 전역 operator new, delete를 교체해 할당마다 크기와 태그를 머리에 기록 // 태그별 현재, 최대 사용량과 프레임당 할당 횟수 집계
+// 태그별 예산을 넘으면 경고 // 씬 전환마다 스냅숏을 찍어 이전 씬이 남긴 메모리 출력
+class MemoryTracker : public Singleton<MemoryTracker>
+{
+	friend class Singleton<MemoryTracker>;
+
+public:
+	static constexpr size_t HEADER_SIZE = 16; // 할당 머리 크기 // 반환 주소의 16바이트 정렬 유지
+	static constexpr size_t TAG_COUNT = static_cast<size_t>(MemoryTag::Count);
+	static constexpr std::array<const char*, TAG_COUNT> TAG_NAMES = { "Untagged", "Texture", "Model", "Animation", "Prefab", "Node", "Scene" };
+
+private:
+	// 태그별 누적 통계는 정적 초기화 전 할당도 셀 수 있도록 MemoryTracker.cpp의 상수 초기화 전역 변수에 둠
+	static inline thread_local MemoryTag s_currentTag = MemoryTag::Untagged;
+
+	std::array<uint64_t, TAG_COUNT> m_frameBeginAllocationCounts = {};
+	std::array<uint64_t, TAG_COUNT> m_frameBeginAllocatedBytes = {};
+	std::array<uint64_t, TAG_COUNT> m_lastFrameAllocationCounts = {}; // 직전 프레임 할당 횟수
+	std::array<uint64_t, TAG_COUNT> m_lastFrameAllocatedBytes = {}; // 직전 프레임 할당 바이트 수
+	std::array<std::pair<size_t, size_t>, TAG_COUNT> m_telemetryCounterIds = {}; // 할당 횟수, 바이트 수 카운터
+
+	std::array<int64_t, TAG_COUNT> m_budgets = {}; // 태그별 예산 // 0이면 없음
+	std::array<bool, TAG_COUNT> m_isOverBudget = {}; // 예산 초과 경고를 이미 냈는지 // 예산 아래로 내려가면 다시 경고
+
+	MemorySnapshot m_sceneSnapshot = {}; // 직전 씬 전환 시점 스냅숏 // 미리 읽은 다음 씬 데이터는 제외
+	MemorySnapshot m_sceneLoadSnapshot = {}; // 다음 씬 백그라운드 읽기 시작 시점 스냅숏
+	MemorySnapshot m_preloadedSceneDiff = {}; // 백그라운드 읽기 동안 늘어난 메모리 // 다음 씬 몫
+	MemorySnapshot m_lastSceneDiff = {}; // 직전 씬이 남긴 메모리
+
+public:
+	~MemoryTracker() = default;
+	MemoryTracker(const MemoryTracker&) = delete;
+	MemoryTracker& operator=(const MemoryTracker&) = delete;
+	MemoryTracker(MemoryTracker&&) = delete;
+	MemoryTracker& operator=(MemoryTracker&&) = delete;
+
+	// 전역 operator new, delete 전용 // headerOffset은 블록 시작부터 사용자 주소까지 거리 // 머리는 사용자 주소 바로 앞
+	// 머리 기록 후 사용자 주소 반환
+	static void* OnAllocate(void* block, size_t size, size_t headerOffset = HEADER_SIZE);
+	// 머리를 지우고 블록 주소 반환 // 교체한 operator new가 반환한 주소만 받음
+	static void* OnDeallocate(void* memory, size_t headerOffset = HEADER_SIZE);
+
+	static MemoryTag GetCurrentTag() { return s_currentTag; }
+	static void SetCurrentTag(MemoryTag tag) { s_currentTag = tag; }
+
+	// 프레임 종료 시 호출 // 할당률을 텔레메트리 카운터로 기록하고 예산 확인 // Telemetry::EndFrame 전에 호출해야 같은 프레임 값으로 기록됨
+	void EndFrame();
+
+	// 예산 설정 // 0이면 해제
+	void SetBudget(MemoryTag tag, size_t bytes) { m_budgets[static_cast<size_t>(tag)] = static_cast<int64_t>(bytes); }
+	// { "태그 이름": 메가바이트, ... } 형식 JSON 파일에서 예산 읽기 // 실패하면 false
+	bool LoadBudgets(const std::filesystem::path& filePath);
+
+	MemorySnapshot TakeSnapshot(const std::string& label) const;
+	// to - from // 0이 아닌 태그만 출력
+	static MemorySnapshot Diff(const MemorySnapshot& from, const MemorySnapshot& to);
+	static void PrintSnapshot(const MemorySnapshot& snapshot);
+
+	// 다음 씬 백그라운드 읽기 시작 전, 완료 직후 호출 // 그 사이 늘어난 메모리는 이전 씬이 남긴 메모리에서 제외
+	// 읽는 동안 메인 스레드가 할당한 메모리도 함께 제외되므로 근삿값
+	void OnSceneLoadStarted();
+	void OnSceneLoadFinished();
+	// 이전 씬 해제 후, 다음 씬 초기화 전에 호출 // 직전 씬 전환 시점과 비교해 이전 씬이 남긴 메모리 출력
+	void OnSceneChanged(const std::string& nextSceneName);
+
+	int64_t GetLiveBytes(MemoryTag tag) const;
+	int64_t GetPeakBytes(MemoryTag tag) const;
+	int64_t GetTotalLiveBytes() const;
+	int64_t GetTotalPeakBytes() const;
+	uint64_t GetLastFrameAllocationCount(MemoryTag tag) const { return m_lastFrameAllocationCounts[static_cast<size_t>(tag)]; }
+	// 실행 후 모든 태그의 누적 할당 횟수 // 구간 전후 차이로 구간 안 할당 횟수 측정
+	static uint64_t GetTotalAllocationCount();
+
+	#ifdef _DEBUG
+	// 태그별 사용량, 예산, 직전 씬 차이 창
+	void RenderImGui();
+	#endif
+
+private:
+	MemoryTracker();
+};
+
+// MEMORY_TAG_SCOPE 구현
+class MemoryTagScope
+{
+	MemoryTag m_previousTag = MemoryTag::Untagged;
+
+public:
+	explicit MemoryTagScope(MemoryTag tag) : m_previousTag(MemoryTracker::GetCurrentTag()) { MemoryTracker::SetCurrentTag(tag); }
+	~MemoryTagScope() { MemoryTracker::SetCurrentTag(m_previousTag); }
+	MemoryTagScope(const MemoryTagScope&) = delete;
+	MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+	MemoryTagScope(MemoryTagScope&&) = delete;
+	MemoryTagScope& operator=(MemoryTagScope&&) = delete;
+};
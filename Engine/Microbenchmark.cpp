@@ -0,0 +1,12 @@
+#include "stdafx.h"
+#include "Microbenchmark.h"
+
+using namespace std;
+
+void Microbenchmarks::Run()
+{
+	// 등록 순서는 번역 단위 초기화 순서라 정해져 있지 않음
+	sort(m_benchmarks.begin(), m_benchmarks.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+	for (const auto& [name, function] : m_benchmarks) function();
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// 마이크로벤치마크 등록 // Name은 식별자 // --microbench 실행 인자로 모든 등록 항목을 이름 순서대로 실행
+// REGISTER_TYPE처럼 정적 초기화 때 등록하므로, 정적 라이브러리에서 다른 곳이 참조하지 않는 번역 단위의 등록은 링커가 버릴 수 있음
+#define REGISTER_MICROBENCHMARK(Name, ...) namespace { bool s_##Name##_microbenchmarkRegistered = (Microbenchmarks::GetInstance().Register(#Name, __VA_ARGS__), true); }
+
+// 마이크로벤치마크 입력을 만드는 난수 시드 // 실행마다 같은 입력으로 결과 비교
+constexpr uint32_t MICROBENCHMARK_SEED = 12345;
+
+// 함수를 한 번 실행하는 데 걸린 시간 // 밀리초 단위
+template<typename F>
+double MeasureMilliseconds(F&& function)
+{
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	function();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+// 마이크로벤치마크 목록
+class Microbenchmarks : public Singleton<Microbenchmarks>
+{
+	friend class Singleton<Microbenchmarks>;
+
+	std::vector<std::pair<std::string, std::function<void()>>> m_benchmarks = {}; // 이름, 실행 함수
+
+public:
+	~Microbenchmarks() = default;
+	Microbenchmarks(const Microbenchmarks&) = delete;
+	Microbenchmarks& operator=(const Microbenchmarks&) = delete;
+	Microbenchmarks(Microbenchmarks&&) = delete;
+	Microbenchmarks& operator=(Microbenchmarks&&) = delete;
+
+	void Register(const std::string& name, std::function<void()> function) { m_benchmarks.emplace_back(name, std::move(function)); }
+	// 등록된 벤치마크를 이름 순서대로 실행 // 결과는 각 벤치마크가 콘솔에 출력
+	void Run();
+
+private:
+	Microbenchmarks() = default;
+};
@@ -2,9 +2,11 @@
 #include "ModelComponent.h"
 
 #include "Renderer.h"
+#include "RenderBackend.h"
 #include "ResourceManager.h"
 #include "GameObjectBase.h"
 #include "CameraComponent.h"
+#include "Telemetry.h"
 
 using namespace std;
 using namespace DirectX;
@@ -48,11 +50,25 @@ void ModelComponent::Initialize()
 	m_materialFactorConstantBuffer = resourceManager.GetConstantBuffer(PSConstBuffers::MaterialFactor);
 	m_dissolveConstantBuffer = resourceManager.GetConstantBuffer(PSConstBuffers::Dissolve);
 
-	s_modelComponents.emplace_back(this);
+	m_initialMaterialFactors.clear();
+	for (const auto& [model, material] : m_modelsAndMaterials) m_initialMaterialFactors.push_back(material.m_materialFactor);
+	m_initialDissolveData = m_dissolveData;
+	m_initialBlendState = m_blendState;
+
+	AddToModelComponents();
 }
 
 void ModelComponent::Update()
 {
+	// 소유 게임 오브젝트가 움직였거나 원본 경계 상자가 바뀌었을 때만 변환
+	if (!m_owner->NeedsBoundsUpdate(m_boundingBoxVersion))
+	{
+		TELEMETRY_COUNT("Model.BoundsTransformsSkipped", 1);
+		return;
+	}
+	TELEMETRY_COUNT("Model.BoundsTransforms", 1);
+
+	m_boundingBoxVersion = m_owner->GetTransformVersion();
 	m_boundingBox.Transform(m_transformedbBoundingBox, m_owner->GetWorldMatrix());
 }
 
@@ -79,8 +95,8 @@ void ModelComponent::Render()
 			resourceManager.SetRasterState(m_rasterState);
 
 			// 상수 버퍼 업데이트
-			m_deviceContext->UpdateSubresource(m_worldNormalConstantBuffer.Get(), 0, nullptr, m_worldNormalData, 0, 0);
-			m_deviceContext->UpdateSubresource(m_dissolveConstantBuffer.Get(), 0, nullptr, &m_dissolveData, 0, 0);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_worldNormalConstantBuffer.Get(), m_worldNormalData);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_dissolveConstantBuffer.Get(), &m_dissolveData);
 
 			m_deviceContext->IASetInputLayout(m_vertexShaderAndInputLayout.second.Get());
 			m_deviceContext->VSSetShader(m_vertexShaderAndInputLayout.first.Get(), nullptr, 0);
@@ -96,7 +112,7 @@ void ModelComponent::Render()
 				m_deviceContext->PSSetShaderResources(static_cast<UINT>(TextureSlots::Noise), 1, resourceManager.GetNoise(m_selectedNoiseIndex).GetAddressOf());
 
 				// 재질 팩터 설정
-				m_deviceContext->UpdateSubresource(m_materialFactorConstantBuffer.Get(), 0, nullptr, &material.m_materialFactor, 0, 0);
+				RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_materialFactorConstantBuffer.Get(), &material.m_materialFactor);
 
 				for (const Mesh& mesh : model->meshes)
 				{
@@ -107,7 +123,7 @@ void ModelComponent::Render()
 
 					m_deviceContext->IASetVertexBuffers(0, 1, mesh.vertexBuffer.GetAddressOf(), &STRIDE, &OFFSET);
 					m_deviceContext->IASetIndexBuffer(mesh.indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
-					m_deviceContext->DrawIndexed(mesh.indexCount, 0, 0);
+					RenderBackend::GetInstance().DrawIndexed(m_deviceContext.Get(), mesh.indexCount, 0, 0);
 				}
 			}
 		}
@@ -125,7 +141,7 @@ void ModelComponent::Render()
 			resourceManager.SetRasterState(m_rasterState);
 
 			// 상수 버퍼 업데이트
-			m_deviceContext->UpdateSubresource(m_worldNormalConstantBuffer.Get(), 0, nullptr, m_worldNormalData, 0, 0);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_worldNormalConstantBuffer.Get(), m_worldNormalData);
 
 			m_deviceContext->IASetInputLayout(m_vertexShaderAndInputLayout.second.Get());
 			m_deviceContext->VSSetShader(m_vertexShaderAndInputLayout.first.Get(), nullptr, 0);
@@ -143,7 +159,7 @@ void ModelComponent::Render()
 					constexpr UINT OFFSET = 0;
 					m_deviceContext->IASetVertexBuffers(0, 1, mesh.vertexBuffer.GetAddressOf(), &STRIDE, &OFFSET);
 					m_deviceContext->IASetIndexBuffer(mesh.indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
-					m_deviceContext->DrawIndexed(mesh.indexCount, 0, 0);
+					RenderBackend::GetInstance().DrawIndexed(m_deviceContext.Get(), mesh.indexCount, 0, 0);
 				}
 			}
 		}
@@ -181,8 +197,8 @@ void ModelComponent::Render()
 					lineBufferData.linePoints[1] = XMFLOAT4{ boxVertices[endIndex].x, boxVertices[endIndex].y, boxVertices[endIndex].z, 1.0f };
 					lineBufferData.lineColors[0] = XMFLOAT4{ 1.0f, 1.0f, 1.0f, 1.0f };
 					lineBufferData.lineColors[1] = XMFLOAT4{ 1.0f, 1.0f, 1.0f, 1.0f };
-					m_deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-					m_deviceContext->Draw(2, 0);
+					RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+					RenderBackend::GetInstance().Draw(m_deviceContext.Get(), 2, 0);
 				}
 			}
 
@@ -202,8 +218,8 @@ void ModelComponent::Render()
 							lineBufferData.linePoints[1] = XMFLOAT4{ boxVertices[endIndex].x, boxVertices[endIndex].y, boxVertices[endIndex].z, 1.0f };
 							lineBufferData.lineColors[0] = XMFLOAT4{ 1.0f, 1.0f, 1.0f, 1.0f };
 							lineBufferData.lineColors[1] = XMFLOAT4{ 1.0f, 1.0f, 1.0f, 1.0f };
-							m_deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-							m_deviceContext->Draw(2, 0);
+							RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+							RenderBackend::GetInstance().Draw(m_deviceContext.Get(), 2, 0);
 						}
 					}
 				}
@@ -364,8 +380,16 @@ void ModelComponent::RenderImGui()
 
 void ModelComponent::Finalize()
 {
-	auto it = find(s_modelComponents.begin(), s_modelComponents.end(), this);
-	if (it != s_modelComponents.end()) s_modelComponents.erase(it);
+	RemoveFromModelComponents();
+}
+
+void ModelComponent::Reactivate()
+{
+	for (size_t i = 0; i < m_modelsAndMaterials.size() && i < m_initialMaterialFactors.size(); ++i) m_modelsAndMaterials[i].second.m_materialFactor = m_initialMaterialFactors[i];
+	m_dissolveData = m_initialDissolveData;
+	m_blendState = m_initialBlendState;
+
+	AddToModelComponents();
 }
 
 nlohmann::json ModelComponent::Serialize()
@@ -513,4 +537,25 @@ void ModelComponent::UpdateBoundingBox()
 {
 	m_boundingBox = {};
 	for (const auto& [model, material] : m_modelsAndMaterials) BoundingBox::CreateMerged(m_boundingBox, m_boundingBox, model->boundingBox);
+	m_boundingBoxVersion = 0;
+}
+
+void ModelComponent::AddToModelComponents()
+{
+	if (m_modelComponentIndex != INVALID_MODEL_COMPONENT_INDEX) return;
+
+	m_modelComponentIndex = s_modelComponents.size();
+	s_modelComponents.push_back(this);
+}
+
+void ModelComponent::RemoveFromModelComponents()
+{
+	if (m_modelComponentIndex == INVALID_MODEL_COMPONENT_INDEX) return;
+
+	ModelComponent* last = s_modelComponents.back();
+	s_modelComponents[m_modelComponentIndex] = last;
+	last->m_modelComponentIndex = m_modelComponentIndex;
+	s_modelComponents.pop_back();
+
+	m_modelComponentIndex = INVALID_MODEL_COMPONENT_INDEX;
 }
@@ -4,7 +4,9 @@
 
 class ModelComponent : public ComponentBase
 {
-	static std::vector<ModelComponent*> s_modelComponents; // 모든 모델 컴포넌트 배열
+	static constexpr size_t INVALID_MODEL_COMPONENT_INDEX = std::numeric_limits<size_t>::max();
+	static std::vector<ModelComponent*> s_modelComponents; // 등록된 모델 컴포넌트 배열 // 순서 없음
+	size_t m_modelComponentIndex = INVALID_MODEL_COMPONENT_INDEX; // s_modelComponents 내 인덱스
 
 protected:
 	com_ptr<ID3D11DeviceContext> m_deviceContext = nullptr; // 디바이스 컨텍스트
@@ -38,6 +40,7 @@ protected:
 
 	DirectX::BoundingBox m_boundingBox = {}; // 원본 경계 상자
 	DirectX::BoundingBox m_transformedbBoundingBox = {}; // 변환된 경계 상자
+	uint32_t m_boundingBoxVersion = 0; // 변환된 경계 상자를 마지막으로 계산한 소유 게임 오브젝트 변환 버전 // 원본이 바뀌면 0
 
 	BlendState m_blendState = BlendState::Opaque; // 기본 블렌드 상태
 	RasterState m_rasterState = RasterState::Solid; // 기본 래스터 상태
@@ -51,6 +54,11 @@ protected:
 
 	int m_selectedNoiseIndex = 0;
 
+	// 풀 재사용 시 복원할 초기 값
+	std::vector<MaterialFactorBuffer> m_initialMaterialFactors = {}; // 초기 재질 상수 버퍼 데이터 배열
+	DissolveBuffer m_initialDissolveData = {}; // 초기 디졸브 상수 버퍼 데이터
+	BlendState m_initialBlendState = BlendState::Opaque; // 초기 블렌드 상태
+
 public:
 	ModelComponent() = default;
 	virtual ~ModelComponent() override = default;
@@ -77,6 +85,13 @@ public:
 	bool NeedsUpdate() const override { return true; }
 	bool NeedsRender() const override { return true; }
 
+	// 업데이트는 자기 월드 경계만 갱신 // 선택 광선 검사는 단계 밖 메인 스레드에서 읽음 // 렌더링은 메인 카메라 읽기
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override
+	{
+		if (phase == FramePhase::Render) return { .read = FrameAccess::Camera };
+		return {};
+	}
+
 protected:
 	void Initialize() override;
 	void Update() override;
@@ -86,6 +101,13 @@ protected:
 	#endif
 	void Finalize() override;
 
+	// 풀 재사용 시 셰이더 및 상수 버퍼 조회 없이 초기 값 복원 후 다시 등록
+	void Reactivate() override;
+
+	// 비활성화 동안 선택(피킹) 대상에서 제외
+	void OnEnable() override { AddToModelComponents(); }
+	void OnDisable() override { RemoveFromModelComponents(); }
+
 	nlohmann::json Serialize() override;
 	void Deserialize(const nlohmann::json& jsonData) override;
 
@@ -94,4 +116,10 @@ protected:
 
 	// 경계 상자 갱신
 	void UpdateBoundingBox();
+
+private:
+	// 선택 대상 배열에 등록 // 이미 등록되어 있으면 무시
+	void AddToModelComponents();
+	// 선택 대상 배열에서 해제 // 마지막 원소를 빈 자리로 옮김
+	void RemoveFromModelComponents();
 };
\ No newline at end of file
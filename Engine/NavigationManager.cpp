@@ -1,8 +1,11 @@
 #include "stdafx.h"
 #include "NavigationManager.h"
 
+#include "Telemetry.h"
+
 #ifdef _DEBUG
 #include "Renderer.h"
+#include "RenderBackend.h"
 #include "ResourceManager.h"
 #include "InputManager.h"
 #include "CameraComponent.h"
@@ -133,6 +136,7 @@ void NavigationManager::RenderNavMesh()
 		{
 			ResourceManager& resourceManager = ResourceManager::GetInstance();
 			com_ptr<ID3D11DeviceContext> deviceContext = Renderer::GetInstance().GetDeviceContext();
+			RenderBackend& renderBackend = RenderBackend::GetInstance();
 
 			deviceContext->IASetInputLayout(m_navMeshVertexShaderAndInputLayout.second.Get());
 			deviceContext->VSSetShader(m_navMeshVertexShaderAndInputLayout.first.Get(), nullptr, 0);
@@ -160,18 +164,18 @@ void NavigationManager::RenderNavMesh()
 				lineBufferData.linePoints[1] = XMFLOAT4{ fb.x, fb.y, fb.z, 1.0f };
 				lineBufferData.lineColors[0] = XMFLOAT4{ 0.0f, 1.0f, 1.0f, 1.0f };
 				lineBufferData.lineColors[1] = XMFLOAT4{ 0.0f, 1.0f, 1.0f, 1.0f };
-				deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-				deviceContext->Draw(2, 0);
+				renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+				renderBackend.Draw(deviceContext.Get(), 2, 0);
 
 				lineBufferData.linePoints[0] = XMFLOAT4{ fb.x, fb.y, fb.z, 1.0f };
 				lineBufferData.linePoints[1] = XMFLOAT4{ fc.x, fc.y, fc.z, 1.0f };
-				deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-				deviceContext->Draw(2, 0);
+				renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+				renderBackend.Draw(deviceContext.Get(), 2, 0);
 
 				lineBufferData.linePoints[0] = XMFLOAT4{ fc.x, fc.y, fc.z, 1.0f };
 				lineBufferData.linePoints[1] = XMFLOAT4{ fa.x, fa.y, fa.z, 1.0f };
-				deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-				deviceContext->Draw(2, 0);
+				renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+				renderBackend.Draw(deviceContext.Get(), 2, 0);
 			}
 
 			if (m_previewLine.first >= 0 && m_previewLine.second >= 0)
@@ -180,15 +184,15 @@ void NavigationManager::RenderNavMesh()
 				XMStoreFloat4(&lineBufferData.linePoints[1], m_vertices[m_previewLine.first]);
 				lineBufferData.lineColors[0] = XMFLOAT4{ 1.0f, 0.0f, 0.0f, 1.0f };
 				lineBufferData.lineColors[1] = XMFLOAT4{ 1.0f, 0.0f, 0.0f, 1.0f };
-				deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-				deviceContext->Draw(2, 0);
+				renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+				renderBackend.Draw(deviceContext.Get(), 2, 0);
 
 				XMStoreFloat4(&lineBufferData.linePoints[0], m_previewPoint);
 				XMStoreFloat4(&lineBufferData.linePoints[1], m_vertices[m_previewLine.second]);
 				lineBufferData.lineColors[0] = XMFLOAT4{ 0.0f, 1.0f, 0.0f, 1.0f };
 				lineBufferData.lineColors[1] = XMFLOAT4{ 0.0f, 1.0f, 0.0f, 1.0f };
-				deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-				deviceContext->Draw(2, 0);
+				renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+				renderBackend.Draw(deviceContext.Get(), 2, 0);
 			}
 
 			if (m_pathStartSet && m_currentPath.empty())
@@ -199,8 +203,8 @@ void NavigationManager::RenderNavMesh()
 				lineBufferData.linePoints[1] = XMFLOAT4{ sp.x + 0.1f, sp.y, sp.z, 1.0f };
 				lineBufferData.lineColors[0] = XMFLOAT4{ 1.0f, 1.0f, 0.0f, 1.0f };
 				lineBufferData.lineColors[1] = XMFLOAT4{ 1.0f, 1.0f, 0.0f, 1.0f };
-				deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-				deviceContext->Draw(2, 0);
+				renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+				renderBackend.Draw(deviceContext.Get(), 2, 0);
 			}
 
 			if (!m_currentPath.empty())
@@ -215,8 +219,8 @@ void NavigationManager::RenderNavMesh()
 					lineBufferData.linePoints[1] = XMFLOAT4{ p1.x, p1.y + 1.0f, p1.z, 1.0f };
 					lineBufferData.lineColors[0] = XMFLOAT4{ 0.0f, 1.0f, 0.0f, 1.0f };
 					lineBufferData.lineColors[1] = XMFLOAT4{ 0.0f, 1.0f, 0.0f, 1.0f };
-					deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-					deviceContext->Draw(2, 0);
+					renderBackend.UpdateSubresource(deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+					renderBackend.Draw(deviceContext.Get(), 2, 0);
 				}
 			}
 		}
@@ -335,6 +339,8 @@ deque<XMVECTOR> NavigationManager::FindPath(const XMVECTOR& start, const XMVECTO
 {
 	if (m_navPolys.empty()) return {};
 
+	TELEMETRY_COUNT("Navigation.FindPathCalls", 1);
+
 	int startPoly = FindNearestPoly(start);
 	int endPoly = FindNearestPoly(end);
 
@@ -351,13 +357,15 @@ deque<XMVECTOR> NavigationManager::FindPath(const XMVECTOR& start, const XMVECTO
 	};
 	auto heuristic = [&](int a, int b) { return XMVectorGetX(XMVector3Length(XMVectorSubtract(m_navPolys[a].centroid, m_navPolys[b].centroid))); };
 
-	unordered_map<int, Node> nodes = {};
-	priority_queue<pair<float, int>, vector<pair<float, int>>, greater<>> openSet;
+	// 탐색용 임시 컨테이너는 프레임 아레나에 할당 // 반환하는 경로만 힙에 할당
+	FrameUnorderedMap<int, Node> nodes = {};
+	priority_queue<pair<float, int>, FrameVector<pair<float, int>>, greater<>> openSet;
 
 	nodes[startPoly] = { startPoly, 0.0f, heuristic(startPoly, endPoly), -1 };
 	openSet.push({ nodes[startPoly].f, startPoly });
 
 	bool found = false;
+	size_t expansionCount = 0; // 이웃을 펼친 노드 수
 	while (!openSet.empty())
 	{
 		float poppedF = openSet.top().first;
@@ -370,6 +378,8 @@ deque<XMVECTOR> NavigationManager::FindPath(const XMVECTOR& start, const XMVECTO
 		if (poppedF > itNode->second.f + numeric_limits<float>::epsilon() * max(1.0f, max(fabs(poppedF), fabs(itNode->second.f)))) continue;
 		if (currentPoly == endPoly) { found = true; break; }
 
+		expansionCount++;
+
 		for (int edgeIndex = 0; edgeIndex < 3; ++edgeIndex)
 		{
 			int neighborPoly = m_navPolys[currentPoly].neighbors[edgeIndex];
@@ -391,9 +401,12 @@ deque<XMVECTOR> NavigationManager::FindPath(const XMVECTOR& start, const XMVECTO
 			}
 		}
 	}
+	TELEMETRY_COUNT("Navigation.AStarExpansions", expansionCount);
+	TELEMETRY_SAMPLE("Navigation.AStarExpansionsPerPath", expansionCount);
+
 	if (!found) return {};
 
-	vector<int> polyPath = {};
+	FrameVector<int> polyPath = {};
 	int currentPoly = endPoly;
 	while (currentPoly != -1)
 	{
@@ -402,7 +415,7 @@ deque<XMVECTOR> NavigationManager::FindPath(const XMVECTOR& start, const XMVECTO
 	}
 	reverse(polyPath.begin(), polyPath.end());
 
-	vector<pair<XMVECTOR, XMVECTOR>> portals = {};
+	FrameVector<pair<XMVECTOR, XMVECTOR>> portals = {};
 	for (size_t i = 0; i + 1 < polyPath.size(); ++i)
 	{
 		bool foundEdge = false;
@@ -454,7 +467,7 @@ bool NavigationManager::PointInTriangle(const XMVECTOR& point, const array<int,
 	return (u >= 0) && (v >= 0) && (u + v < 1);
 }
 
-deque<XMVECTOR> NavigationManager::StringPull(const XMVECTOR& start, const XMVECTOR& end, const vector<pair<XMVECTOR, XMVECTOR>>& portals) const
+deque<XMVECTOR> NavigationManager::StringPull(const XMVECTOR& start, const XMVECTOR& end, const FrameVector<pair<XMVECTOR, XMVECTOR>>& portals) const
 {
 	deque<XMVECTOR> result = {};
 
@@ -0,0 +1,138 @@
+#include "stdafx.h"
+#include "ObjectPoolManager.h"
+
+#include "SceneManager.h"
+#include "Telemetry.h"
+
+using namespace std;
+
+void ObjectPoolManager::WarmUp(const string& prefabFileName, size_t count)
+{
+	if (!SceneManager::GetInstance().GetPrefabData(prefabFileName)) return;
+
+	ObjectPool& pool = m_pools[prefabFileName];
+	pool.freeList.reserve(pool.freeList.size() + count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		unique_ptr<GameObjectBase> gameObject = CreateFromPrefab(prefabFileName, nullptr);
+		gameObject->BaseReset();
+		pool.freeList.push_back(move(gameObject));
+	}
+	pool.stats.created += count;
+}
+
+unique_ptr<GameObjectBase> ObjectPoolManager::Acquire(const string& prefabFileName, GameObjectBase* parent)
+{
+	ObjectPool& pool = m_pools[prefabFileName];
+	unique_ptr<GameObjectBase> gameObject = nullptr;
+
+	if (pool.freeList.empty())
+	{
+		gameObject = CreateFromPrefab(prefabFileName, parent);
+		pool.stats.created++;
+		TELEMETRY_COUNT("Scene.PrefabInstantiations", 1);
+	}
+	else
+	{
+		gameObject = move(pool.freeList.back());
+		pool.freeList.pop_back();
+
+		gameObject->m_parent = parent;
+		gameObject->RestoreFromPrefab(*SceneManager::GetInstance().GetPrefabData(prefabFileName));
+		pool.stats.reused++;
+		TELEMETRY_COUNT("Scene.PoolReuses", 1);
+	}
+
+	pool.stats.active++;
+	pool.stats.peakActive = max(pool.stats.peakActive, pool.stats.active);
+
+	return gameObject;
+}
+
+void ObjectPoolManager::Release(unique_ptr<GameObjectBase> gameObject)
+{
+	// 부모(또는 씬)의 활성 목록에서 제거
+	gameObject->LinkActiveList(nullptr);
+
+	auto it = m_pools.find(gameObject->m_prefabFileName);
+	if (it == m_pools.end())
+	{
+		gameObject->BaseFinalize();
+		return;
+	}
+
+	// 제거 대기 중이던 컴포넌트 및 자식 게임 오브젝트는 제거 대기열이 먼저 정리함
+	gameObject->BaseReset();
+	gameObject->m_parent = nullptr;
+
+	ObjectPool& pool = it->second;
+	pool.stats.returned++;
+	if (pool.stats.active > 0) pool.stats.active--;
+
+	pool.freeList.push_back(move(gameObject));
+}
+
+void ObjectPoolManager::Clear()
+{
+	// 풀에 있는 게임 오브젝트는 반환 시 이미 종료 처리됨
+	m_pools.clear();
+}
+
+const ObjectPoolStats* ObjectPoolManager::GetStats(const string& prefabFileName) const
+{
+	auto it = m_pools.find(prefabFileName);
+	if (it == m_pools.end()) return nullptr;
+
+	return &it->second.stats;
+}
+
+#ifdef _DEBUG
+void ObjectPoolManager::RenderImGui()
+{
+	if (m_pools.empty()) return;
+
+	ImGui::Separator();
+	ImGui::Text("[Object Pools]");
+
+	if (ImGui::BeginTable("ObjectPools", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+	{
+		ImGui::TableSetupColumn("Prefab");
+		ImGui::TableSetupColumn("Free");
+		ImGui::TableSetupColumn("Active");
+		ImGui::TableSetupColumn("Peak");
+		ImGui::TableSetupColumn("Created");
+		ImGui::TableSetupColumn("Reused");
+		ImGui::TableSetupColumn("Returned");
+		ImGui::TableHeadersRow();
+
+		for (const auto& [prefabFileName, pool] : m_pools)
+		{
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::Text("%s", prefabFileName.c_str());
+			ImGui::TableNextColumn(); ImGui::Text("%zu", pool.freeList.size());
+			ImGui::TableNextColumn(); ImGui::Text("%zu", pool.stats.active);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", pool.stats.peakActive);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", pool.stats.created);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", pool.stats.reused);
+			ImGui::TableNextColumn(); ImGui::Text("%zu", pool.stats.returned);
+		}
+
+		ImGui::EndTable();
+	}
+}
+#endif
+
+unique_ptr<GameObjectBase> ObjectPoolManager::CreateFromPrefab(const string& prefabFileName, GameObjectBase* parent)
+{
+	const nlohmann::json& prefabData = *SceneManager::GetInstance().GetPrefabData(prefabFileName);
+
+	unique_ptr<GameObjectBase> gameObject = TypeRegistry::GetInstance().CreateGameObject(prefabData["type"].get<string>());
+
+	gameObject->m_parent = parent;
+	gameObject->m_prefabFileName = prefabFileName;
+	gameObject->BaseDeserialize(prefabData);
+	gameObject->BaseInitialize();
+
+	return gameObject;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "GameObjectBase.h"
+
+struct ObjectPoolStats
+{
+	size_t created = 0; // 새로 생성한 수
+	size_t reused = 0; // 풀에서 재사용한 수
+	size_t returned = 0; // 풀로 반환된 수
+	size_t active = 0; // 현재 사용 중인 수
+	size_t peakActive = 0; // 최대 동시 사용 수
+};
+
+class ObjectPoolManager : public Singleton<ObjectPoolManager>
+{
+	friend class Singleton<ObjectPoolManager>;
+
+	struct ObjectPool
+	{
+		std::vector<std::unique_ptr<GameObjectBase>> freeList = {}; // 재사용 대기 중인 게임 오브젝트 배열
+		ObjectPoolStats stats = {}; // 풀 통계
+	};
+	std::unordered_map<std::string, ObjectPool> m_pools = {}; // 프리팹 파일 이름별 풀 맵
+
+public:
+	~ObjectPoolManager() = default;
+	ObjectPoolManager(const ObjectPoolManager&) = delete;
+	ObjectPoolManager& operator=(const ObjectPoolManager&) = delete;
+	ObjectPoolManager(ObjectPoolManager&&) = delete;
+	ObjectPoolManager& operator=(ObjectPoolManager&&) = delete;
+
+	// 프리팹 풀 등록 및 미리 생성 // 씬 로드 시 호출
+	void WarmUp(const std::string& prefabFileName, size_t count);
+	// 풀링 대상 프리팹 여부
+	bool IsPooled(const std::string& prefabFileName) const { return m_pools.contains(prefabFileName); }
+
+	// 풀에서 게임 오브젝트 꺼내기 // 비어 있으면 새로 생성
+	std::unique_ptr<GameObjectBase> Acquire(const std::string& prefabFileName, GameObjectBase* parent);
+	// 게임 오브젝트를 풀에 반환 // 풀링 대상이 아니면 종료 후 해제
+	void Release(std::unique_ptr<GameObjectBase> gameObject);
+
+	// 모든 풀 비우기 // 씬 종료 시 호출
+	void Clear();
+
+	// 풀 통계 얻기 // 없으면 nullptr 반환
+	const ObjectPoolStats* GetStats(const std::string& prefabFileName) const;
+
+	#ifdef _DEBUG
+	// 풀 통계 ImGui 렌더링
+	void RenderImGui();
+	#endif
+
+private:
+	ObjectPoolManager() = default;
+
+	// 프리팹 데이터로 새 게임 오브젝트 생성
+	std::unique_ptr<GameObjectBase> CreateFromPrefab(const std::string& prefabFileName, GameObjectBase* parent);
+};
@@ -6,6 +6,7 @@
 #include "GameObjectBase.h"
 #include "CameraComponent.h"
 #include "TimeManager.h"
+#include "RenderBackend.h"
 
 using namespace std;
 using namespace DirectX;
@@ -67,9 +68,9 @@ void ParticleComponent::Render()
 			resourceManager.SetRasterState(m_rasterState);
 
 			// 상수 버퍼 업데이트
-			m_deviceContext->UpdateSubresource(m_worldNormalBuffer.Get(), 0, nullptr, m_worldNormalData, 0, 0);
-			m_deviceContext->UpdateSubresource(m_particleBuffer.Get(),0, nullptr, &uv_buffer_data_, 0, 0);
-			m_deviceContext->UpdateSubresource(m_particleColorBuffer.Get(), 0, nullptr, &m_particleColor, 0, 0);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_worldNormalBuffer.Get(), m_worldNormalData);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_particleBuffer.Get(), &uv_buffer_data_);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_particleColorBuffer.Get(), &m_particleColor);
 
 			constexpr UINT stride = sizeof(VertexPosUV);
 			constexpr UINT offset = 0;
@@ -81,7 +82,7 @@ void ParticleComponent::Render()
 			m_deviceContext->PSSetShader(m_pixelShader.Get(), nullptr, 0);
 			m_deviceContext->PSSetShaderResources(static_cast<UINT>(TextureSlots::BaseColor), 1, particle_texture_srv_.GetAddressOf());
 
-			m_deviceContext->DrawInstanced(4, m_particleAmount, 0, 0);
+			RenderBackend::GetInstance().DrawInstanced(m_deviceContext.Get(), 4, m_particleAmount, 0, 0);
 		}
 	);
 }
@@ -269,6 +270,7 @@ void ParticleComponent::CreateBuffers()
 
 	hr = device->CreateBuffer(&vbDesc, &vbInitData, m_vertexBuffer.GetAddressOf());
 	assert(SUCCEEDED(hr));
+	RenderBackend::GetInstance().RecordBuffer(vbDesc);
 }
 
 
@@ -91,6 +91,13 @@ public:
 	bool NeedsUpdate() const override { return true; }
 	bool NeedsRender() const override { return true; }
 
+	// 업데이트는 자기 상태만 갱신 // 렌더링은 메인 카메라 읽기
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override
+	{
+		if (phase == FramePhase::Render) return { .read = FrameAccess::Camera };
+		return {};
+	}
+
 protected:
 	void Initialize() override;
 	void Update() override;
@@ -99,6 +106,9 @@ protected:
 	void RenderImGui() override;
 	#endif
 
+	// 풀 재사용 시 셰이더 및 버퍼 생성 없이 경과 시간만 초기화
+	void Reactivate() override { m_elapsedTime = 0.0f; }
+
 	nlohmann::json Serialize() override;
 	void Deserialize(const nlohmann::json& jsonData) override;
 
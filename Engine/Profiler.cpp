@@ -0,0 +1,237 @@
+#include "stdafx.h"
+#include "Profiler.h"
+
+#include "Microbenchmark.h"
+
+#if PROFILER_ENABLED
+
+#include "JobSystem.h"
+
+using namespace std;
+
+REGISTER_MICROBENCHMARK(Profiler, []() { Profiler::GetInstance().RunMicrobenchmarks(); })
+
+void Profiler::Initialize()
+{
+	if (!s_threadBuffer) RegisterThread("Main");
+}
+
+void Profiler::BeginFrame()
+{
+	m_frameBegins[0] = m_frameBegins[1];
+	m_frameBegins[1] = GetTimestamp();
+}
+
+const char* Profiler::InternName(const string& name)
+{
+	lock_guard<mutex> lock(m_threadBufferMutex);
+
+	return m_internedNames.insert(name).first->c_str();
+}
+
+bool Profiler::ExportChromeTrace(const filesystem::path& filePath)
+{
+	vector<ThreadCapture> captures = {};
+	Capture(0, numeric_limits<uint64_t>::max(), captures);
+
+	ofstream file(filePath);
+	if (!file)
+	{
+		cerr << "트레이스 파일 열기 실패: " << filePath.string() << endl;
+		return false;
+	}
+
+	// 가장 이른 구역을 0으로 맞춤
+	uint64_t baseTime = numeric_limits<uint64_t>::max();
+	for (const ThreadCapture& capture : captures) for (const ProfileEvent& event : capture.events) baseTime = min(baseTime, event.begin);
+
+	const auto writeEscaped = [&](const char* text)
+		{
+			for (; *text; ++text)
+			{
+				if (*text == '"' || *text == '\\') file << '\\';
+				file << *text;
+			}
+		};
+
+	// 완료 이벤트(ph X) 배열 // 시간은 마이크로초 단위
+	file << "{\"traceEvents\":[\n";
+	file << fixed << setprecision(3);
+
+	bool isFirst = true;
+	size_t eventCount = 0;
+	for (const ThreadCapture& capture : captures)
+	{
+		file << (isFirst ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << capture.threadId << ",\"args\":{\"name\":\"";
+		writeEscaped(capture.threadName.c_str());
+		file << "\"}}";
+		isFirst = false;
+
+		for (const ProfileEvent& event : capture.events)
+		{
+			file << ",\n{\"name\":\"";
+			writeEscaped(event.name);
+			file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << capture.threadId
+				<< ",\"ts\":" << static_cast<double>(event.begin - baseTime) * 0.001
+				<< ",\"dur\":" << static_cast<double>(event.end - event.begin) * 0.001 << "}";
+		}
+		eventCount += capture.events.size();
+	}
+
+	file << "\n]}\n";
+
+	cout << "트레이스 저장: " << filePath.string() << " (구역 " << eventCount << "개)" << endl;
+
+	return true;
+}
+
+#ifdef _DEBUG
+void Profiler::RenderImGui()
+{
+	// 갱신 정지 중이 아니면 직전 프레임 구역 복사
+	if (!m_isFlameViewPaused && m_frameBegins[0] != 0)
+	{
+		m_flameCaptureBegin = m_frameBegins[0];
+		m_flameCaptureEnd = m_frameBegins[1];
+		Capture(m_flameCaptureBegin, m_flameCaptureEnd, m_flameCapture);
+	}
+
+	ImGui::Begin("Profiler");
+
+	bool isEnabled = IsEnabled();
+	if (ImGui::Checkbox("Enabled", &isEnabled)) SetEnabled(isEnabled);
+	ImGui::SameLine();
+	ImGui::Checkbox("Pause", &m_isFlameViewPaused);
+	ImGui::SameLine();
+	if (ImGui::Button("Export Chrome Trace")) ExportChromeTrace("profile_trace.json");
+
+	const double frameDuration = static_cast<double>(m_flameCaptureEnd - m_flameCaptureBegin);
+	ImGui::Text("Frame: %.3f ms", frameDuration * 0.000001);
+
+	if (frameDuration > 0.0)
+	{
+		constexpr float ROW_HEIGHT = 18.0f;
+
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+		const float width = max(ImGui::GetContentRegionAvail().x, 1.0f);
+		const double scale = width / frameDuration;
+
+		for (const ThreadCapture& capture : m_flameCapture)
+		{
+			if (capture.events.empty()) continue;
+
+			ImGui::Separator();
+			ImGui::Text("%s", capture.threadName.c_str());
+
+			uint32_t maxDepth = 0;
+			for (const ProfileEvent& event : capture.events) maxDepth = max(maxDepth, event.depth);
+
+			const ImVec2 origin = ImGui::GetCursorScreenPos();
+			const ImVec2 mousePosition = ImGui::GetIO().MousePos;
+
+			for (const ProfileEvent& event : capture.events)
+			{
+				const uint64_t begin = max(event.begin, m_flameCaptureBegin);
+				const uint64_t end = min(event.end, m_flameCaptureEnd);
+
+				const ImVec2 rectMin = { origin.x + static_cast<float>((begin - m_flameCaptureBegin) * scale), origin.y + event.depth * ROW_HEIGHT };
+				const ImVec2 rectMax = { max(rectMin.x + 1.0f, origin.x + static_cast<float>((end - m_flameCaptureBegin) * scale)), rectMin.y + ROW_HEIGHT - 1.0f };
+
+				// 이름 포인터로 색 결정 // 같은 구역은 항상 같은 색
+				const size_t hash = std::hash<const void*>{}(event.name);
+				const ImU32 color = IM_COL32(80 + hash % 120, 80 + (hash >> 8) % 120, 80 + (hash >> 16) % 120, 255);
+				drawList->AddRectFilled(rectMin, rectMax, color);
+
+				const float textWidth = ImGui::CalcTextSize(event.name).x;
+				if (rectMax.x - rectMin.x > textWidth + 4.0f) drawList->AddText({ rectMin.x + 2.0f, rectMin.y + 1.0f }, IM_COL32_WHITE, event.name);
+
+				if (ImGui::IsWindowHovered() && mousePosition.x >= rectMin.x && mousePosition.x < rectMax.x && mousePosition.y >= rectMin.y && mousePosition.y < rectMax.y)
+				{
+					ImGui::SetTooltip("%s\n%.3f ms", event.name, static_cast<double>(event.end - event.begin) * 0.000001);
+				}
+			}
+
+			ImGui::Dummy({ width, (maxDepth + 1) * ROW_HEIGHT });
+		}
+	}
+
+	ImGui::End();
+}
+#endif
+
+void Profiler::RunMicrobenchmarks()
+{
+	cout << "[프로파일러 마이크로벤치마크]" << endl;
+
+	// 반복문이 최적화로 사라지지 않도록 구역 안에서 값 누적
+	constexpr size_t ZONE_COUNT = 1000000;
+	volatile uint64_t sink = 0;
+
+	const double emptyElapsed = MeasureMilliseconds([&]() { for (size_t i = 0; i < ZONE_COUNT; ++i) sink = sink + 1; });
+
+	const bool wasEnabled = IsEnabled();
+	SetEnabled(false);
+	const double disabledElapsed = MeasureMilliseconds([&]() { for (size_t i = 0; i < ZONE_COUNT; ++i) { PROFILE_SCOPE("Microbenchmark"); sink = sink + 1; } });
+	SetEnabled(true);
+	const double enabledElapsed = MeasureMilliseconds([&]() { for (size_t i = 0; i < ZONE_COUNT; ++i) { PROFILE_SCOPE("Microbenchmark"); sink = sink + 1; } });
+	SetEnabled(wasEnabled);
+
+	cout << "구역 없음: " << emptyElapsed * 1000000.0 / ZONE_COUNT << " ns/반복, 기록 끈 구역: " << disabledElapsed * 1000000.0 / ZONE_COUNT
+		<< " ns/반복, 기록 켠 구역: " << enabledElapsed * 1000000.0 / ZONE_COUNT << " ns/반복" << endl;
+}
+
+Profiler::ThreadBuffer& Profiler::RegisterThread(const string& threadName)
+{
+	unique_ptr<ThreadBuffer> buffer = make_unique<ThreadBuffer>();
+	buffer->threadId = static_cast<uint32_t>(GetCurrentThreadId());
+	buffer->threadName = threadName;
+	if (buffer->threadName.empty())
+	{
+		const size_t workerIndex = JobSystem::GetCurrentWorkerIndex();
+		buffer->threadName = workerIndex != JobSystem::NOT_WORKER ? "Worker " + to_string(workerIndex) : "Thread " + to_string(buffer->threadId);
+	}
+
+	s_threadBuffer = buffer.get();
+
+	lock_guard<mutex> lock(m_threadBufferMutex);
+	m_threadBuffers.push_back(move(buffer));
+
+	return *s_threadBuffer;
+}
+
+void Profiler::Capture(uint64_t begin, uint64_t end, vector<ThreadCapture>& captures)
+{
+	lock_guard<mutex> lock(m_threadBufferMutex);
+
+	captures.resize(m_threadBuffers.size());
+	for (size_t i = 0; i < m_threadBuffers.size(); ++i)
+	{
+		const ThreadBuffer& buffer = *m_threadBuffers[i];
+		ThreadCapture& capture = captures[i];
+		capture.threadName = buffer.threadName;
+		capture.threadId = buffer.threadId;
+		capture.events.clear();
+
+		const uint64_t writeIndex = buffer.writeIndex.load(memory_order_acquire);
+		const uint64_t firstIndex = writeIndex > RING_BUFFER_CAPACITY ? writeIndex - RING_BUFFER_CAPACITY : 0;
+
+		vector<uint64_t> copiedIndices = {};
+		for (uint64_t index = firstIndex; index < writeIndex; ++index)
+		{
+			const ProfileEvent& event = buffer.events[index & (RING_BUFFER_CAPACITY - 1)];
+			if (event.end <= begin || event.begin >= end) continue;
+
+			capture.events.push_back(event);
+			copiedIndices.push_back(index);
+		}
+
+		// 복사하는 동안 소유 스레드가 덮어쓴 구역 제외 // 인덱스 순으로 복사했으므로 앞쪽만 해당
+		// 소유 스레드는 newWriteIndex 칸을 먼저 쓰고 인덱스를 올리므로 그 칸과 겹치는 newWriteIndex - RING_BUFFER_CAPACITY도 쓰는 중일 수 있음
+		const uint64_t newWriteIndex = buffer.writeIndex.load(memory_order_acquire);
+		const uint64_t validIndex = newWriteIndex + 1 > RING_BUFFER_CAPACITY ? newWriteIndex + 1 - RING_BUFFER_CAPACITY : 0;
+		const size_t overwrittenCount = lower_bound(copiedIndices.begin(), copiedIndices.end(), validIndex) - copiedIndices.begin();
+		capture.events.erase(capture.events.begin(), capture.events.begin() + overwrittenCount);
+	}
+}
+
+#endif
@@ -0,0 +1,158 @@
+#pragma once
+
+// 프로파일러 사용 여부 // 0으로 정의하면 구역 매크로가 빈 문장으로 컴파일되고 기록 코드가 빠짐
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+// 측정 구역 하나 // 구역이 끝날 때 기록
+struct ProfileEvent
+{
+	const char* name = nullptr; // 구역 이름 // 문자열 리터럴이나 Profiler::InternName 결과처럼 수명이 끝나지 않는 문자열
+	uint64_t begin = 0; // 시작 시각 // 나노초 단위
+	uint64_t end = 0; // 종료 시각 // 나노초 단위
+	uint32_t depth = 0; // 같은 스레드 안에서 중첩 깊이
+};
+
+#if PROFILER_ENABLED
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+// 현재 범위를 이름 붙인 구역으로 측정
+#define PROFILE_SCOPE(name) const ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+// 현재 함수를 구역으로 측정
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+
+// 계층형 CPU 프로파일러
+// 스레드마다 고정 크기 링 버퍼에 구역을 기록 // 쓰기는 소유 스레드만 하므로 잠금 없음, 읽기는 쓰기 인덱스로 덮어쓰인 구역을 걸러냄
+// 링 버퍼가 가득 차면 오래된 구역부터 덮어씀 // ImGui 플레임 뷰와 Chrome 트레이스(chrome://tracing, Perfetto) 내보내기 지원
+class Profiler : public Singleton<Profiler>
+{
+	friend class Singleton<Profiler>;
+	friend class ProfileScope;
+
+public:
+	static constexpr size_t RING_BUFFER_CAPACITY = 1 << 15; // 스레드당 보관 구역 수 // 2의 거듭제곱
+
+private:
+	// 스레드별 링 버퍼
+	struct ThreadBuffer
+	{
+		std::string threadName = {};
+		uint32_t threadId = 0;
+		std::array<ProfileEvent, RING_BUFFER_CAPACITY> events = {};
+		std::atomic<uint64_t> writeIndex = 0; // 지금까지 기록한 구역 수
+		uint32_t depth = 0; // 현재 중첩 깊이 // 소유 스레드만 접근
+	};
+
+	// 한 스레드의 구역 복사본
+	struct ThreadCapture
+	{
+		std::string threadName = {};
+		uint32_t threadId = 0;
+		std::vector<ProfileEvent> events = {};
+	};
+
+	static inline thread_local ThreadBuffer* s_threadBuffer = nullptr; // 현재 스레드의 링 버퍼 // 등록 전이면 nullptr
+
+	std::atomic<bool> m_isEnabled = true; // 실행 중 기록 여부
+
+	std::mutex m_threadBufferMutex = {}; // 스레드 등록, 이름 인턴 보호
+	std::vector<std::unique_ptr<ThreadBuffer>> m_threadBuffers = {}; // 종료 시까지 유지 // 스레드가 끝나도 기록은 남김
+	std::unordered_set<std::string> m_internedNames = {}; // 노드 기반이라 삽입해도 문자열 위치 유지
+
+	std::array<uint64_t, 2> m_frameBegins = {}; // 이전, 현재 프레임 시작 시각
+
+	#ifdef _DEBUG
+	bool m_isFlameViewPaused = false; // 플레임 뷰 갱신 정지 여부
+	std::vector<ThreadCapture> m_flameCapture = {}; // 플레임 뷰에 표시 중인 프레임의 구역
+	uint64_t m_flameCaptureBegin = 0;
+	uint64_t m_flameCaptureEnd = 0;
+	#endif
+
+public:
+	~Profiler() = default;
+	Profiler(const Profiler&) = delete;
+	Profiler& operator=(const Profiler&) = delete;
+	Profiler(Profiler&&) = delete;
+	Profiler& operator=(Profiler&&) = delete;
+
+	// 호출한 스레드를 메인 스레드로 등록
+	void Initialize();
+
+	void SetEnabled(bool isEnabled) { m_isEnabled.store(isEnabled, std::memory_order_relaxed); }
+	bool IsEnabled() const { return m_isEnabled.load(std::memory_order_relaxed); }
+
+	// 프레임 시작 시 호출 // 플레임 뷰의 프레임 경계
+	void BeginFrame();
+
+	// 구역 이름으로 쓸 수 있도록 문자열을 종료 시까지 보관 // 같은 문자열은 같은 포인터 반환 // 초기화 때처럼 드물게 호출
+	const char* InternName(const std::string& name);
+
+	// 링 버퍼에 남은 모든 구역을 Chrome 트레이스 JSON으로 저장 // 실패하면 false
+	bool ExportChromeTrace(const std::filesystem::path& filePath);
+
+	#ifdef _DEBUG
+	// 마지막 프레임 플레임 뷰 창
+	void RenderImGui();
+	#endif
+
+	// 구역 없는 반복, 기록을 끈 구역, 기록을 켠 구역의 반복당 비용을 콘솔에 출력
+	void RunMicrobenchmarks();
+
+	// 현재 시각 // 나노초 단위
+	static uint64_t GetTimestamp() { return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()); }
+
+private:
+	Profiler() = default;
+
+	// 현재 스레드의 링 버퍼 // 처음 호출 시 등록
+	ThreadBuffer& GetThreadBuffer() { return s_threadBuffer ? *s_threadBuffer : RegisterThread({}); }
+	// 현재 스레드 링 버퍼 생성 // 이름이 비어 있으면 작업자 인덱스나 스레드 ID로 이름 지정
+	ThreadBuffer& RegisterThread(const std::string& threadName);
+
+	// 구간과 겹치는 구역 복사 // 복사 중 덮어쓰인 구역은 제외
+	void Capture(uint64_t begin, uint64_t end, std::vector<ThreadCapture>& captures);
+};
+
+// 범위 구역 // 생성 시 시작, 소멸 시 현재 스레드 링 버퍼에 기록
+class ProfileScope
+{
+	Profiler::ThreadBuffer* m_buffer = nullptr; // 기록이 꺼져 있으면 nullptr
+	const char* m_name = nullptr;
+	uint64_t m_begin = 0;
+	uint32_t m_depth = 0;
+
+public:
+	explicit ProfileScope(const char* name)
+	{
+		Profiler& profiler = Profiler::GetInstance();
+		if (!profiler.IsEnabled()) return;
+
+		m_buffer = &profiler.GetThreadBuffer();
+		m_name = name;
+		m_depth = m_buffer->depth++;
+		m_begin = Profiler::GetTimestamp();
+	}
+	~ProfileScope()
+	{
+		if (!m_buffer) return;
+
+		const uint64_t end = Profiler::GetTimestamp();
+		const uint64_t writeIndex = m_buffer->writeIndex.load(std::memory_order_relaxed);
+		m_buffer->events[writeIndex & (Profiler::RING_BUFFER_CAPACITY - 1)] = { .name = m_name, .begin = m_begin, .end = end, .depth = m_depth };
+		m_buffer->writeIndex.store(writeIndex + 1, std::memory_order_release);
+		m_buffer->depth = m_depth;
+	}
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+	ProfileScope(ProfileScope&&) = delete;
+	ProfileScope& operator=(ProfileScope&&) = delete;
+};
+
+#else
+
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+
+#endif
@@ -15,6 +15,8 @@ public:
 	RNG& operator=(RNG&&) = delete;
 
 	void Initialize() { m_generator.seed(std::random_device{}()); }
+	// 고정 시드로 초기화 // 입력 재생 등 재현 실행용
+	void Initialize(uint32_t seed) { m_generator.seed(seed); }
 
 	template <typename T> requires std::is_integral_v<T>
 	T Range(T min, T max) { std::uniform_int_distribution<T> distribution(min, max); return distribution(m_generator); }
@@ -0,0 +1,168 @@
+#include "stdafx.h"
+#include "RayPacket.h"
+
+#include "Microbenchmark.h"
+
+using namespace std;
+using namespace DirectX;
+
+REGISTER_MICROBENCHMARK(RayPacket, RayPacket::RunMicrobenchmarks)
+
+void RayPacket::RunMicrobenchmarks()
+{
+	// 초당 광선 수 // 광선마다 모든 상자 검사
+	const auto getRaysPerSecond = [](size_t rayCount, double elapsed) { return static_cast<double>(rayCount) / (elapsed * 0.001); };
+
+	constexpr size_t SHAPE_COUNT = 256;
+	constexpr size_t RAY_COUNT = 20000;
+	constexpr float WORLD_HALF_SIZE = 30.0f;
+
+	cout << "[SIMD 광선 검사 마이크로벤치마크] 모양 " << SHAPE_COUNT << "개에 대해 가장 가까운 충돌 검색" << endl;
+
+	mt19937 engine(MICROBENCHMARK_SEED);
+	uniform_real_distribution<float> position(-WORLD_HALF_SIZE, WORLD_HALF_SIZE);
+	uniform_real_distribution<float> extent(0.3f, 1.5f);
+	uniform_real_distribution<float> angle(-XM_PI, XM_PI);
+
+	vector<BoundingBox> boxes(SHAPE_COUNT);
+	vector<BoundingOrientedBox> obbs(SHAPE_COUNT);
+	for (size_t i = 0; i < SHAPE_COUNT; ++i)
+	{
+		boxes[i] = BoundingBox({ position(engine), extent(engine), position(engine) }, { extent(engine), extent(engine), extent(engine) });
+
+		XMFLOAT4 orientation = {};
+		XMStoreFloat4(&orientation, XMQuaternionRotationRollPitchYaw(angle(engine), angle(engine), angle(engine)));
+		obbs[i] = BoundingOrientedBox({ position(engine), extent(engine), position(engine) }, { extent(engine), extent(engine), extent(engine) }, orientation);
+	}
+
+	vector<AABBPacket> boxPackets((SHAPE_COUNT + RAY_PACKET_WIDTH - 1) / RAY_PACKET_WIDTH);
+	vector<OBBPacket> obbPackets(boxPackets.size());
+	for (size_t i = 0; i < SHAPE_COUNT; ++i)
+	{
+		boxPackets[i / RAY_PACKET_WIDTH].Set(i % RAY_PACKET_WIDTH, boxes[i]);
+		obbPackets[i / RAY_PACKET_WIDTH].Set(i % RAY_PACKET_WIDTH, obbs[i]);
+	}
+
+	// 절반은 상자 위 높이에서 수평으로, 절반은 위에서 비스듬히 // 사격, 데드아이 시야 확인 형태
+	vector<Ray> rays(RAY_COUNT);
+	for (size_t i = 0; i < RAY_COUNT; ++i)
+	{
+		const float height = i % 2 == 0 ? 1.0f : 10.0f;
+		rays[i].origin = XMVectorSet(position(engine), height, position(engine), 1.0f);
+		rays[i].direction = XMVector3Normalize(XMVectorSet(position(engine), i % 2 == 0 ? 0.0f : -height, position(engine), 0.0f));
+	}
+
+	const auto compare = [&](const char* name, double scalarElapsed, double scalarSum, double simdElapsed, double simdSum)
+		{
+			if (abs(scalarSum - simdSum) > 0.001 * max(1.0, scalarSum)) cerr << name << " 결과 불일치: DirectXMath " << scalarSum << ", SIMD " << simdSum << endl;
+			cout << name << ": DirectXMath " << getRaysPerSecond(RAY_COUNT, scalarElapsed) / 1000000.0 << " M광선/초, SIMD " << getRaysPerSecond(RAY_COUNT, simdElapsed) / 1000000.0 << " M광선/초 (" << scalarElapsed / simdElapsed << "배)" << endl;
+		};
+	// 충돌한 광선의 가장 가까운 거리 합 // 두 방식 결과 비교용
+	const auto accumulate = [](double& sum, float closestDistance) { if (closestDistance < numeric_limits<float>::max()) sum += closestDistance; };
+
+	// 광선 하나와 상자 여러 개
+	{
+		double scalarSum = 0.0;
+		const double scalarElapsed = MeasureMilliseconds([&]()
+			{
+				for (const Ray& ray : rays)
+				{
+					float closestDistance = numeric_limits<float>::max();
+					for (const BoundingBox& box : boxes)
+					{
+						float distance = 0.0f;
+						if (box.Intersects(ray.origin, ray.direction, distance) && distance < closestDistance) closestDistance = distance;
+					}
+					accumulate(scalarSum, closestDistance);
+				}
+			});
+
+		double simdSum = 0.0;
+		const double simdElapsed = MeasureMilliseconds([&]()
+			{
+				for (const Ray& ray : rays)
+				{
+					const XMVECTOR inverseDirection = GetSafeReciprocal(ray.direction);
+					float closestDistance = numeric_limits<float>::max();
+					for (const AABBPacket& packet : boxPackets) closestDistance = min(closestDistance, GetMinimumLane(packet.Intersect(ray.origin, inverseDirection, closestDistance)));
+					accumulate(simdSum, closestDistance);
+				}
+			});
+
+		compare("경계 상자", scalarElapsed, scalarSum, simdElapsed, simdSum);
+	}
+
+	{
+		double scalarSum = 0.0;
+		const double scalarElapsed = MeasureMilliseconds([&]()
+			{
+				for (const Ray& ray : rays)
+				{
+					float closestDistance = numeric_limits<float>::max();
+					for (const BoundingOrientedBox& obb : obbs)
+					{
+						float distance = 0.0f;
+						if (obb.Intersects(ray.origin, ray.direction, distance) && distance < closestDistance) closestDistance = distance;
+					}
+					accumulate(scalarSum, closestDistance);
+				}
+			});
+
+		double simdSum = 0.0;
+		const double simdElapsed = MeasureMilliseconds([&]()
+			{
+				for (const Ray& ray : rays)
+				{
+					float closestDistance = numeric_limits<float>::max();
+					for (const OBBPacket& packet : obbPackets) closestDistance = min(closestDistance, GetMinimumLane(packet.Intersect(ray.origin, ray.direction, closestDistance)));
+					accumulate(simdSum, closestDistance);
+				}
+			});
+
+		compare("방향 상자", scalarElapsed, scalarSum, simdElapsed, simdSum);
+	}
+
+	// 광선 4개와 상자 하나 // 트리 노드 검사 형태 // 시작점 뒤쪽 구간을 무시하므로 상자 안에서 시작한 광선은 0
+	{
+		double scalarSum = 0.0;
+		const double scalarElapsed = MeasureMilliseconds([&]()
+			{
+				for (const Ray& ray : rays)
+				{
+					float closestDistance = numeric_limits<float>::max();
+					for (const BoundingBox& box : boxes)
+					{
+						float distance = 0.0f;
+						if (box.Intersects(ray.origin, ray.direction, distance) && max(distance, 0.0f) < closestDistance) closestDistance = max(distance, 0.0f);
+					}
+					accumulate(scalarSum, closestDistance);
+				}
+			});
+
+		double simdSum = 0.0;
+		const double simdElapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t first = 0; first < rays.size(); first += RAY_PACKET_WIDTH)
+				{
+					RayPacket packet = Load(span<const Ray>(rays).subspan(first, min(RAY_PACKET_WIDTH, rays.size() - first)));
+					XMVECTOR closestDistances = g_XMInfinity;
+					for (const BoundingBox& box : boxes)
+					{
+						const XMFLOAT3 minimum = { box.Center.x - box.Extents.x, box.Center.y - box.Extents.y, box.Center.z - box.Extents.z };
+						const XMFLOAT3 maximum = { box.Center.x + box.Extents.x, box.Center.y + box.Extents.y, box.Center.z + box.Extents.z };
+						closestDistances = XMVectorMin(closestDistances, packet.IntersectBox(minimum, maximum));
+					}
+
+					XMFLOAT4 distances = {};
+					XMStoreFloat4(&distances, closestDistances);
+					for (size_t lane = 0; lane < packet.count; ++lane)
+					{
+						const float distance = (&distances.x)[lane];
+						accumulate(simdSum, isinf(distance) ? numeric_limits<float>::max() : distance);
+					}
+				}
+			});
+
+		compare("광선 묶음", scalarElapsed, scalarSum, simdElapsed, simdSum);
+	}
+}
@@ -0,0 +1,247 @@
+#pragma once
+
+// SIMD 광선 검사
+// 경계 상자, 방향 상자를 4개씩 SoA로 묶어 광선 하나를 한 번에 검사하거나, 광선 4개를 묶어 상자 하나를 한 번에 검사
+// 거리 의미는 DirectXMath Intersects와 같음 // 시작점이 상자 안이면 음수 진입 거리, 뒤에 있는 상자는 충돌 아님
+// 방향 성분이 0에 가까우면 무한대 대신 큰 유한값 역수를 써서 NaN 없이 평판 검사
+
+// 광선
+struct Ray
+{
+	DirectX::XMVECTOR origin = {};
+	DirectX::XMVECTOR direction = {}; // 정규화된 방향
+	float maxDistance = std::numeric_limits<float>::max();
+};
+
+constexpr size_t RAY_PACKET_WIDTH = 4;
+
+// 비교 결과 레인 비트 마스크 // 비트 i가 레인 i
+inline uint32_t GetLaneMask(DirectX::FXMVECTOR comparison)
+{
+	#if defined(_XM_SSE_INTRINSICS_)
+	return static_cast<uint32_t>(_mm_movemask_ps(comparison));
+	#else
+	DirectX::XMUINT4 lanes = {};
+	DirectX::XMStoreUInt4(&lanes, comparison);
+	return (lanes.x >> 31) | ((lanes.y >> 31) << 1) | ((lanes.z >> 31) << 2) | ((lanes.w >> 31) << 3);
+	#endif
+}
+
+// 네 레인 중 최솟값
+inline float GetMinimumLane(DirectX::FXMVECTOR value)
+{
+	using namespace DirectX;
+
+	const XMVECTOR pairMinimum = XMVectorMin(value, XMVectorSwizzle<XM_SWIZZLE_Y, XM_SWIZZLE_X, XM_SWIZZLE_W, XM_SWIZZLE_Z>(value));
+	return XMVectorGetX(XMVectorMin(pairMinimum, XMVectorSwizzle<XM_SWIZZLE_Z, XM_SWIZZLE_W, XM_SWIZZLE_X, XM_SWIZZLE_Y>(pairMinimum)));
+}
+
+// 0에 가까운 성분을 같은 부호의 작은 값으로 바꾼 역수
+inline DirectX::XMVECTOR GetSafeReciprocal(DirectX::FXMVECTOR value)
+{
+	const DirectX::XMVECTOR epsilon = DirectX::XMVectorReplicate(1e-20f);
+	const DirectX::XMVECTOR signedEpsilon = DirectX::XMVectorOrInt(epsilon, DirectX::XMVectorAndInt(value, DirectX::g_XMNegativeZero));
+	const DirectX::XMVECTOR isTiny = DirectX::XMVectorLess(DirectX::XMVectorAbs(value), epsilon);
+
+	return DirectX::XMVectorReciprocal(DirectX::XMVectorSelect(value, signedEpsilon, isTiny));
+}
+
+// 평판 세 쌍의 교차 구간 // 지나면 진입 거리, 아니면 무한대
+inline DirectX::XMVECTOR IntersectSlabs
+(
+	DirectX::FXMVECTOR t1X, DirectX::FXMVECTOR t2X, DirectX::FXMVECTOR t1Y, DirectX::GXMVECTOR t2Y, DirectX::HXMVECTOR t1Z, DirectX::HXMVECTOR t2Z,
+	DirectX::CXMVECTOR nearLimit, DirectX::CXMVECTOR maxDistance
+)
+{
+	using namespace DirectX;
+
+	const XMVECTOR entry = XMVectorMax(XMVectorMax(XMVectorMin(t1X, t2X), XMVectorMin(t1Y, t2Y)), XMVectorMax(XMVectorMin(t1Z, t2Z), nearLimit));
+	const XMVECTOR exit = XMVectorMin(XMVectorMin(XMVectorMax(t1X, t2X), XMVectorMax(t1Y, t2Y)), XMVectorMax(t1Z, t2Z));
+
+	// 뒤에 있거나, 구간이 비었거나, 최대 거리보다 멀면 충돌 아님
+	const XMVECTOR isHit = XMVectorAndInt(XMVectorAndInt(XMVectorLessOrEqual(entry, exit), XMVectorGreaterOrEqual(exit, XMVectorZero())), XMVectorLessOrEqual(entry, maxDistance));
+
+	return XMVectorSelect(g_XMInfinity, entry, isHit);
+}
+
+// 광선 4개 SoA // 빈 레인은 최대 거리 음수로 비활성
+struct RayPacket
+{
+	DirectX::XMVECTOR originX = {};
+	DirectX::XMVECTOR originY = {};
+	DirectX::XMVECTOR originZ = {};
+	DirectX::XMVECTOR inverseDirectionX = {};
+	DirectX::XMVECTOR inverseDirectionY = {};
+	DirectX::XMVECTOR inverseDirectionZ = {};
+	DirectX::XMVECTOR maxDistance = {};
+	size_t count = 0; // 유효한 광선 수
+
+	// rays 앞에서 최대 4개 // 방향은 정규화되어 있어야 함
+	static RayPacket Load(std::span<const Ray> rays)
+	{
+		using namespace DirectX;
+
+		RayPacket packet = {};
+		packet.count = std::min(rays.size(), RAY_PACKET_WIDTH);
+
+		XMFLOAT4A origins[3] = {};
+		XMFLOAT4A directions[3] = {};
+		XMFLOAT4A maxDistances = { -1.0f, -1.0f, -1.0f, -1.0f };
+		for (size_t lane = 0; lane < packet.count; ++lane)
+		{
+			XMFLOAT3 origin = {};
+			XMFLOAT3 direction = {};
+			XMStoreFloat3(&origin, rays[lane].origin);
+			XMStoreFloat3(&direction, rays[lane].direction);
+
+			(&origins[0].x)[lane] = origin.x;
+			(&origins[1].x)[lane] = origin.y;
+			(&origins[2].x)[lane] = origin.z;
+			(&directions[0].x)[lane] = direction.x;
+			(&directions[1].x)[lane] = direction.y;
+			(&directions[2].x)[lane] = direction.z;
+			(&maxDistances.x)[lane] = rays[lane].maxDistance;
+		}
+
+		packet.originX = XMLoadFloat4A(&origins[0]);
+		packet.originY = XMLoadFloat4A(&origins[1]);
+		packet.originZ = XMLoadFloat4A(&origins[2]);
+		packet.inverseDirectionX = GetSafeReciprocal(XMLoadFloat4A(&directions[0]));
+		packet.inverseDirectionY = GetSafeReciprocal(XMLoadFloat4A(&directions[1]));
+		packet.inverseDirectionZ = GetSafeReciprocal(XMLoadFloat4A(&directions[2]));
+		packet.maxDistance = XMLoadFloat4A(&maxDistances);
+
+		return packet;
+	}
+
+	// 광선 4개와 최소, 최대 모서리 상자 하나 // 시작점 뒤쪽 구간은 무시 // 트리 노드 검사용
+	DirectX::XMVECTOR IntersectBox(const DirectX::XMFLOAT3& minimum, const DirectX::XMFLOAT3& maximum) const
+	{
+		using namespace DirectX;
+
+		const XMVECTOR t1X = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate(minimum.x), originX), inverseDirectionX);
+		const XMVECTOR t2X = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate(maximum.x), originX), inverseDirectionX);
+		const XMVECTOR t1Y = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate(minimum.y), originY), inverseDirectionY);
+		const XMVECTOR t2Y = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate(maximum.y), originY), inverseDirectionY);
+		const XMVECTOR t1Z = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate(minimum.z), originZ), inverseDirectionZ);
+		const XMVECTOR t2Z = XMVectorMultiply(XMVectorSubtract(XMVectorReplicate(maximum.z), originZ), inverseDirectionZ);
+
+		return IntersectSlabs(t1X, t2X, t1Y, t2Y, t1Z, t2Z, XMVectorZero(), maxDistance);
+	}
+
+	// 광선 하나씩 DirectXMath로 검사할 때와 SIMD 커널의 초당 광선, 상자 검사 수 비교 결과를 콘솔에 출력
+	static void RunMicrobenchmarks();
+};
+
+// 경계 상자 4개 SoA // 채우지 않은 레인은 항상 충돌 아님
+struct AABBPacket
+{
+	DirectX::XMVECTOR minimumX = {};
+	DirectX::XMVECTOR minimumY = {};
+	DirectX::XMVECTOR minimumZ = {};
+	DirectX::XMVECTOR maximumX = {};
+	DirectX::XMVECTOR maximumY = {};
+	DirectX::XMVECTOR maximumZ = {};
+	DirectX::XMVECTOR validLanes = {}; // 채운 레인은 모든 비트 1
+
+	void Set(size_t lane, const DirectX::BoundingBox& box)
+	{
+		using namespace DirectX;
+
+		validLanes.m128_u32[lane] = 0xFFFFFFFF;
+		minimumX.m128_f32[lane] = box.Center.x - box.Extents.x;
+		minimumY.m128_f32[lane] = box.Center.y - box.Extents.y;
+		minimumZ.m128_f32[lane] = box.Center.z - box.Extents.z;
+		maximumX.m128_f32[lane] = box.Center.x + box.Extents.x;
+		maximumY.m128_f32[lane] = box.Center.y + box.Extents.y;
+		maximumZ.m128_f32[lane] = box.Center.z + box.Extents.z;
+	}
+
+	// 광선 하나와 상자 4개 // 레인별 진입 거리, 충돌 아니면 무한대
+	DirectX::XMVECTOR Intersect(DirectX::FXMVECTOR origin, DirectX::FXMVECTOR inverseDirection, float maxDistance) const
+	{
+		using namespace DirectX;
+
+		const XMVECTOR originX = XMVectorSplatX(origin);
+		const XMVECTOR originY = XMVectorSplatY(origin);
+		const XMVECTOR originZ = XMVectorSplatZ(origin);
+		const XMVECTOR inverseX = XMVectorSplatX(inverseDirection);
+		const XMVECTOR inverseY = XMVectorSplatY(inverseDirection);
+		const XMVECTOR inverseZ = XMVectorSplatZ(inverseDirection);
+
+		const XMVECTOR t1X = XMVectorMultiply(XMVectorSubtract(minimumX, originX), inverseX);
+		const XMVECTOR t2X = XMVectorMultiply(XMVectorSubtract(maximumX, originX), inverseX);
+		const XMVECTOR t1Y = XMVectorMultiply(XMVectorSubtract(minimumY, originY), inverseY);
+		const XMVECTOR t2Y = XMVectorMultiply(XMVectorSubtract(maximumY, originY), inverseY);
+		const XMVECTOR t1Z = XMVectorMultiply(XMVectorSubtract(minimumZ, originZ), inverseZ);
+		const XMVECTOR t2Z = XMVectorMultiply(XMVectorSubtract(maximumZ, originZ), inverseZ);
+
+		const XMVECTOR distances = IntersectSlabs(t1X, t2X, t1Y, t2Y, t1Z, t2Z, g_XMNegInfinity, XMVectorReplicate(maxDistance));
+		return XMVectorSelect(g_XMInfinity, distances, validLanes);
+	}
+};
+
+// 방향 상자 4개 SoA // 광선을 상자마다 로컬 축으로 옮긴 뒤 평판 검사 // 채우지 않은 레인은 항상 충돌 아님
+struct OBBPacket
+{
+	DirectX::XMVECTOR centerX = {};
+	DirectX::XMVECTOR centerY = {};
+	DirectX::XMVECTOR centerZ = {};
+	DirectX::XMVECTOR extentX = {};
+	DirectX::XMVECTOR extentY = {};
+	DirectX::XMVECTOR extentZ = {};
+	std::array<std::array<DirectX::XMVECTOR, 3>, 3> axes = {}; // axes[축][성분] // 월드 좌표계 기준 상자 로컬 축
+	DirectX::XMVECTOR validLanes = {}; // 채운 레인은 모든 비트 1
+
+	void Set(size_t lane, const DirectX::BoundingOrientedBox& obb)
+	{
+		using namespace DirectX;
+
+		validLanes.m128_u32[lane] = 0xFFFFFFFF;
+		centerX.m128_f32[lane] = obb.Center.x;
+		centerY.m128_f32[lane] = obb.Center.y;
+		centerZ.m128_f32[lane] = obb.Center.z;
+		extentX.m128_f32[lane] = obb.Extents.x;
+		extentY.m128_f32[lane] = obb.Extents.y;
+		extentZ.m128_f32[lane] = obb.Extents.z;
+
+		const XMMATRIX rotation = XMMatrixRotationQuaternion(XMLoadFloat4(&obb.Orientation));
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			XMFLOAT3 axisVector = {};
+			XMStoreFloat3(&axisVector, rotation.r[axis]);
+			axes[axis][0].m128_f32[lane] = axisVector.x;
+			axes[axis][1].m128_f32[lane] = axisVector.y;
+			axes[axis][2].m128_f32[lane] = axisVector.z;
+		}
+	}
+
+	// 광선 하나와 방향 상자 4개 // 레인별 진입 거리, 충돌 아니면 무한대
+	DirectX::XMVECTOR Intersect(DirectX::FXMVECTOR origin, DirectX::FXMVECTOR direction, float maxDistance) const
+	{
+		using namespace DirectX;
+
+		const XMVECTOR offsetX = XMVectorSubtract(XMVectorSplatX(origin), centerX);
+		const XMVECTOR offsetY = XMVectorSubtract(XMVectorSplatY(origin), centerY);
+		const XMVECTOR offsetZ = XMVectorSubtract(XMVectorSplatZ(origin), centerZ);
+		const XMVECTOR directionX = XMVectorSplatX(direction);
+		const XMVECTOR directionY = XMVectorSplatY(direction);
+		const XMVECTOR directionZ = XMVectorSplatZ(direction);
+
+		std::array<XMVECTOR, 3> t1 = {};
+		std::array<XMVECTOR, 3> t2 = {};
+		const std::array<XMVECTOR, 3> extents = { extentX, extentY, extentZ };
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			const XMVECTOR localOrigin = XMVectorMultiplyAdd(offsetZ, axes[axis][2], XMVectorMultiplyAdd(offsetY, axes[axis][1], XMVectorMultiply(offsetX, axes[axis][0])));
+			const XMVECTOR localDirection = XMVectorMultiplyAdd(directionZ, axes[axis][2], XMVectorMultiplyAdd(directionY, axes[axis][1], XMVectorMultiply(directionX, axes[axis][0])));
+			const XMVECTOR inverse = GetSafeReciprocal(localDirection);
+
+			t1[axis] = XMVectorMultiply(XMVectorSubtract(XMVectorNegate(extents[axis]), localOrigin), inverse);
+			t2[axis] = XMVectorMultiply(XMVectorSubtract(extents[axis], localOrigin), inverse);
+		}
+
+		const XMVECTOR distances = IntersectSlabs(t1[0], t2[0], t1[1], t2[1], t1[2], t2[2], g_XMNegInfinity, XMVectorReplicate(maxDistance));
+		return XMVectorSelect(g_XMInfinity, distances, validLanes);
+	}
+};
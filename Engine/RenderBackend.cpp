@@ -0,0 +1,202 @@
+#include "stdafx.h"
+#include "RenderBackend.h"
+
+#include "Telemetry.h"
+
+using namespace std;
+
+namespace
+{
+	// 형식당 비트 수 // 자주 쓰는 형식만 구분하고 나머지는 32비트로 추정
+	UINT GetBitsPerPixel(DXGI_FORMAT format)
+	{
+		switch (format)
+		{
+		case DXGI_FORMAT_R32G32B32A32_FLOAT:
+		case DXGI_FORMAT_R32G32B32A32_TYPELESS:
+			return 128;
+
+		case DXGI_FORMAT_R16G16B16A16_FLOAT:
+		case DXGI_FORMAT_R16G16B16A16_TYPELESS:
+		case DXGI_FORMAT_R32G32_FLOAT:
+			return 64;
+
+		case DXGI_FORMAT_R8_UNORM:
+		case DXGI_FORMAT_A8_UNORM:
+		case DXGI_FORMAT_BC2_UNORM:
+		case DXGI_FORMAT_BC2_UNORM_SRGB:
+		case DXGI_FORMAT_BC3_UNORM:
+		case DXGI_FORMAT_BC3_UNORM_SRGB:
+		case DXGI_FORMAT_BC5_UNORM:
+		case DXGI_FORMAT_BC6H_UF16:
+		case DXGI_FORMAT_BC7_UNORM:
+		case DXGI_FORMAT_BC7_UNORM_SRGB:
+			return 8;
+
+		case DXGI_FORMAT_BC1_UNORM:
+		case DXGI_FORMAT_BC1_UNORM_SRGB:
+		case DXGI_FORMAT_BC4_UNORM:
+			return 4;
+
+		default:
+			return 32;
+		}
+	}
+}
+
+HRESULT RenderBackend::CreateDevice(const D3D_FEATURE_LEVEL* featureLevels, UINT featureLevelCount, UINT flags, com_ptr<ID3D11Device>& device, com_ptr<ID3D11DeviceContext>& deviceContext)
+{
+	const auto create = [&](D3D_DRIVER_TYPE driverType, UINT createFlags)
+		{
+			return D3D11CreateDevice
+			(
+				nullptr,
+				driverType,
+				nullptr,
+				createFlags,
+				featureLevels,
+				featureLevelCount,
+				D3D11_SDK_VERSION,
+				device.ReleaseAndGetAddressOf(),
+				nullptr,
+				deviceContext.ReleaseAndGetAddressOf()
+			);
+		};
+
+	switch (m_type)
+	{
+	case RenderBackendType::Null:
+	{
+		// Null 드라이버는 디버그 레이어를 지원하지 않음
+		const HRESULT hr = create(D3D_DRIVER_TYPE_NULL, flags & ~D3D11_CREATE_DEVICE_DEBUG);
+		if (SUCCEEDED(hr)) return hr;
+
+		// Null 드라이버는 SDK 레이어(Graphics Tools)가 없으면 생성 실패 // Warp는 실제로 래스터라이즈하므로 측정값이 달라짐
+		cerr << "========================================================================" << endl;
+		cerr << "경고: Null 렌더 백엔드를 사용할 수 없어 Warp로 대체합니다. 에러 코드: " << hex << hr << dec << endl;
+		cerr << "SDK 레이어(Graphics Tools)가 설치되어 있는지 확인하세요." << endl;
+		cerr << "리소스는 Warp 디바이스로 만들고 그리기와 업로드는 제출하지 않습니다." << endl;
+		cerr << "========================================================================" << endl;
+		m_type = RenderBackendType::Warp;
+		m_isSubmissionSkipped = true;
+
+		// SDK 레이어가 없으면 디버그 디바이스도 만들 수 없음
+		return create(D3D_DRIVER_TYPE_WARP, flags & ~D3D11_CREATE_DEVICE_DEBUG);
+	}
+
+	case RenderBackendType::Warp:
+		return create(D3D_DRIVER_TYPE_WARP, flags);
+
+	default:
+		return create(D3D_DRIVER_TYPE_HARDWARE, flags);
+	}
+}
+
+void RenderBackend::Draw(ID3D11DeviceContext* deviceContext, UINT vertexCount, UINT startVertexLocation)
+{
+	CountDraw();
+	if (!m_isSubmissionSkipped) deviceContext->Draw(vertexCount, startVertexLocation);
+}
+
+void RenderBackend::DrawIndexed(ID3D11DeviceContext* deviceContext, UINT indexCount, UINT startIndexLocation, INT baseVertexLocation)
+{
+	CountDraw();
+	if (!m_isSubmissionSkipped) deviceContext->DrawIndexed(indexCount, startIndexLocation, baseVertexLocation);
+}
+
+void RenderBackend::DrawInstanced(ID3D11DeviceContext* deviceContext, UINT vertexCountPerInstance, UINT instanceCount, UINT startVertexLocation, UINT startInstanceLocation)
+{
+	CountDraw();
+	if (!m_isSubmissionSkipped) deviceContext->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+}
+
+void RenderBackend::UpdateSubresource(ID3D11DeviceContext* deviceContext, ID3D11Resource* resource, const void* data)
+{
+	CountUpload();
+	if (!m_isSubmissionSkipped) deviceContext->UpdateSubresource(resource, 0, nullptr, data, 0, 0);
+}
+
+void RenderBackend::RecordBuffer(const D3D11_BUFFER_DESC& desc)
+{
+	m_stats.bufferCount.fetch_add(1, memory_order_relaxed);
+	m_stats.bufferBytes.fetch_add(desc.ByteWidth, memory_order_relaxed);
+}
+
+void RenderBackend::RecordShader(SIZE_T bytecodeSize)
+{
+	m_stats.shaderCount.fetch_add(1, memory_order_relaxed);
+	m_stats.shaderBytes.fetch_add(bytecodeSize, memory_order_relaxed);
+}
+
+void RenderBackend::RecordTexture(const D3D11_TEXTURE2D_DESC& desc)
+{
+	uint64_t bytes = static_cast<uint64_t>(desc.Width) * desc.Height * desc.ArraySize * max<UINT>(1, desc.SampleDesc.Count) * GetBitsPerPixel(desc.Format) / 8;
+
+	// 밉맵 체인은 원본의 약 1/3 추가
+	if (desc.MipLevels != 1) bytes += bytes / 3;
+
+	m_stats.textureCount.fetch_add(1, memory_order_relaxed);
+	m_stats.textureBytes.fetch_add(bytes, memory_order_relaxed);
+}
+
+void RenderBackend::RecordTexture(ID3D11ShaderResourceView* shaderResourceView)
+{
+	if (!shaderResourceView) return;
+
+	com_ptr<ID3D11Resource> resource = nullptr;
+	shaderResourceView->GetResource(resource.GetAddressOf());
+
+	com_ptr<ID3D11Texture2D> texture = nullptr;
+	if (FAILED(resource.As(&texture))) return;
+
+	D3D11_TEXTURE2D_DESC desc = {};
+	texture->GetDesc(&desc);
+	RecordTexture(desc);
+}
+
+void RenderBackend::PrintStats() const
+{
+	constexpr double BYTES_TO_MEGABYTES = 1.0 / (1024.0 * 1024.0);
+
+	cout << "[렌더 백엔드] " << GetTypeName(m_type) << (m_isHeadless ? " (헤드리스)" : "") << (m_isSubmissionSkipped ? " (Null 대체, 제출 생략)" : "") << endl;
+	cout << "버퍼 " << m_stats.bufferCount.load() << "개, " << m_stats.bufferBytes.load() * BYTES_TO_MEGABYTES << " MB" << endl;
+	cout << "셰이더 " << m_stats.shaderCount.load() << "개, " << m_stats.shaderBytes.load() * BYTES_TO_MEGABYTES << " MB" << endl;
+	cout << "텍스처 " << m_stats.textureCount.load() << "개, " << m_stats.textureBytes.load() * BYTES_TO_MEGABYTES << " MB" << endl;
+
+	const uint64_t frameCount = m_stats.frameCount.load();
+	const auto printPerFrame = [frameCount](const char* name, uint64_t count)
+		{
+			cout << name << " " << count << "회";
+			if (frameCount > 0) cout << " (프레임당 " << static_cast<double>(count) / frameCount << "회)";
+			cout << endl;
+		};
+	printPerFrame("그리기", m_stats.drawCount.load());
+	printPerFrame("업로드", m_stats.uploadCount.load());
+}
+
+void RenderBackend::CountDraw()
+{
+	m_stats.drawCount.fetch_add(1, memory_order_relaxed);
+	TELEMETRY_COUNT("Renderer.DrawCalls", 1);
+}
+
+void RenderBackend::CountUpload()
+{
+	m_stats.uploadCount.fetch_add(1, memory_order_relaxed);
+	TELEMETRY_COUNT("Renderer.Uploads", 1);
+}
+
+const char* RenderBackend::GetTypeName(RenderBackendType type)
+{
+	switch (type)
+	{
+	case RenderBackendType::Hardware:
+		return "Hardware";
+	case RenderBackendType::Warp:
+		return "Warp";
+	case RenderBackendType::Null:
+		return "Null";
+	default:
+		return "Unknown";
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+// 렌더 백엔드 종류
+enum class RenderBackendType
+{
+	Hardware, // GPU 드라이버
+	Warp, // CPU 소프트웨어 래스터라이저 // GPU 없는 환경용
+	Null, // 렌더링하지 않는 드라이버 // 호출만 받고 결과 없음 // 사용할 수 없으면 Warp 디바이스로 리소스만 만들고 렌더 명령과 업로드는 제출하지 않음
+
+	Count
+};
+
+// 백엔드에서 생성한 리소스와 제출한 렌더 명령 수 // 백그라운드 씬 읽기에서도 기록하므로 원자적
+struct RenderBackendStats
+{
+	std::atomic<uint64_t> bufferCount = 0; // 생성한 버퍼 수
+	std::atomic<uint64_t> bufferBytes = 0; // 생성한 버퍼 크기 합
+	std::atomic<uint64_t> shaderCount = 0; // 생성한 셰이더 수
+	std::atomic<uint64_t> shaderBytes = 0; // 생성한 셰이더 바이트코드 크기 합
+	std::atomic<uint64_t> textureCount = 0; // 생성한 텍스처 수
+	std::atomic<uint64_t> textureBytes = 0; // 생성한 텍스처 크기 합 // 밉맵 포함 추정치
+	std::atomic<uint64_t> drawCount = 0; // 그리기 호출 수
+	std::atomic<uint64_t> uploadCount = 0; // 리소스 업로드 호출 수
+	std::atomic<uint64_t> frameCount = 0; // 종료한 프레임 수
+};
+
+// 디바이스 생성 시 드라이버 선택과 리소스 생성, 렌더 명령 제출 기록 담당
+// 헤드리스 모드에서는 창을 표시하지 않고 스왑 체인 대신 화면 밖 백 버퍼에 렌더링 // 빌드 서버에서 CPU 프레임 비용 측정용
+class RenderBackend : public Singleton<RenderBackend>
+{
+	friend class Singleton<RenderBackend>;
+
+	RenderBackendType m_type = RenderBackendType::Hardware; // 요청한 백엔드 종류 // 대체되면 실제 사용한 종류로 갱신
+	bool m_isHeadless = false; // 헤드리스 모드 여부
+	bool m_isSubmissionSkipped = false; // Null 백엔드를 Warp로 대체했을 때 그리기와 업로드를 기록만 하고 제출하지 않음
+
+	RenderBackendStats m_stats = {};
+
+public:
+	~RenderBackend() = default;
+	RenderBackend(const RenderBackend&) = delete;
+	RenderBackend& operator=(const RenderBackend&) = delete;
+	RenderBackend(RenderBackend&&) = delete;
+	RenderBackend& operator=(RenderBackend&&) = delete;
+
+	// 백엔드 설정 // 렌더러 초기화 전에 호출
+	void SetType(RenderBackendType type) { m_type = type; }
+	RenderBackendType GetType() const { return m_type; }
+	void SetHeadless(bool isHeadless) { m_isHeadless = isHeadless; }
+	bool IsHeadless() const { return m_isHeadless; }
+
+	// 설정된 드라이버로 디바이스 및 디바이스 컨텍스트 생성 // Null 드라이버를 사용할 수 없으면 경고 후 Warp로 대체
+	HRESULT CreateDevice(const D3D_FEATURE_LEVEL* featureLevels, UINT featureLevelCount, UINT flags, com_ptr<ID3D11Device>& device, com_ptr<ID3D11DeviceContext>& deviceContext);
+
+	// 리소스 생성 기록
+	void RecordBuffer(const D3D11_BUFFER_DESC& desc);
+	void RecordShader(SIZE_T bytecodeSize);
+	void RecordTexture(const D3D11_TEXTURE2D_DESC& desc);
+	// 셰이더 리소스 뷰가 가리키는 텍스처 생성 기록 // 파일에서 읽은 텍스처용
+	void RecordTexture(ID3D11ShaderResourceView* shaderResourceView);
+	void RecordFrame() { m_stats.frameCount.fetch_add(1, std::memory_order_relaxed); }
+
+	// 그리기 및 리소스 업로드 // 디바이스 컨텍스트를 직접 호출하지 말고 이 함수로 기록 후 제출
+	void Draw(ID3D11DeviceContext* deviceContext, UINT vertexCount, UINT startVertexLocation);
+	void DrawIndexed(ID3D11DeviceContext* deviceContext, UINT indexCount, UINT startIndexLocation, INT baseVertexLocation);
+	void DrawInstanced(ID3D11DeviceContext* deviceContext, UINT vertexCountPerInstance, UINT instanceCount, UINT startVertexLocation, UINT startInstanceLocation);
+	// 리소스 전체를 data로 갱신 // 상수 버퍼용
+	void UpdateSubresource(ID3D11DeviceContext* deviceContext, ID3D11Resource* resource, const void* data);
+	// SpriteBatch에 넣은 스프라이트 기록 // 그리기는 SpriteBatch가 End에서 같은 텍스처끼리 묶어 제출하므로 실제 호출 수의 상한
+	void RecordSpriteDraw() { CountDraw(); }
+	bool IsSubmissionSkipped() const { return m_isSubmissionSkipped; }
+
+	const RenderBackendStats& GetStats() const { return m_stats; }
+	// 통계 콘솔 출력
+	void PrintStats() const;
+
+	static const char* GetTypeName(RenderBackendType type);
+
+private:
+	RenderBackend() = default;
+
+	// 그리기, 업로드 수를 통계와 원격 측정에 함께 기록
+	void CountDraw();
+	void CountUpload();
+};
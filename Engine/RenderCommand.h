@@ -0,0 +1,98 @@
+#pragma once
+#include "FrameArena.h"
+
+// 렌더 명령어 // 반환값, 인자 없는 호출 가능 객체를 힙 할당 없이 보관
+// 캡처가 INLINE_CAPACITY 이하면 내부 버퍼에, 넘으면 프레임 아레나에 생성 // 프레임 아레나 초기화 전에 실행, 소멸해야 함
+// 이동만 가능
+class RenderCommand
+{
+public:
+	static constexpr size_t INLINE_CAPACITY = 64; // [&] 캡처 람다, std::function이 들어가는 크기
+	static constexpr size_t INLINE_ALIGNMENT = 16; // XMVECTOR 캡처용
+
+private:
+	struct Operations
+	{
+		void (*invoke)(void* callable) = nullptr;
+		void (*relocate)(void* destination, void* source) = nullptr; // 내부 버퍼에 있을 때만 사용
+		void (*destroy)(void* callable) = nullptr;
+	};
+
+	template<typename F>
+	struct CallableOperations
+	{
+		static void Invoke(void* callable) { (*static_cast<F*>(callable))(); }
+		static void Relocate(void* destination, void* source)
+		{
+			::new (destination) F(std::move(*static_cast<F*>(source)));
+			static_cast<F*>(source)->~F();
+		}
+		static void Destroy(void* callable) { static_cast<F*>(callable)->~F(); }
+
+		static constexpr Operations OPERATIONS = { .invoke = Invoke, .relocate = Relocate, .destroy = Destroy };
+	};
+
+	alignas(INLINE_ALIGNMENT) std::byte m_storage[INLINE_CAPACITY]; // 매 명령어마다 0으로 채우지 않도록 초기화 안 함
+	void* m_arenaCallable = nullptr; // 프레임 아레나에 생성했으면 그 주소 // 아니면 내부 버퍼 사용
+	const Operations* m_operations = nullptr; // 비어 있으면 nullptr
+
+public:
+	RenderCommand() = default;
+	template<typename F> requires (!std::is_same_v<std::remove_cvref_t<F>, RenderCommand> && std::is_invocable_v<std::remove_cvref_t<F>&>)
+	RenderCommand(F&& function)
+	{
+		using Callable = std::remove_cvref_t<F>;
+
+		if constexpr (sizeof(Callable) <= INLINE_CAPACITY && alignof(Callable) <= INLINE_ALIGNMENT && std::is_nothrow_move_constructible_v<Callable>)
+		{
+			::new (static_cast<void*>(m_storage)) Callable(std::forward<F>(function));
+		}
+		else
+		{
+			m_arenaCallable = FrameArena::GetInstance().Allocate(sizeof(Callable), alignof(Callable));
+			::new (m_arenaCallable) Callable(std::forward<F>(function));
+		}
+		m_operations = &CallableOperations<Callable>::OPERATIONS;
+	}
+	~RenderCommand() { Reset(); }
+	RenderCommand(const RenderCommand&) = delete;
+	RenderCommand& operator=(const RenderCommand&) = delete;
+	RenderCommand(RenderCommand&& other) noexcept { MoveFrom(other); }
+	RenderCommand& operator=(RenderCommand&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Reset();
+			MoveFrom(other);
+		}
+		return *this;
+	}
+
+	void operator()() { m_operations->invoke(GetCallable()); }
+	explicit operator bool() const { return m_operations != nullptr; }
+
+private:
+	void* GetCallable() { return m_arenaCallable ? m_arenaCallable : static_cast<void*>(m_storage); }
+
+	void Reset()
+	{
+		if (!m_operations) return;
+
+		m_operations->destroy(GetCallable());
+		m_operations = nullptr;
+		m_arenaCallable = nullptr;
+	}
+
+	// other는 빈 상태가 됨 // 프레임 아레나에 있으면 주소만 옮김
+	void MoveFrom(RenderCommand& other)
+	{
+		if (!other.m_operations) return;
+
+		if (other.m_arenaCallable) m_arenaCallable = other.m_arenaCallable;
+		else other.m_operations->relocate(m_storage, other.m_storage);
+
+		m_operations = other.m_operations;
+		other.m_operations = nullptr;
+		other.m_arenaCallable = nullptr;
+	}
+};
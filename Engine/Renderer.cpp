@@ -1,9 +1,15 @@
 #include "stdafx.h"
 #include "Renderer.h"
 
+#include <d3d11_4.h>
+
 #include "ResourceManager.h"
 #include "SceneManager.h"
 #include "SceneBase.h"
+#include "JobSystem.h"
+#include "RenderBackend.h"
+#include "Profiler.h"
+#include "Telemetry.h"
 
 using namespace std;
 using namespace DirectX;
@@ -11,9 +17,17 @@ using namespace DirectX;
 void Renderer::Initialize(HWND hWnd)
 {
 	CreateDeviceAndContext();
-	CreateSwapChain(hWnd);
 	CreateBackBufferResources();
 	CreateShadowMapRenderTargets();
+
+	// 헤드리스 모드는 창 크기 변경 메시지가 없으므로 화면 밖 렌더 타겟을 바로 생성
+	if (RenderBackend::GetInstance().IsHeadless())
+	{
+		CreateBackBufferRenderTarget();
+		CreateSceneRenderTarget();
+		SetViewport();
+	}
+	else CreateSwapChain(hWnd);
 }
 
 void Renderer::BeginFrame()
@@ -54,6 +68,7 @@ void Renderer::BeginFrame()
 
 void Renderer::RenderTextScreenPosition(const wchar_t* text, XMFLOAT2 position, float depth, const XMVECTOR& color, float scale, const wstring& fontName)
 {
+	RenderBackend::GetInstance().RecordSpriteDraw();
 	ResourceManager::GetInstance().GetSpriteFont(fontName)->DrawString
 	(
 		m_spriteBatch,
@@ -75,6 +90,7 @@ void Renderer::RenderTextUIPosition(const wchar_t* text, XMFLOAT2 position, floa
 
 void Renderer::RenderImageScreenPosition(com_ptr<ID3D11ShaderResourceView> texture, XMFLOAT2 position, XMFLOAT2 offset, float scale, const XMVECTOR& color, float depth, const RECT* srcRect)
 {
+	RenderBackend::GetInstance().RecordSpriteDraw();
 	m_spriteBatch->Draw(texture.Get(), position, srcRect, color, 0.0f, offset, scale, SpriteEffects_None, depth);
 }
 
@@ -83,11 +99,50 @@ void Renderer::RenderImageUIPosition(com_ptr<ID3D11ShaderResourceView> texture,
 	RenderImageScreenPosition(texture, { position.x, position.y }, offset, scale, color, depth, srcRect); //pixel position
 }
 
+vector<pair<float, RenderCommand>>& Renderer::RENDER_FUNCTION(RenderStage renderStage, BlendState blendState)
+{
+	const size_t workerIndex = m_isParallelRecording ? JobSystem::GetCurrentWorkerIndex() : JobSystem::NOT_WORKER;
+	if (workerIndex != JobSystem::NOT_WORKER) return m_workerRenderPasses[workerIndex][static_cast<size_t>(renderStage)][static_cast<size_t>(blendState)];
+
+	return m_renderPass[static_cast<size_t>(renderStage)].second[static_cast<size_t>(blendState)];
+}
+
+void Renderer::BeginParallelRecording(size_t workerCount)
+{
+	if (m_workerRenderPasses.size() < workerCount) m_workerRenderPasses.resize(workerCount);
+	m_isParallelRecording = true;
+}
+
+void Renderer::EndParallelRecording()
+{
+	m_isParallelRecording = false;
+
+	// 목록 용량은 다음 프레임에 재사용
+	for (RenderFunctionPass& workerRenderPass : m_workerRenderPasses)
+	{
+		for (size_t stage = 0; stage < workerRenderPass.size(); ++stage)
+		{
+			for (size_t blend = 0; blend < workerRenderPass[stage].size(); ++blend)
+			{
+				vector<pair<float, RenderCommand>>& source = workerRenderPass[stage][blend];
+				if (source.empty()) continue;
+
+				vector<pair<float, RenderCommand>>& destination = m_renderPass[stage].second[blend];
+				destination.insert(destination.end(), make_move_iterator(source.begin()), make_move_iterator(source.end()));
+				source.clear();
+			}
+		}
+	}
+}
+
 void Renderer::EndFrame()
 {
+	PROFILE_FUNCTION();
+
 	HRESULT hr = S_OK;
 
 	ResourceManager& resourceManager = ResourceManager::GetInstance();
+	RenderBackend& renderBackend = RenderBackend::GetInstance();
 
 	for (auto& [renderTarget, blendStates] : m_renderPass)
 	{
@@ -95,12 +150,18 @@ void Renderer::EndFrame()
 		UnbindShaderResources();
 
 		// 백 버퍼 렌더 타겟으로 설정
-		vector<ID3D11RenderTargetView*> rtvs = {};
+		FrameVector<ID3D11RenderTargetView*> rtvs = {};
+		rtvs.reserve(renderTarget.renderTargets.size());
 		for (auto& [texture, rtv] : renderTarget.renderTargets) rtvs.push_back(rtv.Get());
 		m_deviceContext->OMSetRenderTargets(static_cast<UINT>(rtvs.size()), rtvs.data(), renderTarget.depthStencil.second.Get());
 
 		const RenderStage RENDER_STAGE = static_cast<RenderStage>(&renderTarget - &m_renderPass[0].first);
 
+		#if PROFILER_ENABLED
+		constexpr array<const char*, static_cast<size_t>(RenderStage::Count)> RENDER_STAGE_NAMES = { "DirectionalLightShadow", "Scene", "BackBuffer" };
+		#endif
+		PROFILE_SCOPE(RENDER_STAGE_NAMES[static_cast<size_t>(RENDER_STAGE)]);
+
 		// 렌더 타겟 클리어
 		ClearRenderTarget(renderTarget);
 
@@ -116,7 +177,12 @@ void Renderer::EndFrame()
 			else sort(blendState.begin(), blendState.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
 
 			// 렌더 명령어 실행
-			for (auto& [priority, command] : blendState) command();
+			for (auto& [priority, command] : blendState)
+			{
+				PROFILE_SCOPE("RenderCommand");
+				command();
+			}
+			TELEMETRY_COUNT("Renderer.RenderCommands", blendState.size());
 
 			// 렌더 명령어 클리어
 			blendState.clear();
@@ -124,8 +190,11 @@ void Renderer::EndFrame()
 	}
 
 	// 2D UI 렌더링
+	TELEMETRY_COUNT("Renderer.UIRenderCommands", m_UIRenderFunctions.size());
 	RenderXTKSpriteBatch();
 
+	// 렌더 명령어를 모두 실행, 소멸했으므로 이번 프레임 임시 메모리 일괄 해제
+	FrameArena::GetInstance().Reset();
 
 	#ifdef _DEBUG
 	ImGui::Begin("SRV");
@@ -146,7 +215,11 @@ void Renderer::EndFrame()
 
 	#endif
 
-	// 스왑 체인 프레젠트
+	renderBackend.RecordFrame();
+
+	// 스왑 체인 프레젠트 // 헤드리스 모드는 스왑 체인 없음
+	if (!m_swapChain) return;
+
 	hr = m_swapChain->Present(1, 0);
 	CheckResult(hr, "스왑 체인 프레젠트 실패.");
 }
@@ -307,25 +380,24 @@ void Renderer::CreateDeviceAndContext()
 {
 	HRESULT hr = S_OK;
 
-	hr = D3D11CreateDevice
+	hr = RenderBackend::GetInstance().CreateDevice
 	(
-		nullptr,
-		D3D_DRIVER_TYPE_HARDWARE,
-		nullptr,
+		m_featureLevels.data(),
+		static_cast<UINT>(m_featureLevels.size()),
 		#ifdef _DEBUG
 		D3D11_CREATE_DEVICE_DEBUG,
 		#else
 		0,
 		#endif
-		m_featureLevels.data(),
-		static_cast<UINT>(m_featureLevels.size()),
-		D3D11_SDK_VERSION,
-		m_device.GetAddressOf(),
-		nullptr,
-		m_deviceContext.GetAddressOf()
+		m_device,
+		m_deviceContext
 	);
 	CheckResult(hr, "디바이스 및 디바이스 컨텍스트 생성 실패.");
 
+	// 백그라운드 씬 로드 중 텍스처 생성(밉맵 생성)이 즉시 컨텍스트를 사용하므로 컨텍스트 호출 직렬화
+	com_ptr<ID3D11Multithread> multithread = nullptr;
+	if (SUCCEEDED(m_deviceContext.As(&multithread))) multithread->SetMultithreadProtected(TRUE);
+
 	#ifdef _DEBUG
 	// ImGui DirectX11 초기화
 	ImGui_ImplDX11_Init(m_device.Get(), m_deviceContext.Get());
@@ -369,8 +441,31 @@ void Renderer::CreateBackBufferRenderTarget()
 	HRESULT hr = S_OK;
 
 	com_ptr<ID3D11Texture2D> backBufferTexture = nullptr;
-	hr = m_swapChain->GetBuffer(0, IID_PPV_ARGS(&backBufferTexture));
-	CheckResult(hr, "스왑 체인 버퍼 얻기 실패.");
+	if (m_swapChain)
+	{
+		hr = m_swapChain->GetBuffer(0, IID_PPV_ARGS(&backBufferTexture));
+		CheckResult(hr, "스왑 체인 버퍼 얻기 실패.");
+	}
+	else
+	{
+		// 헤드리스 모드 // 스왑 체인 설정과 같은 크기의 화면 밖 텍스처
+		const D3D11_TEXTURE2D_DESC backBufferDesc =
+		{
+			.Width = m_swapChainDesc.Width,
+			.Height = m_swapChainDesc.Height,
+			.MipLevels = 1,
+			.ArraySize = 1,
+			.Format = m_swapChainDesc.Format,
+			.SampleDesc = m_swapChainDesc.SampleDesc,
+			.Usage = D3D11_USAGE_DEFAULT,
+			.BindFlags = D3D11_BIND_RENDER_TARGET,
+			.CPUAccessFlags = 0,
+			.MiscFlags = 0
+		};
+		hr = m_device->CreateTexture2D(&backBufferDesc, nullptr, backBufferTexture.GetAddressOf());
+		CheckResult(hr, "화면 밖 백 버퍼 텍스처 생성 실패.");
+		RenderBackend::GetInstance().RecordTexture(backBufferDesc);
+	}
 
 	// 렌더 타겟 뷰 생성
 	const D3D11_RENDER_TARGET_VIEW_DESC rtvDesc =
@@ -413,6 +508,7 @@ void Renderer::CreateBackBufferResources()
 
 	hr = m_device->CreateBuffer(&bufferDesc, &initialData, m_backBufferVertexBuffer.GetAddressOf());
 	CheckResult(hr, "백 버퍼 정점 버퍼 생성 실패.");
+	RenderBackend::GetInstance().RecordBuffer(bufferDesc);
 
 	ResourceManager& resourceManager = ResourceManager::GetInstance();
 	// 정점 셰이더 및 입력 레이아웃 생성
@@ -448,6 +544,10 @@ void Renderer::CreateSceneRenderTarget()
 	hr = m_device->CreateTexture2D(&textureDesc, nullptr, sceneThresholdTexture.GetAddressOf());
 	CheckResult(hr, "씬 임계값 텍스처 생성 실패.");
 
+	RenderBackend& renderBackend = RenderBackend::GetInstance();
+	renderBackend.RecordTexture(textureDesc);
+	renderBackend.RecordTexture(textureDesc);
+
 	// 렌더 타겟 뷰 생성
 	D3D11_RENDER_TARGET_VIEW_DESC rtvDesc =
 	{
@@ -482,6 +582,7 @@ void Renderer::CreateSceneRenderTarget()
 	com_ptr<ID3D11Texture2D> depthStencilTexture = nullptr;
 	hr = m_device->CreateTexture2D(&depthStencilDesc, nullptr, depthStencilTexture.GetAddressOf());
 	CheckResult(hr, "씬 깊이-스텐실 텍스처 생성 실패.");
+	renderBackend.RecordTexture(depthStencilDesc);
 
 	// 깊이-스텐실 뷰 생성
 	const D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc =
@@ -516,6 +617,7 @@ void Renderer::CreateSceneRenderTarget()
 	};
 	hr = m_device->CreateTexture2D(&sceneResultDesc, nullptr, m_sceneResultTexture.GetAddressOf());
 	CheckResult(hr, "씬 결과 텍스처 생성 실패.");
+	renderBackend.RecordTexture(sceneResultDesc);
 
 	// 씬 렌더 타겟의 셰이더 리소스 뷰 생성
 	const D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc =
@@ -549,6 +651,7 @@ void Renderer::CreateShadowMapRenderTargets()
 	com_ptr<ID3D11Texture2D> directionalLightShadowMapTexture = nullptr;
 	hr = m_device->CreateTexture2D(&shadowMapDesc, nullptr, directionalLightShadowMapTexture.GetAddressOf());
 	CheckResult(hr, "방향성 광원 그림자 맵 텍스처 생성 실패.");
+	RenderBackend::GetInstance().RecordTexture(shadowMapDesc);
 
 	// 방향성 광원 그림자 맵 깊이-스텐실 뷰 생성
 	const D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc =
@@ -632,7 +735,7 @@ void Renderer::RenderSceneToBackBuffer()
 
 	m_deviceContext->PSSetShaderResources(static_cast<UINT>(TextureSlots::BackBuffer), 1, m_sceneShaderResourceView.GetAddressOf());
 
-	m_deviceContext->Draw(3, 0);
+	RenderBackend::GetInstance().Draw(m_deviceContext.Get(), 3, 0);
 }
 
 void Renderer::RenderXTKSpriteBatch()
@@ -683,16 +786,16 @@ void Renderer::RenderXTKSpriteBatch()
 
 	// 픽셀 셰이더 리소스 뷰 및 샘플러 상태 저장
 	const UINT srvCount = static_cast<UINT>(TextureSlots::Count);
-	std::vector<ID3D11ShaderResourceView*> savedPSSRVs(srvCount, nullptr);
+	FrameVector<ID3D11ShaderResourceView*> savedPSSRVs(srvCount, nullptr);
 	m_deviceContext->PSGetShaderResources(0, srvCount, savedPSSRVs.data());
 
-	std::vector<ID3D11SamplerState*> savedPSSamplers(srvCount, nullptr);
+	FrameVector<ID3D11SamplerState*> savedPSSamplers(srvCount, nullptr);
 	m_deviceContext->PSGetSamplers(0, srvCount, savedPSSamplers.data());
 
 	// 콘스탄트 버퍼 저장
 	const UINT cbSaveCount = 8;
-	std::vector<ID3D11Buffer*> savedPSCB(cbSaveCount, nullptr);
-	std::vector<ID3D11Buffer*> savedVSCB(cbSaveCount, nullptr);
+	FrameVector<ID3D11Buffer*> savedPSCB(cbSaveCount, nullptr);
+	FrameVector<ID3D11Buffer*> savedVSCB(cbSaveCount, nullptr);
 	m_deviceContext->PSGetConstantBuffers(0, cbSaveCount, savedPSCB.data());
 	m_deviceContext->VSGetConstantBuffers(0, cbSaveCount, savedVSCB.data());
 
@@ -701,7 +804,11 @@ void Renderer::RenderXTKSpriteBatch()
 	// 알파 블랜딩 적용하게끔 : auto* blend 
 	auto* blend = ResourceManager::GetInstance().GetBlendState(BlendState::AlphaBlend).Get();
 	m_spriteBatch->Begin(SpriteSortMode_FrontToBack, blend, nullptr, nullptr, nullptr, nullptr, XMMatrixIdentity());
-	for (function<void()>& uiRenderFunction : m_UIRenderFunctions) uiRenderFunction();
+	for (RenderCommand& uiRenderFunction : m_UIRenderFunctions)
+	{
+		PROFILE_SCOPE("UIRenderCommand");
+		uiRenderFunction();
+	}
 	m_UIRenderFunctions.clear();
 	m_spriteBatch->End();
 
@@ -1,8 +1,11 @@
 #pragma once
 #include "Resource.h"
+#include "RenderCommand.h"
 
 // 렌더 패스 정의
-using RenderPass = std::array<std::pair<RenderTarget, std::array<std::vector<std::pair<float, std::function<void()>>>, static_cast<size_t>(BlendState::Count)>>, static_cast<size_t>(RenderStage::Count)>;
+using RenderPass = std::array<std::pair<RenderTarget, std::array<std::vector<std::pair<float, RenderCommand>>, static_cast<size_t>(BlendState::Count)>>, static_cast<size_t>(RenderStage::Count)>;
+// 렌더 타겟 없이 렌더 함수 목록만 담은 렌더 패스 // 작업자별 기록용
+using RenderFunctionPass = std::array<std::array<std::vector<std::pair<float, RenderCommand>>, static_cast<size_t>(BlendState::Count)>, static_cast<size_t>(RenderStage::Count)>;
 
 class Renderer : public Singleton<Renderer>
 {
@@ -38,9 +41,11 @@ class Renderer : public Singleton<Renderer>
 
 	DirectX::XMVECTOR m_renderSortPoint = DirectX::XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f); // 랜더 정렬 기준점
 	RenderPass m_renderPass = {};
+	std::vector<RenderFunctionPass> m_workerRenderPasses = {}; // 작업자별 렌더 함수 목록 // 병렬 기록 중에만 사용 후 m_renderPass로 병합
+	bool m_isParallelRecording = false; // 병렬 기록 중 여부
 
 	DirectX::SpriteBatch* m_spriteBatch = nullptr; // 스프라이트 배치 // UI 렌더링용
-	std::vector<std::function<void()>> m_UIRenderFunctions = {}; // ImGui 렌더링 함수 목록
+	std::vector<RenderCommand> m_UIRenderFunctions = {}; // ImGui 렌더링 함수 목록
 
 	// 백 버퍼 렌더 타겟 관련 리소스
 	struct BackBufferVertex
@@ -87,10 +92,14 @@ public:
 	const DirectX::XMVECTOR& GetRenderSortPoint() const { return m_renderSortPoint; }
 
 	constexpr RenderTarget& RENDER_TARGET(RenderStage stage) { return m_renderPass[static_cast<size_t>(stage)].first; }
-	constexpr std::vector<std::pair<float, std::function<void()>>>& RENDER_FUNCTION(RenderStage renderStage, BlendState blendState) { return m_renderPass[static_cast<size_t>(renderStage)].second[static_cast<size_t>(blendState)]; }
+	// 병렬 기록 중 작업자 스레드에서 호출하면 해당 작업자의 목록 반환
+	std::vector<std::pair<float, RenderCommand>>& RENDER_FUNCTION(RenderStage renderStage, BlendState blendState);
+	// 렌더 단계 병렬 실행 전후 호출 // 작업자별 목록을 EndParallelRecording에서 메인 목록 뒤에 병합 // UI_RENDER_FUNCTIONS는 메인 스레드 전용
+	void BeginParallelRecording(size_t workerCount);
+	void EndParallelRecording();
 
 	// UI 렌더링 함수
-	constexpr std::vector<std::function<void()>>& UI_RENDER_FUNCTIONS() { return m_UIRenderFunctions; }
+	constexpr std::vector<RenderCommand>& UI_RENDER_FUNCTIONS() { return m_UIRenderFunctions; }
 	// 월드 좌표 -> 스크린 좌표 변환
 	DirectX::XMFLOAT2 ToScreenPosition(const DirectX::XMFLOAT2& worldPosition)
 	{
@@ -1,6 +1,10 @@
 #include "stdafx.h"
 #include "ResourceManager.h"
 
+#include "RenderBackend.h"
+#include "Telemetry.h"
+#include "MemoryTracker.h"
+
 using namespace std;
 using namespace DirectX;
 
@@ -39,6 +43,7 @@ void ResourceManager::Initialize(com_ptr<ID3D11Device> device, com_ptr<ID3D11Dev
 {
 	m_device = device;
 	m_deviceContext = deviceContext;
+	m_mainThreadId = this_thread::get_id();
 	m_spriteBatch = make_unique<SpriteBatch>(m_deviceContext.Get());
 
 	CreateDepthStencilStates();
@@ -55,7 +60,12 @@ void ResourceManager::Initialize(com_ptr<ID3D11Device> device, com_ptr<ID3D11Dev
 
 void ResourceManager::SetDepthStencilState(DepthStencilState state)
 {
-	if (m_currentDepthStencilState == state) return;
+	if (m_currentDepthStencilState == state)
+	{
+		TELEMETRY_COUNT("State.RedundantSets", 1);
+		return;
+	}
+	TELEMETRY_COUNT("State.DepthStencilChanges", 1);
 
 	m_deviceContext->OMSetDepthStencilState(m_depthStencilStates[static_cast<size_t>(state)].Get(), 0);
 	m_currentDepthStencilState = state;
@@ -63,7 +73,12 @@ void ResourceManager::SetDepthStencilState(DepthStencilState state)
 
 void ResourceManager::SetBlendState(BlendState state)
 {
-	if (m_currentBlendState == state) return;
+	if (m_currentBlendState == state)
+	{
+		TELEMETRY_COUNT("State.RedundantSets", 1);
+		return;
+	}
+	TELEMETRY_COUNT("State.BlendChanges", 1);
 
 	constexpr array<FLOAT, 4> blendFactor = { 1.0f, 1.0f, 1.0f, 1.0f }; // 나중에 따로 받도록 수정?
 	m_deviceContext->OMSetBlendState(m_blendStates[static_cast<size_t>(state)].Get(), blendFactor.data(), 0xFFFFFFFF);
@@ -72,7 +87,12 @@ void ResourceManager::SetBlendState(BlendState state)
 
 void ResourceManager::SetRasterState(RasterState state)
 {
-	if (m_currentRasterState == state) return;
+	if (m_currentRasterState == state)
+	{
+		TELEMETRY_COUNT("State.RedundantSets", 1);
+		return;
+	}
+	TELEMETRY_COUNT("State.RasterChanges", 1);
 
 	m_deviceContext->RSSetState(m_rasterStates[static_cast<size_t>(state)].Get());
 	m_currentRasterState = state;
@@ -80,7 +100,12 @@ void ResourceManager::SetRasterState(RasterState state)
 
 void ResourceManager::SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology)
 {
-	if (m_currentTopology == topology) return;
+	if (m_currentTopology == topology)
+	{
+		TELEMETRY_COUNT("State.RedundantSets", 1);
+		return;
+	}
+	TELEMETRY_COUNT("State.TopologyChanges", 1);
 
 	m_deviceContext->IASetPrimitiveTopology(topology);
 	m_currentTopology = topology;
@@ -165,12 +190,15 @@ com_ptr<ID3D11Buffer> ResourceManager::CreateVertexBuffer(const void* data, UINT
 	}
 
 	CheckResult(hr, "범용 정점 버퍼 생성 실패.");
+	RenderBackend::GetInstance().RecordBuffer(bufferDesc);
 
 	return vertexBuffer;
 }
 
 pair<com_ptr<ID3D11VertexShader>, com_ptr<ID3D11InputLayout>> ResourceManager::GetVertexShaderAndInputLayout(const string& shaderName, const vector<InputElement>& inputElements)
 {
+	lock_guard<recursive_mutex> lock(m_cacheMutex);
+
 	// 기존에 생성된 셰이더 및 입력 레이아웃이 있으면 재사용
 	auto it = m_vertexShadersAndInputLayouts.find(shaderName);
 	if (it != m_vertexShadersAndInputLayouts.end()) return it->second;
@@ -187,6 +215,7 @@ pair<com_ptr<ID3D11VertexShader>, com_ptr<ID3D11InputLayout>> ResourceManager::G
 		m_vertexShadersAndInputLayouts[shaderName].first.GetAddressOf()
 	);
 	CheckResult(hr, "정점 셰이더 생성 실패.");
+	RenderBackend::GetInstance().RecordShader(VSCode->GetBufferSize());
 
 	// 입력 레이아웃 생성
 	if (!inputElements.empty())
@@ -210,6 +239,8 @@ pair<com_ptr<ID3D11VertexShader>, com_ptr<ID3D11InputLayout>> ResourceManager::G
 
 com_ptr<ID3D11GeometryShader> ResourceManager::GetGeometryShader(const string& shaderName)
 {
+	lock_guard<recursive_mutex> lock(m_cacheMutex);
+
 	// 기존에 생성된 지오메트리 셰이더가 있으면 재사용
 	auto it = m_geometryShaders.find(shaderName);
 	if (it != m_geometryShaders.end()) return it->second;
@@ -226,12 +257,15 @@ com_ptr<ID3D11GeometryShader> ResourceManager::GetGeometryShader(const string& s
 		m_geometryShaders[shaderName].GetAddressOf()
 	);
 	CheckResult(hr, "지오메트리 셰이더 생성 실패.");
+	RenderBackend::GetInstance().RecordShader(GSCode->GetBufferSize());
 
 	return m_geometryShaders[shaderName];
 }
 
 com_ptr<ID3D11PixelShader> ResourceManager::GetPixelShader(const string& shaderName)
 {
+	lock_guard<recursive_mutex> lock(m_cacheMutex);
+
 	// 기존에 생성된 픽셀 셰이더가 있으면 재사용
 	auto it = m_pixelShaders.find(shaderName);
 	if (it != m_pixelShaders.end()) return it->second;
@@ -248,12 +282,17 @@ com_ptr<ID3D11PixelShader> ResourceManager::GetPixelShader(const string& shaderN
 		m_pixelShaders[shaderName].GetAddressOf()
 	);
 	CheckResult(hr, "픽셀 셰이더 생성 실패.");
+	RenderBackend::GetInstance().RecordShader(PSCode->GetBufferSize());
 
 	return m_pixelShaders[shaderName];
 }
 
 com_ptr<ID3D11ShaderResourceView> ResourceManager::GetTexture(const string& fileName, TextureType type)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Texture);
+
+	lock_guard<recursive_mutex> lock(m_cacheMutex);
+
 	#ifdef _DEBUG
 	// 디버그 모드에서는 매번 새로 생성 (텍스처 변경 감지 용이)
 	const filesystem::path fullPath = "../Asset/Texture/" + fileName;
@@ -350,6 +389,7 @@ com_ptr<ID3D11ShaderResourceView> ResourceManager::GetTexture(const string& file
 		);
 		CheckResult(hr, "텍스처 생성 실패.");
 	}
+	RenderBackend::GetInstance().RecordTexture(m_textures[fileName].Get());
 
 	return m_textures[fileName];
 }
@@ -399,9 +439,16 @@ void ResourceManager::CacheAllModel()
 
 const Model* ResourceManager::LoadModel(const string& fileName)
 {
-	#ifdef NDEBUG
+	MEMORY_TAG_SCOPE(MemoryTag::Model);
+
+	lock_guard<recursive_mutex> lock(m_cacheMutex);
+
 	auto it = m_models.find(fileName);
+	#ifdef NDEBUG
 	if (it != m_models.end()) return &it->second;
+	#else
+	// 백그라운드 스레드는 현재 씬이 사용 중인 모델을 다시 로드하지 않음
+	if (it != m_models.end() && this_thread::get_id() != m_mainThreadId) return &it->second;
 	#endif
 
 	Assimp::Importer importer;
@@ -486,6 +533,47 @@ const Model* ResourceManager::LoadModel(const string& fileName)
 	return &m_models[fileName];
 }
 
+const TriangleBVH* ResourceManager::GetTriangleBVH(const string& fileName)
+{
+	MEMORY_TAG_SCOPE(MemoryTag::Model);
+
+	lock_guard<recursive_mutex> lock(m_cacheMutex);
+
+	auto it = m_triangleBVHs.find(fileName);
+	if (it != m_triangleBVHs.end()) return &it->second;
+
+	const Model* model = LoadModel(fileName);
+	// 스키닝, 리지드 모델은 정점이 움직이므로 정적 삼각형으로 검사할 수 없음
+	if (model->type != ModelType::Static)
+	{
+		cerr << "모델 " << fileName << " 삼각형 BVH 생성 실패 : 정적 모델이 아닙니다." << endl;
+		return nullptr;
+	}
+
+	vector<XMFLOAT3> positions = {};
+	vector<uint32_t> indices = {};
+	GatherTriangles(*model, positions, indices);
+
+	TriangleBVH& bvh = m_triangleBVHs[fileName];
+	bvh.Build(positions, indices);
+
+	return &bvh;
+}
+
+void ResourceManager::GatherTriangles(const Model& model, _Out_ vector<XMFLOAT3>& positions, _Out_ vector<uint32_t>& indices)
+{
+	positions.clear();
+	indices.clear();
+	for (const Mesh& mesh : model.meshes)
+	{
+		if (mesh.topology != D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST) continue;
+
+		const uint32_t baseVertex = static_cast<uint32_t>(positions.size());
+		for (const Vertex& vertex : mesh.vertices) positions.push_back({ vertex.position.x, vertex.position.y, vertex.position.z });
+		for (UINT index : mesh.indices) indices.push_back(baseVertex + index);
+	}
+}
+
 Material ResourceManager::LoadMaterial(const string& materialName)
 {
 	Material material = {};
@@ -500,6 +588,8 @@ Material ResourceManager::LoadMaterial(const string& materialName)
 
 SpriteFont* ResourceManager::GetSpriteFont(const wstring& fontName)
 {
+	lock_guard<recursive_mutex> lock(m_cacheMutex);
+
 	// 기존에 생성된 스프라이트 폰트가 있으면 재사용
 	auto it = m_spriteFonts.find(fontName);
 	if (it != m_spriteFonts.end()) return it->second.get();
@@ -591,6 +681,10 @@ void ResourceManager::CreateConstantBuffers()
 	// 파티클 에미션 상수 버퍼
 	hr = m_device->CreateBuffer(&PS_CONST_BUFFER_DESCS[static_cast<size_t>(PSConstBuffers::ParticleColor)], nullptr, m_psConstantBuffers[static_cast<size_t>(PSConstBuffers::ParticleColor)].GetAddressOf());
 	CheckResult(hr, "ParticleEmission 상수 버퍼 생성 실패.");
+
+	RenderBackend& renderBackend = RenderBackend::GetInstance();
+	for (const D3D11_BUFFER_DESC& desc : VS_CONST_BUFFER_DESCS) renderBackend.RecordBuffer(desc);
+	for (const D3D11_BUFFER_DESC& desc : PS_CONST_BUFFER_DESCS) renderBackend.RecordBuffer(desc);
 }
 
 void ResourceManager::CreateSamplerStates()
@@ -606,6 +700,8 @@ void ResourceManager::CreateSamplerStates()
 
 void ResourceManager::CacheAllTexture()
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Texture);
+
 	const filesystem::path textureDirectory = "../Asset/Texture/";
 
 	for (const auto& dirEntry : filesystem::recursive_directory_iterator(textureDirectory))
@@ -805,6 +901,9 @@ void ResourceManager::CreateMeshBuffers(Mesh& mesh)
 {
 	HRESULT hr = S_OK;
 
+	// 디바이스 초기화 전(마이크로벤치마크)에는 CPU 쪽 정점, 인덱스만 읽음
+	if (!m_device) return;
+
 	// 정점 버퍼 생성
 	if (mesh.vertices.empty()) return;
 	const D3D11_BUFFER_DESC vertexBufferDesc =
@@ -824,6 +923,7 @@ void ResourceManager::CreateMeshBuffers(Mesh& mesh)
 	};
 	hr = m_device->CreateBuffer(&vertexBufferDesc, &vertexInitialData, mesh.vertexBuffer.GetAddressOf());
 	CheckResult(hr, "메쉬 정점 버퍼 생성 실패.");
+	RenderBackend::GetInstance().RecordBuffer(vertexBufferDesc);
 
 	// 인덱스 버퍼 생성
 	if (mesh.indices.empty()) return;
@@ -844,6 +944,7 @@ void ResourceManager::CreateMeshBuffers(Mesh& mesh)
 	};
 	hr = m_device->CreateBuffer(&indexBufferDesc, &indexInitialData, mesh.indexBuffer.GetAddressOf());
 	CheckResult(hr, "메쉬 인덱스 버퍼 생성 실패.");
+	RenderBackend::GetInstance().RecordBuffer(indexBufferDesc);
 }
 
 unique_ptr<SkeletonNode> ResourceManager::BuildSkeletonNode(const aiNode* node, Skeleton& skeleton)
@@ -873,6 +974,8 @@ unique_ptr<SkeletonNode> ResourceManager::BuildSkeletonNode(const aiNode* node,
 /// <param name="model">[out] 우리 엔진 전용 포맷(Model)</param>
 void ResourceManager::LoadAnimations(const aiScene* scene, Model& model)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Animation);
+
 	model.animations.clear();
 	if (!scene || scene->mNumAnimations == 0) return;
 
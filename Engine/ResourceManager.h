@@ -1,6 +1,7 @@
 ///bof ResourceManager.h
 #pragma once
 #include "Resource.h"
+#include "TriangleBVH.h"
 
 class ResourceManager : public Singleton<ResourceManager>
 {
@@ -9,6 +10,9 @@ class ResourceManager : public Singleton<ResourceManager>
 	com_ptr<ID3D11Device> m_device = nullptr; // 디바이스
 	com_ptr<ID3D11DeviceContext> m_deviceContext = nullptr; // 디바이스 컨텍스트
 
+	std::recursive_mutex m_cacheMutex = {}; // 백그라운드 씬 로드와 공유하는 셰이더, 텍스처, 모델 캐시 보호
+	std::thread::id m_mainThreadId = {}; // 초기화한 스레드 ID
+
 	std::array<com_ptr<ID3D11DepthStencilState>, static_cast<size_t>(DepthStencilState::Count)> m_depthStencilStates = {}; // 깊이버퍼 상태 배열
 	DepthStencilState m_currentDepthStencilState = DepthStencilState::Count; // 현재 깊이버퍼 상태
 
@@ -33,6 +37,7 @@ class ResourceManager : public Singleton<ResourceManager>
 	std::unordered_map<std::string, com_ptr<ID3D11ShaderResourceView>> m_textures = {}; // 텍스처 맵 // 키: 텍스처 파일 이름
 
 	std::unordered_map<std::string, Model> m_models = {}; // 모델 맵 // 키: 모델 파일 경로
+	std::unordered_map<std::string, TriangleBVH> m_triangleBVHs = {}; // 모델 삼각형 BVH 맵 // 키: 모델 파일 경로 // 메쉬 콜라이더가 처음 요청할 때 빌드
 
 	std::unique_ptr<DirectX::SpriteBatch> m_spriteBatch = nullptr; // 스프라이트 배치
 	std::unordered_map<std::wstring, std::unique_ptr<DirectX::SpriteFont>> m_spriteFonts = {}; // 스프라이트 폰트 맵 // 키: 폰트 파일 이름
@@ -101,6 +106,10 @@ public:
 	// 모델 파일로부터 모델 로드
 	const Model* LoadModel(const std::string& fileName);
 	Material LoadMaterial(const std::string& materialName);
+	// 모델의 모든 삼각형 메쉬로 만든 BVH 얻기 // 처음 요청할 때 모델을 로드해 빌드 후 캐시 // 정적 모델이 아니면 nullptr
+	const TriangleBVH* GetTriangleBVH(const std::string& fileName);
+	// 모델의 삼각형 메쉬들을 한 정점, 인덱스 배열로 합침 // 모델 렌더링처럼 노드 변환은 적용하지 않음 // BVH 입력
+	static void GatherTriangles(const Model& model, _Out_ std::vector<DirectX::XMFLOAT3>& positions, _Out_ std::vector<uint32_t>& indices);
 
 	DirectX::SpriteBatch* GetSpriteBatch() { return m_spriteBatch.get(); }
 	DirectX::SpriteFont* GetSpriteFont(const std::wstring& fontName);
@@ -3,14 +3,24 @@
 #include "SceneBase.h"
 
 #include "Renderer.h"
+#include "RenderBackend.h"
 #include "CameraComponent.h"
 #include "ResourceManager.h"
 #include "TimeManager.h"
 #include "NavigationManager.h"
 #include "WindowManager.h"
 #include "ModelComponent.h"
+#include "ColliderComponent.h"
+#include "CharacterControllerComponent.h"
 #include "InputManager.h"
 #include "SceneManager.h"
+#include "ObjectPoolManager.h"
+#include "BinarySerializer.h"
+#include "StreamingSceneLoader.h"
+#include "DestructionQueue.h"
+#include "FrameScheduler.h"
+#include "Telemetry.h"
+#include "MemoryTracker.h"
 
 #include "Button.h"
 #include "Slider.h"
@@ -24,30 +34,39 @@ PostProcessingBuffer SceneBase::m_postProcessingData = {};
 
 GameObjectBase* SceneBase::CreateRootGameObject(const string& typeName)
 {
-	unique_ptr<GameObjectBase> gameObject = TypeRegistry::GetInstance().CreateGameObject(typeName);
-	GameObjectBase* gameObjectPtr = gameObject.get();
+	MEMORY_TAG_SCOPE(MemoryTag::Scene);
 
+	GameObjectBase* gameObjectPtr = AttachRootGameObject(TypeRegistry::GetInstance().CreateGameObject(typeName));
 	static_cast<Base*>(gameObjectPtr)->BaseInitialize();
-	m_gameObjects.push_back(move(gameObject));
 
 	return gameObjectPtr;
 }
 
 GameObjectBase* SceneBase::CreatePrefabRootGameObject(const string& prefabFileName)
 {
-	return CreateFromJson(*SceneManager::GetInstance().GetPrefabData(prefabFileName));
+	// 풀링 대상 프리팹이면 풀에서 꺼내서 사용
+	ObjectPoolManager& objectPoolManager = ObjectPoolManager::GetInstance();
+	if (objectPoolManager.IsPooled(prefabFileName))
+	{
+		return AttachRootGameObject(objectPoolManager.Acquire(prefabFileName, nullptr));
+	}
+
+	GameObjectBase* gameObjectPtr = CreateFromJson(*SceneManager::GetInstance().GetPrefabData(prefabFileName));
+	gameObjectPtr->m_prefabFileName = prefabFileName;
+	TELEMETRY_COUNT("Scene.PrefabInstantiations", 1);
+
+	return gameObjectPtr;
 }
 
 GameObjectBase* SceneBase::CreateFromJson(const nlohmann::json& jsonData)
 {
-	unique_ptr<GameObjectBase> gameObject = TypeRegistry::GetInstance().CreateGameObject(jsonData["type"].get<string>());
-	GameObjectBase* gameObjectPtr = gameObject.get();
+	MEMORY_TAG_SCOPE(MemoryTag::Scene);
+
+	GameObjectBase* gameObjectPtr = AttachRootGameObject(TypeRegistry::GetInstance().CreateGameObject(jsonData["type"].get<string>()));
 
 	static_cast<Base*>(gameObjectPtr)->BaseDeserialize(jsonData);
 	static_cast<Base*>(gameObjectPtr)->BaseInitialize();
 
-	m_gameObjects.push_back(move(gameObject));
-
 	return gameObjectPtr;
 }
 
@@ -120,6 +139,9 @@ void SceneBase::OnResizeEvent(std::pair<float,float> res)
 
 void SceneBase::BaseInitialize()
 {
+	PROFILE_FUNCTION();
+	MEMORY_TAG_SCOPE(MemoryTag::Scene);
+
 	m_deviceContext = Renderer::GetInstance().GetDeviceContext();
 
 	m_type = GetTypeName(*this);
@@ -130,17 +152,16 @@ void SceneBase::BaseInitialize()
 	m_debugCamera->Initialize();
 	#endif
 
-	const filesystem::path sceneFilePath = "../Asset/Scene/" + m_type + ".json";
-	if (filesystem::exists(sceneFilePath))
-	{
-		ifstream file(sceneFilePath);
-		nlohmann::json sceneData = {};
-		file >> sceneData;
-		file.close();
-		BaseDeserialize(sceneData);
-	}
+	// 비동기 전환으로 미리 읽은 데이터가 없으면 여기서 읽기
+	if (!m_preloadedData.isLoaded) ReadSceneData(m_type, m_preloadedData);
+	if (m_preloadedData.isLoaded) CommitLoadData(m_preloadedData);
+	m_preloadedData = {};
+
 	for (unique_ptr<Base>& gameObject : m_gameObjects) gameObject->BaseInitialize();
 
+	// 자주 생성되는 프리팹 풀 미리 생성
+	for (const auto& [prefabFileName, count] : m_objectPoolSizes) ObjectPoolManager::GetInstance().WarmUp(prefabFileName, count);
+
 	GetResources();
 
 	#ifdef _DEBUG
@@ -153,11 +174,20 @@ void SceneBase::BaseInitialize()
 
 void SceneBase::BaseFixedUpdate()
 {
-	for (unique_ptr<Base>& gameObject : m_gameObjects) gameObject->BaseFixedUpdate();
+	PROFILE_FUNCTION();
+
+	// 활성 루트 게임 오브젝트만 접근 집합에 따라 배치로 묶어 실행
+	FrameScheduler::GetInstance().Run(FramePhase::FixedUpdate, m_activeGameObjects);
+
+	// 콜라이더 월드 경계가 모두 갱신된 뒤 충돌 쌍 갱신 및 시작, 유지, 종료 전달
+	ColliderComponent::RefreshMovedWorldShapes();
+	ColliderComponent::UpdateContacts();
 }
 
 void SceneBase::BaseUpdate()
 {
+	PROFILE_FUNCTION();
+
 	#ifdef _DEBUG
 	m_debugCamera->Update();
 	static_cast<Base*>(m_debugCamera.get())->BaseUpdate();
@@ -165,8 +195,11 @@ void SceneBase::BaseUpdate()
 	Update();
 	#endif
 
-	RemovePending();
-	for (unique_ptr<Base>& gameObject : m_gameObjects) gameObject->BaseUpdate();
+	FrameScheduler::GetInstance().Run(FramePhase::Update, m_activeGameObjects);
+	// 업데이트 중 움직인 콜라이더의 월드 경계와 브로드페이즈 반영 // 컨트롤러 이동 검사가 이번 프레임 경계를 보도록 먼저 처리
+	ColliderComponent::RefreshMovedWorldShapes();
+	// 업데이트 중 예약된 캐릭터 컨트롤러 이동을 한 번에 해결
+	CharacterControllerComponent::ResolveQueuedMoves();
 	
 	InputManager& inputManager = InputManager::GetInstance();
 
@@ -220,11 +253,7 @@ void SceneBase::BaseUpdate()
 
 			const filesystem::path sceneFilePath = "../Asset/Scene/" + m_type + ".json";
 
-			ofstream sceneFile(sceneFilePath);
-			sceneFile << BaseSerialize().dump(4);
-			sceneFile.close();
-
-			cout << "[System] Scene: " << m_type << " saved successfully!" << endl;
+			if (BinarySerializer::GetInstance().Save(BaseSerialize(), sceneFilePath)) cout << "[System] Scene: " << m_type << " saved successfully!" << endl;
 		}
 
 		if (inputManager.GetKeyDown(KeyCode::Z)) Undo();
@@ -235,6 +264,8 @@ void SceneBase::BaseUpdate()
 
 void SceneBase::BaseRender()
 {
+	PROFILE_FUNCTION();
+
 	Renderer& renderer = Renderer::GetInstance();
 
 	renderer.RENDER_FUNCTION(RenderStage::DirectionalLightShadow, BlendState::Opaque).emplace_back
@@ -262,7 +293,7 @@ void SceneBase::BaseRender()
 			m_viewProjectionData.VPMatrix = XMMatrixTranspose(m_viewProjectionData.viewMatrix * m_viewProjectionData.projectionMatrix);
 			m_globalLightData.lightViewProjectionMatrix = m_viewProjectionData.VPMatrix;
 
-			m_deviceContext->UpdateSubresource(m_viewProjectionConstantBuffer.Get(), 0, nullptr, &m_viewProjectionData, 0, 0);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_viewProjectionConstantBuffer.Get(), &m_viewProjectionData);
 
 			m_deviceContext->PSSetShader(m_shadowMapPixelShader.Get(), nullptr, 0);
 		}
@@ -319,7 +350,7 @@ void SceneBase::BaseRender()
 		);
 	}
 
-	for (unique_ptr<Base>& gameObject : m_gameObjects) gameObject->BaseRender();
+	FrameScheduler::GetInstance().Run(FramePhase::Render, m_activeGameObjects);
 
 	for (const unique_ptr<UIBase>& ui : m_UIList) ui->RenderUI(renderer);
 
@@ -419,6 +450,9 @@ void SceneBase::BaseRenderImGui()
 
 	RenderImGui();
 
+	ObjectPoolManager::GetInstance().RenderImGui();
+	FrameScheduler::GetInstance().RenderImGui();
+
 	ImGui::Separator();
 	ImGui::Text("Game Objects:");
 	for (unique_ptr<Base>& gameObject : m_gameObjects) gameObject->BaseRenderImGui();
@@ -956,11 +990,15 @@ void SceneBase::RenderUITreeNode(UIBase* ui)
 
 void SceneBase::BaseFinalize()
 {
+	PROFILE_FUNCTION();
+
 	#ifdef NDEBUG
 	Finalize();
 	#endif
 
 	for (unique_ptr<Base>& gameObject : m_gameObjects) gameObject->BaseFinalize();
+
+	ObjectPoolManager::GetInstance().Clear();
 }
 
 nlohmann::json SceneBase::BaseSerialize()
@@ -1019,6 +1057,10 @@ nlohmann::json SceneBase::BaseSerialize()
 
 	jsonData["UI"] = uiArray;
 
+	nlohmann::json objectPoolsData = nlohmann::json::array();
+	for (const auto& [prefabFileName, count] : m_objectPoolSizes) objectPoolsData.push_back({ { "prefabFileName", prefabFileName }, { "count", count } });
+	jsonData["objectPools"] = objectPoolsData;
+
 	nlohmann::json derivedData = Serialize();
 	if (!derivedData.is_null() && derivedData.is_object()) jsonData.merge_patch(derivedData);
 
@@ -1110,36 +1152,120 @@ void SceneBase::BaseDeserialize(const nlohmann::json& jsonData)
 	}
 	BindUIActions();
 
+	m_objectPoolSizes.clear();
+	if (jsonData.contains("objectPools"))
+	{
+		for (const auto& poolData : jsonData["objectPools"]) m_objectPoolSizes.emplace_back(poolData["prefabFileName"].get<string>(), poolData["count"].get<size_t>());
+	}
+
 	Deserialize(jsonData);
 
 	GameObjectBase::SetSelectedObject(nullptr);
 	BaseFinalize();
 	m_gameObjects.clear();
+	m_activeGameObjects.clear();
 
 	for (const auto& gameObjectData : jsonData["rootGameObjects"])
 	{
 		string typeName = gameObjectData["type"].get<string>();
-		unique_ptr<Base> gameObjectPtr = TypeRegistry::GetInstance().CreateGameObject(typeName);
+		GameObjectBase* gameObjectPtr = AttachRootGameObject(TypeRegistry::GetInstance().CreateGameObject(typeName));
 
-		gameObjectPtr->BaseDeserialize(gameObjectData);
-		m_gameObjects.push_back(move(gameObjectPtr));
+		static_cast<Base*>(gameObjectPtr)->BaseDeserialize(gameObjectData);
 	}
 }
 
-void SceneBase::RemovePending()
+bool SceneBase::ReadSceneData(const string& sceneTypeName, SceneLoadData& loadData, atomic<float>* progress)
 {
-	erase_if
-	(
-		m_gameObjects, [](const unique_ptr<Base>& gameObject)
+	MEMORY_TAG_SCOPE(MemoryTag::Scene);
+
+	// 최신 바이너리 씬 파일이 있으면 바이너리로, 없으면 JSON으로 로드
+	const filesystem::path sceneFilePath = "../Asset/Scene/" + sceneTypeName + ".json";
+	BinarySerializer& binarySerializer = BinarySerializer::GetInstance();
+	const chrono::steady_clock::time_point loadStartTime = chrono::steady_clock::now();
+	if (binarySerializer.ReadScene(sceneFilePath, loadData, progress))
+	{
+		cout << "[System] Scene: " << sceneTypeName << " loaded from binary in " << chrono::duration<double, milli>(chrono::steady_clock::now() - loadStartTime).count() << "ms" << endl;
+	}
+	else if (filesystem::exists(sceneFilePath))
+	{
+		// 전체 JSON 트리를 만들지 않고 스트리밍으로 로드
+		StreamingLoadStats loadStats = {};
+		if (!StreamingSceneLoader::ReadScene(sceneFilePath, loadData, &loadStats, progress))
 		{
-			if (!gameObject->GetAlive())
-			{
-				gameObject->BaseFinalize();
-				return true;
-			}
+			cerr << "씬 파일 로드 실패: " << sceneFilePath.string() << endl;
 			return false;
 		}
-	);
+
+		cout << "[System] Scene: " << sceneTypeName << " streamed from json in " << loadStats.elapsedMilliseconds << "ms"
+			<< " (GameObjects: " << loadStats.gameObjectCount << ", Components: " << loadStats.componentCount << ", Fallback: " << loadStats.fallbackComponentCount
+			<< ", Peak working set growth: " << loadStats.peakWorkingSetGrowthBytes / 1024 << "KB)" << endl;
+
+		#ifdef _DEBUG
+		// 다음 로드부터 바이너리 사용
+		binarySerializer.Cook(sceneFilePath);
+		#endif
+	}
+	else return false;
+
+	// 메인 스레드 반영 시간을 줄이기 위해 풀링 대상 프리팹과 스카이박스 리소스 미리 로드
+	// 프리팹은 역직렬화만 하고 버림 // 모델, 텍스처는 리소스 매니저 캐시에 남음
+	const nlohmann::json& sceneSettings = loadData.sceneSettings;
+	if (sceneSettings.contains("objectPools"))
+	{
+		for (const auto& poolData : sceneSettings["objectPools"])
+		{
+			const nlohmann::json* prefabData = SceneManager::GetInstance().GetPrefabData(poolData["prefabFileName"].get<string>());
+			if (!prefabData) continue;
+
+			unique_ptr<GameObjectBase> prefabGameObject = TypeRegistry::GetInstance().CreateGameObject((*prefabData)["type"].get<string>());
+			static_cast<Base*>(prefabGameObject.get())->BaseDeserialize(*prefabData);
+		}
+	}
+	ResourceManager& resourceManager = ResourceManager::GetInstance();
+	if (sceneSettings.contains("skyboxFileName")) resourceManager.GetTexture(sceneSettings["skyboxFileName"].get<string>());
+	if (sceneSettings.contains("environmentMapFileName")) resourceManager.GetTexture(sceneSettings["environmentMapFileName"].get<string>());
+
+	loadData.isLoaded = true;
+	if (progress) progress->store(1.0f);
+
+	return true;
+}
+
+void SceneBase::CommitLoadData(SceneLoadData& loadData)
+{
+	loadData.sceneSettings["rootGameObjects"] = nlohmann::json::array();
+	BaseDeserialize(loadData.sceneSettings);
+
+	for (unique_ptr<GameObjectBase>& gameObject : loadData.rootGameObjects) AttachRootGameObject(move(gameObject));
+	loadData.rootGameObjects.clear();
+}
+
+GameObjectBase* SceneBase::AttachRootGameObject(unique_ptr<GameObjectBase> gameObject)
+{
+	GameObjectBase* gameObjectPtr = gameObject.get();
+
+	gameObject->m_parent = nullptr;
+	gameObject->LinkActiveList(&m_activeGameObjects);
+	m_gameObjects.push_back(move(gameObject));
+
+	return gameObjectPtr;
+}
+
+void SceneBase::DestroyDeadRootGameObjects()
+{
+	// 풀링 대상은 풀에 반환, 나머지는 종료 후 해제 // 종료 처리 중 게임 오브젝트가 추가될 수 있으므로 인덱스로 순회
+	ObjectPoolManager& objectPoolManager = ObjectPoolManager::GetInstance();
+	DestructionQueue& destructionQueue = DestructionQueue::GetInstance();
+	for (size_t i = 0; i < m_gameObjects.size(); ++i)
+	{
+		if (!m_gameObjects[i] || m_gameObjects[i]->GetAlive()) continue;
+
+		GameObjectBase* gameObject = static_cast<GameObjectBase*>(m_gameObjects[i].release());
+		destructionQueue.Cancel(gameObject);
+		objectPoolManager.Release(unique_ptr<GameObjectBase>(gameObject));
+	}
+
+	erase(m_gameObjects, nullptr);
 }
 
 void SceneBase::GetResources()
@@ -1171,28 +1297,29 @@ void SceneBase::GetResources()
 void SceneBase::UpdateConstantBuffers()
 {
 	const CameraComponent& mainCamera = CameraComponent::GetMainCamera();
+	RenderBackend& renderBackend = RenderBackend::GetInstance();
 
 	m_viewProjectionData.viewMatrix = mainCamera.GetViewMatrix();
 	m_viewProjectionData.projectionMatrix = mainCamera.GetProjectionMatrix();
 	m_viewProjectionData.VPMatrix = XMMatrixTranspose(m_viewProjectionData.viewMatrix * m_viewProjectionData.projectionMatrix);
-	m_deviceContext->UpdateSubresource(m_viewProjectionConstantBuffer.Get(), 0, nullptr, &m_viewProjectionData, 0, 0);
+	renderBackend.UpdateSubresource(m_deviceContext.Get(), m_viewProjectionConstantBuffer.Get(), &m_viewProjectionData);
 
 	m_viewProjectionData.viewMatrix.r[3] = XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
 	m_skyboxViewProjectionData.skyboxVPMatrix = XMMatrixTranspose(XMMatrixInverse(nullptr, m_viewProjectionData.viewMatrix * m_viewProjectionData.projectionMatrix));
-	m_deviceContext->UpdateSubresource(m_skyboxViewProjectionConstantBuffer.Get(), 0, nullptr, &m_skyboxViewProjectionData, 0, 0);
+	renderBackend.UpdateSubresource(m_deviceContext.Get(), m_skyboxViewProjectionConstantBuffer.Get(), &m_skyboxViewProjectionData);
 
 	m_timeData.totalTime = TimeManager::GetInstance().GetTotalTime();
 	m_timeData.deltaTime = TimeManager::GetInstance().GetDeltaTime();
 	m_timeData.sinTime = sinf(m_timeData.totalTime);
 	m_timeData.cosTime = cosf(m_timeData.totalTime);
-	m_deviceContext->UpdateSubresource(m_timeConstantBuffer.Get(), 0, nullptr, &m_timeData, 0, 0);
+	renderBackend.UpdateSubresource(m_deviceContext.Get(), m_timeConstantBuffer.Get(), &m_timeData);
 
 	m_cameraPositionData.cameraPosition = mainCamera.GetPosition();
-	m_deviceContext->UpdateSubresource(m_cameraPositionConstantBuffer.Get(), 0, nullptr, &m_cameraPositionData, 0, 0);
+	renderBackend.UpdateSubresource(m_deviceContext.Get(), m_cameraPositionConstantBuffer.Get(), &m_cameraPositionData);
 
-	m_deviceContext->UpdateSubresource(m_globalLightConstantBuffer.Get(), 0, nullptr, &m_globalLightData, 0, 0);
+	renderBackend.UpdateSubresource(m_deviceContext.Get(), m_globalLightConstantBuffer.Get(), &m_globalLightData);
 
-	m_deviceContext->UpdateSubresource(m_postProcessingConstantBuffer.Get(), 0, nullptr, &m_postProcessingData, 0, 0);
+	renderBackend.UpdateSubresource(m_deviceContext.Get(), m_postProcessingConstantBuffer.Get(), &m_postProcessingData);
 }
 
 void SceneBase::RenderSkybox()
@@ -1213,7 +1340,7 @@ void SceneBase::RenderSkybox()
 	constexpr ID3D11Buffer* nullBuffer = nullptr;
 	m_deviceContext->IASetVertexBuffers(0, 1, &nullBuffer, &STRIDE, &OFFSET);
 
-	m_deviceContext->Draw(3, 0);
+	RenderBackend::GetInstance().Draw(m_deviceContext.Get(), 3, 0);
 
 	resourceManager.SetDepthStencilState(DepthStencilState::Default);
 }
@@ -1242,6 +1369,6 @@ void SceneBase::RenderDebugCoordinates()
 	constexpr ID3D11Buffer* nullBuffer = nullptr;
 	m_deviceContext->IASetVertexBuffers(0, 1, &nullBuffer, &STRIDE, &OFFSET);
 
-	m_deviceContext->DrawInstanced(2, 2004, 0, 0);
+	RenderBackend::GetInstance().DrawInstanced(m_deviceContext.Get(), 2, 2004, 0, 0);
 }
 #endif
@@ -7,8 +7,21 @@
 
 #include "UIBase.h"
 
+// 씬에 반영하기 전의 씬 데이터 // 백그라운드 스레드에서 읽고 메인 스레드에서 반영
+struct SceneLoadData
+{
+	nlohmann::json sceneSettings = nlohmann::json::object(); // 게임 오브젝트를 제외한 씬 데이터
+	std::vector<std::unique_ptr<GameObjectBase>> rootGameObjects = {}; // 역직렬화만 끝난 루트 게임 오브젝트 배열
+	bool isLoaded = false; // 읽기 성공 여부
+};
+
 class SceneBase : public Base
 {
+	friend class SceneManager;
+	friend class BinarySerializer;
+	friend class StreamingSceneLoader;
+	friend class DestructionQueue;
+
 protected:
 	#ifdef _DEBUG
 	std::unique_ptr<DebugCamera> m_debugCamera = nullptr; // 디버그 카메라 게임 오브젝트
@@ -22,6 +35,7 @@ protected:
 	com_ptr<ID3D11DeviceContext> m_deviceContext = nullptr; // 디바이스 컨텍스트 포인터
 
 	std::vector<std::unique_ptr<Base>> m_gameObjects = {}; // 게임 오브젝트 배열
+	std::vector<GameObjectBase*> m_activeGameObjects = {}; // 활성 루트 게임 오브젝트 배열 // 업데이트, 렌더링은 이 배열만 순회
 	std::vector<std::unique_ptr<UIBase>> m_UIList = {}; // UI 배열
 
 	std::pair<com_ptr<ID3D11VertexShader>, com_ptr<ID3D11InputLayout>> m_skyboxVertexShaderAndInputLayout = {}; // 스카이박스 정점 셰이더
@@ -63,6 +77,10 @@ protected:
 
 	bool m_showFPS = true; // FPS 표시 여부
 
+	std::vector<std::pair<std::string, size_t>> m_objectPoolSizes = {}; // 씬 로드 시 미리 생성할 프리팹 풀 크기 배열
+
+	SceneLoadData m_preloadedData = {}; // 비동기 씬 전환 시 백그라운드에서 미리 읽은 씬 데이터
+
 public:
 	SceneBase() = default;
 	virtual ~SceneBase() = default;
@@ -130,13 +148,30 @@ private:
 	// 씬 종료 // 씬 매니저가 씬을 교체할 때 호출
 	void BaseFinalize() override;
 
+	// 씬은 풀링 대상이 아니므로 빈 구현
+	void BaseReset() override {}
+	void BaseReactivate() override {}
+	// 씬은 항상 활성 상태이므로 빈 구현
+	void BaseEnable() override {}
+	void BaseDisable() override {}
+	// 씬은 콜라이더를 소유하지 않으므로 빈 구현
+	void BaseCollision(CollisionEvent event, ColliderComponent* other) override {}
+
 	// 씬 직렬화
 	nlohmann::json BaseSerialize() override;
 	// 씬 역직렬화
 	void BaseDeserialize(const nlohmann::json& jsonData) override;
 
-	// 제거할 게임 오브젝트 제거 // Update에서 호출
-	void RemovePending() override;
+	// 씬 파일 읽기 및 리소스 미리 로드 // 씬 상태를 건드리지 않으므로 백그라운드 스레드에서 호출 가능 // progress에 진행률(0~1) 기록
+	static bool ReadSceneData(const std::string& sceneTypeName, SceneLoadData& loadData, std::atomic<float>* progress = nullptr);
+	// 읽은 씬 데이터를 씬에 반영 // 메인 스레드에서 호출 // 초기화는 호출하지 않음
+	void CommitLoadData(SceneLoadData& loadData);
+
+	// 루트 게임 오브젝트 소유 및 활성 목록 연결
+	GameObjectBase* AttachRootGameObject(std::unique_ptr<GameObjectBase> gameObject);
+
+	// 죽은 루트 게임 오브젝트를 풀에 반환하거나 종료 후 제거 // 제거 대기열에서 호출
+	void DestroyDeadRootGameObjects();
 
 	// 리소스 매니저에서 필요한 리소스 얻기
 	void GetResources();
@@ -158,11 +193,8 @@ private:
 template<typename T> requires std::derived_from<T, GameObjectBase>
 inline T* SceneBase::CreateRootGameObject()
 {
-	std::unique_ptr<Base> gameObject = std::make_unique<T>();
-
-	gameObject->BaseInitialize();
-	T* gameObjectPtr = static_cast<T*>(gameObject.get());
-	m_gameObjects.push_back(std::move(gameObject));
+	T* gameObjectPtr = static_cast<T*>(AttachRootGameObject(std::make_unique<T>()));
+	static_cast<Base*>(gameObjectPtr)->BaseInitialize();
 
 	return gameObjectPtr;
 }
\ No newline at end of file
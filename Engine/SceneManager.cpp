@@ -4,6 +4,13 @@
 #include "SceneBase.h"
 #include "Renderer.h"
 #include "TimeManager.h"
+#include "BinarySerializer.h"
+#include "DestructionQueue.h"
+#include "JobSystem.h"
+#include "InputRecorder.h"
+#include "Profiler.h"
+#include "Telemetry.h"
+#include "MemoryTracker.h"
 
 using namespace std;
 
@@ -18,18 +25,51 @@ void SceneManager::Initialize()
 
 void SceneManager::Run()
 {
+	#if PROFILER_ENABLED
+	Profiler::GetInstance().BeginFrame();
+	#endif
+	PROFILE_FUNCTION();
+
+	// 백그라운드 읽기가 끝났으면 다음 프레임 시작 시 교체 // 남은 작업은 씬 데이터 반영과 초기화뿐
+	if (m_sceneLoadTask.valid() && m_sceneLoadTask.wait_for(chrono::seconds(0)) == future_status::ready)
+	{
+		m_sceneLoadTask.get();
+		MemoryTracker::GetInstance().OnSceneLoadFinished();
+		m_nextScene = move(m_loadingScene);
+		m_accumulator = 0;
+	}
+
 	if (m_nextScene)
 	{
 		if (m_currentScene) m_currentScene->BaseFinalize();
 		m_currentScene = move(m_nextScene);
+		// 이전 씬 해제 직후 스냅숏 비교
+		MemoryTracker::GetInstance().OnSceneChanged(GetTypeName(*m_currentScene));
 		m_currentScene->BaseInitialize();
 	}
 
+	// 지난 프레임에 죽은 게임 오브젝트, 컴포넌트 일괄 제거
+	DestructionQueue::GetInstance().Flush(*GetCurrentScene());
+
+	// 작업자 스레드가 예약한 디바이스 작업 등 메인 스레드 작업 실행
+	JobSystem::GetInstance().ExecuteMainThreadJobs();
+
 	TimeManager::GetInstance().UpdateTime();
+	// 기록 중이면 이번 프레임 입력과 델타 타임 저장
+	InputRecorder::GetInstance().EndFrame(TimeManager::GetInstance().GetNSDeltaTime());
 
 	float& dt = TimeManager::GetInstance().GetDeltaTime();
 	m_accumulator += dt;
 
+	const auto measure = [](chrono::steady_clock::time_point& time)
+		{
+			const chrono::steady_clock::time_point now = chrono::steady_clock::now();
+			const double elapsed = chrono::duration<double, milli>(now - time).count();
+			time = now;
+			return elapsed;
+		};
+	chrono::steady_clock::time_point time = chrono::steady_clock::now();
+
 	int steps = 0;
 	while (m_accumulator >= fixedDt && steps < maxSteps)
 	{
@@ -37,32 +77,95 @@ void SceneManager::Run()
 		m_accumulator -= fixedDt;
 		steps++;
 	}
+	m_frameTimings.fixedUpdate = measure(time);
+	TELEMETRY_COUNT("Scene.FixedSteps", steps);
 
 	m_currentScene->BaseUpdate();
+	m_frameTimings.update = measure(time);
 
 	Renderer& m_renderer = Renderer::GetInstance();
 	m_renderer.BeginFrame();
 
 	#ifdef _DEBUG
 	m_currentScene->BaseRenderImGui();
+	#if PROFILER_ENABLED
+	Profiler::GetInstance().RenderImGui();
+	#endif
+	Telemetry::GetInstance().RenderImGui();
+	MemoryTracker::GetInstance().RenderImGui();
 	#endif
 
 	m_currentScene->BaseRender();
+	m_frameTimings.render = measure(time);
 
 	m_renderer.EndFrame();
+	m_frameTimings.submit = measure(time);
+
+	m_totalFrameTimings += m_frameTimings;
+	m_timedFrameCount++;
+
+	// 이번 프레임 카운터 확정 및 초기화
+	MemoryTracker::GetInstance().EndFrame();
+	Telemetry::GetInstance().EndFrame();
 }
 
 void SceneManager::Finalize()
 {
+	CancelSceneLoad();
+
 	if (m_currentScene) m_currentScene->BaseFinalize();
 }
 
 void SceneManager::ChangeScene(const string& sceneTypeName)
 {
+	CancelSceneLoad();
+
 	m_nextScene = TypeRegistry::GetInstance().CreateScene(sceneTypeName);
 	m_accumulator = 0;
 }
 
+void SceneManager::ChangeSceneAsync(const string& sceneTypeName)
+{
+	CancelSceneLoad();
+
+	// 다음 씬 객체 생성 전에 찍어야 미리 읽은 데이터를 이전 씬 몫에서 뺄 수 있음
+	MemoryTracker::GetInstance().OnSceneLoadStarted();
+
+	m_loadingScene = TypeRegistry::GetInstance().CreateScene(sceneTypeName);
+	m_loadingProgress = 0.0f;
+
+	// 읽는 동안 메인 스레드는 로딩 중인 씬에 접근하지 않음
+	SceneBase* loadingScene = static_cast<SceneBase*>(m_loadingScene.get());
+	m_sceneLoadTask = async
+	(
+		launch::async, [this, loadingScene, sceneTypeName]()
+		{
+			return SceneBase::ReadSceneData(sceneTypeName, loadingScene->m_preloadedData, &m_loadingProgress);
+		}
+	);
+}
+
+void SceneManager::CancelSceneLoad()
+{
+	if (m_sceneLoadTask.valid()) m_sceneLoadTask.get();
+	m_loadingScene = nullptr;
+}
+
+void SceneManager::PrintFrameTimings() const
+{
+	if (m_timedFrameCount == 0) return;
+
+	const double frameCount = static_cast<double>(m_timedFrameCount);
+	const double total = m_totalFrameTimings.fixedUpdate + m_totalFrameTimings.update + m_totalFrameTimings.render + m_totalFrameTimings.submit;
+
+	cout << "[프레임 단계별 CPU 시간] " << m_timedFrameCount << "프레임 평균" << endl;
+	cout << "FixedUpdate: " << m_totalFrameTimings.fixedUpdate / frameCount << " ms" << endl;
+	cout << "Update: " << m_totalFrameTimings.update / frameCount << " ms" << endl;
+	cout << "Render: " << m_totalFrameTimings.render / frameCount << " ms" << endl;
+	cout << "Submit: " << m_totalFrameTimings.submit / frameCount << " ms" << endl;
+	cout << "Total: " << total / frameCount << " ms" << endl;
+}
+
 SceneBase* SceneManager::GetCurrentScene()
 {
 	return dynamic_cast<SceneBase*>(m_currentScene.get());
@@ -70,17 +173,33 @@ SceneBase* SceneManager::GetCurrentScene()
 
 void SceneManager::LoadAllPrefabs()
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Prefab);
+
 	const filesystem::path prefabDirectory = "../Asset/Prefab/";
 	if (!filesystem::exists(prefabDirectory)) return;
 
+	BinarySerializer& binarySerializer = BinarySerializer::GetInstance();
+
 	for (const auto& entry : filesystem::directory_iterator(prefabDirectory))
 	{
 		if (entry.path().extension() == ".json")
 		{
+			// 최신 바이너리 프리팹 파일이 있으면 바이너리로 로드
+			if (optional<nlohmann::json> binaryPrefabData = binarySerializer.LoadPrefab(entry.path()))
+			{
+				m_prefabCache[entry.path().filename().string()] = move(*binaryPrefabData);
+				continue;
+			}
+
 			ifstream file(entry.path());
 			nlohmann::json prefabData;
 			file >> prefabData;
 			file.close();
+
+			#ifdef _DEBUG
+			binarySerializer.Write(prefabData, BinarySerializer::GetBinaryPath(entry.path()), BinarySerializer::GetSourceStamp(entry.path()));
+			#endif
+
 			m_prefabCache[entry.path().filename().string()] = prefabData;
 		}
 	}
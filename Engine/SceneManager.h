@@ -1,5 +1,23 @@
 #pragma once
 
+// 프레임 단계별 CPU 시간 // 밀리초 단위
+struct SceneFrameTimings
+{
+	double fixedUpdate = 0.0; // 고정 업데이트 // 여러 번 실행되면 합
+	double update = 0.0; // 업데이트
+	double render = 0.0; // 렌더 명령 기록 // ImGui 포함
+	double submit = 0.0; // 렌더 명령 실행 및 프레젠트
+
+	SceneFrameTimings& operator+=(const SceneFrameTimings& other)
+	{
+		fixedUpdate += other.fixedUpdate;
+		update += other.update;
+		render += other.render;
+		submit += other.submit;
+		return *this;
+	}
+};
+
 class SceneManager : public Singleton<SceneManager>
 {
 	friend class Singleton<SceneManager>;
@@ -7,8 +25,16 @@ class SceneManager : public Singleton<SceneManager>
 	std::unique_ptr<class Base> m_currentScene = nullptr;
 	std::unique_ptr<class Base> m_nextScene = nullptr;
 
+	std::unique_ptr<class Base> m_loadingScene = nullptr; // 백그라운드에서 읽는 중인 씬
+	std::future<bool> m_sceneLoadTask = {}; // 백그라운드 씬 읽기 작업
+	std::atomic<float> m_loadingProgress = 0.0f; // 백그라운드 씬 읽기 진행률(0~1)
+
 	double m_accumulator = 0.0;
 
+	SceneFrameTimings m_frameTimings = {}; // 마지막 프레임의 단계별 시간
+	SceneFrameTimings m_totalFrameTimings = {}; // 누적 단계별 시간
+	size_t m_timedFrameCount = 0; // 누적한 프레임 수
+
 	std::unordered_map<std::string, nlohmann::json> m_prefabCache = {}; // 프리팹 캐시 맵
 
 public:
@@ -23,12 +49,25 @@ public:
 	void Finalize();
 
 	void ChangeScene(const std::string& sceneTypeName);
+	// 현재 씬을 유지한 채 다음 씬 파일과 리소스를 백그라운드에서 읽고 완료되면 교체
+	void ChangeSceneAsync(const std::string& sceneTypeName);
+	// 비동기 씬 전환 중 여부
+	bool IsLoading() const { return m_loadingScene != nullptr; }
+	// 비동기 씬 전환 진행률(0~1) // 로딩 UI용
+	float GetLoadingProgress() const { return m_loadingProgress.load(); }
 
 	class SceneBase* GetCurrentScene();
 
+	const SceneFrameTimings& GetFrameTimings() const { return m_frameTimings; }
+	// 누적 단계별 시간의 프레임 평균 콘솔 출력 // 헤드리스 실행 결과 보고용
+	void PrintFrameTimings() const;
+
 	void LoadAllPrefabs();
 	const nlohmann::json* GetPrefabData(const std::string& prefabName);
 
 private:
 	SceneManager() = default;
+
+	// 진행 중인 비동기 씬 읽기가 끝날 때까지 대기 후 폐기
+	void CancelSceneLoad();
 };
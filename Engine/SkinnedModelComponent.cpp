@@ -2,6 +2,7 @@
 #include "SkinnedModelComponent.h"
 
 #include "Renderer.h"
+#include "RenderBackend.h"
 #include "ResourceManager.h"
 #include "TimeManager.h"
 #include "GameObjectBase.h"
@@ -81,9 +82,9 @@ void SkinnedModelComponent::Render()
 			ResourceManager& resourceManager = ResourceManager::GetInstance();
 			resourceManager.SetRasterState(m_rasterState);
 
-			m_deviceContext->UpdateSubresource(m_worldNormalConstantBuffer.Get(), 0, nullptr, m_worldNormalData, 0, 0);
-			m_deviceContext->UpdateSubresource(m_boneConstantBuffer.Get(), 0, nullptr, &m_boneBufferData, 0, 0);
-			m_deviceContext->UpdateSubresource(m_dissolveConstantBuffer.Get(), 0, nullptr, &m_dissolveData, 0, 0);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_worldNormalConstantBuffer.Get(), m_worldNormalData);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_boneConstantBuffer.Get(), &m_boneBufferData);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_dissolveConstantBuffer.Get(), &m_dissolveData);
 
 			m_deviceContext->IASetInputLayout(m_vertexShaderAndInputLayout.second.Get());
 			m_deviceContext->VSSetShader(m_vertexShaderAndInputLayout.first.Get(), nullptr, 0);
@@ -99,7 +100,7 @@ void SkinnedModelComponent::Render()
 				m_deviceContext->PSSetShaderResources(static_cast<UINT>(TextureSlots::Noise), 1, resourceManager.GetNoise(m_selectedNoiseIndex).GetAddressOf());
 
 				// 재질 팩터 설정
-				m_deviceContext->UpdateSubresource(m_materialFactorConstantBuffer.Get(), 0, nullptr, &material.m_materialFactor, 0, 0);
+				RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_materialFactorConstantBuffer.Get(), &material.m_materialFactor);
 
 				for (const Mesh& mesh : model->meshes)
 				{
@@ -109,7 +110,7 @@ void SkinnedModelComponent::Render()
 
 					m_deviceContext->IASetVertexBuffers(0, 1, mesh.vertexBuffer.GetAddressOf(), &stride, &offset);
 					m_deviceContext->IASetIndexBuffer(mesh.indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
-					m_deviceContext->DrawIndexed(mesh.indexCount, 0, 0);
+					RenderBackend::GetInstance().DrawIndexed(m_deviceContext.Get(), mesh.indexCount, 0, 0);
 				}
 			}
 		}
@@ -124,8 +125,8 @@ void SkinnedModelComponent::Render()
 			ResourceManager& resourceManager = ResourceManager::GetInstance();
 			resourceManager.SetRasterState(RasterState::Solid);
 
-			m_deviceContext->UpdateSubresource(m_worldNormalConstantBuffer.Get(), 0, nullptr, m_worldNormalData, 0, 0);
-			m_deviceContext->UpdateSubresource(m_boneConstantBuffer.Get(), 0, nullptr, &m_boneBufferData, 0, 0);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_worldNormalConstantBuffer.Get(), m_worldNormalData);
+			RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), m_boneConstantBuffer.Get(), &m_boneBufferData);
 
 			m_deviceContext->IASetInputLayout(m_vertexShaderAndInputLayout.second.Get());
 			m_deviceContext->VSSetShader(m_vertexShaderAndInputLayout.first.Get(), nullptr, 0);
@@ -143,7 +144,7 @@ void SkinnedModelComponent::Render()
 
 					m_deviceContext->IASetVertexBuffers(0, 1, mesh.vertexBuffer.GetAddressOf(), &stride, &offset);
 					m_deviceContext->IASetIndexBuffer(mesh.indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
-					m_deviceContext->DrawIndexed(mesh.indexCount, 0, 0);
+					RenderBackend::GetInstance().DrawIndexed(m_deviceContext.Get(), mesh.indexCount, 0, 0);
 				}
 			}
 		}
@@ -179,8 +180,8 @@ void SkinnedModelComponent::Render()
 					lineBufferData.linePoints[1] = XMFLOAT4{ boxVertices[endIndex].x, boxVertices[endIndex].y, boxVertices[endIndex].z, 1.0f };
 					lineBufferData.lineColors[0] = XMFLOAT4{ 0.0f, 1.0f, 0.0f, 1.0f };
 					lineBufferData.lineColors[1] = XMFLOAT4{ 0.0f, 1.0f, 0.0f, 1.0f };
-					m_deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-					m_deviceContext->Draw(2, 0);
+					RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+					RenderBackend::GetInstance().Draw(m_deviceContext.Get(), 2, 0);
 				}
 			}
 
@@ -200,8 +201,8 @@ void SkinnedModelComponent::Render()
 							lineBufferData.linePoints[1] = XMFLOAT4{ boxVertices[endIndex].x, boxVertices[endIndex].y, boxVertices[endIndex].z, 1.0f };
 							lineBufferData.lineColors[0] = XMFLOAT4{ 1.0f, 0.0f, 0.0f, 1.0f };
 							lineBufferData.lineColors[1] = XMFLOAT4{ 1.0f, 0.0f, 0.0f, 1.0f };
-							m_deviceContext->UpdateSubresource(resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), 0, nullptr, &lineBufferData, 0, 0);
-							m_deviceContext->Draw(2, 0);
+							RenderBackend::GetInstance().UpdateSubresource(m_deviceContext.Get(), resourceManager.GetConstantBuffer(VSConstBuffers::Line).Get(), &lineBufferData);
+							RenderBackend::GetInstance().Draw(m_deviceContext.Get(), 2, 0);
 						}
 					}
 				}
@@ -21,6 +21,13 @@ public:
 	bool NeedsUpdate() const override { return true; }
 	bool NeedsRender() const override { return true; }
 
+	// 업데이트에서 공유 애니메이션 데이터 읽기 // 월드 경계는 자기 것만 갱신
+	FrameAccessSet GetFrameAccess(FramePhase phase) const override
+	{
+		if (phase == FramePhase::Render) return { .read = FrameAccess::Camera };
+		return { .read = FrameAccess::Animation };
+	}
+
 	std::shared_ptr<Animator>& GetAnimator() { return animator_; }
 private:
 	void Initialize() override;
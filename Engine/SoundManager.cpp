@@ -5,6 +5,7 @@
 
 #include "SoundManager.h"
 #include "TimeManager.h"
+#include "MemoryTracker.h"
 
 #include "Shared/Config/Option.h"
 
@@ -313,6 +314,8 @@ struct Segment
 
 void SoundManager::CreateNodeData(const std::string& filename)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Node);
+
 	auto it = BGM_List.find(filename);
 	if (it == BGM_List.end())
 		return;
@@ -529,6 +532,8 @@ void SoundManager::CreateNodeData(const std::string& filename)
 
 void SoundManager::LoadNodeData()
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Node);
+
 	/*if (strcmp(m_CurrentTrackName.c_str(), "Invaild") == 0)
 	{
 		std::cerr << "Invaild Node Data" << std::endl;
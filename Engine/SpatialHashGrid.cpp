@@ -0,0 +1,317 @@
+#include "stdafx.h"
+#include "SpatialHashGrid.h"
+
+#include "Microbenchmark.h"
+
+using namespace std;
+using namespace DirectX;
+
+REGISTER_MICROBENCHMARK(SpatialHashGrid, SpatialHashGrid::RunMicrobenchmarks)
+
+void SpatialHashGrid::SetCellSize(float cellSize)
+{
+	m_cellSize = max(cellSize, numeric_limits<float>::epsilon());
+	m_inverseCellSize = 1.0f / m_cellSize;
+
+	m_cells.clear();
+	for (uint32_t handle = 0; handle < m_entries.size(); ++handle)
+	{
+		if (!m_entries[handle].isUsed) continue;
+
+		m_entries[handle].cellKey = GetCellKey(GetCellCoordinate(m_entries[handle].position));
+		LinkToCell(handle);
+	}
+}
+
+uint32_t SpatialHashGrid::Insert(const XMVECTOR& position, void* userData)
+{
+	uint32_t handle = m_freeList;
+	if (handle == INVALID_HANDLE)
+	{
+		handle = static_cast<uint32_t>(m_entries.size());
+		m_entries.emplace_back();
+	}
+	else
+	{
+		m_freeList = m_entries[handle].next;
+	}
+
+	Entry& entry = m_entries[handle];
+	entry = { .userData = userData, .isUsed = true };
+	XMStoreFloat3(&entry.position, position);
+	entry.cellKey = GetCellKey(GetCellCoordinate(entry.position));
+	LinkToCell(handle);
+
+	m_count++;
+
+	return handle;
+}
+
+void SpatialHashGrid::Remove(uint32_t handle)
+{
+	UnlinkFromCell(handle);
+
+	m_entries[handle] = { .next = m_freeList, .isUsed = false };
+	m_freeList = handle;
+
+	m_count--;
+}
+
+void SpatialHashGrid::Move(uint32_t handle, const XMVECTOR& position)
+{
+	Entry& entry = m_entries[handle];
+	XMStoreFloat3(&entry.position, position);
+
+	const uint64_t cellKey = GetCellKey(GetCellCoordinate(entry.position));
+	if (cellKey == entry.cellKey) return;
+
+	UnlinkFromCell(handle);
+	m_entries[handle].cellKey = cellKey;
+	LinkToCell(handle);
+
+	m_cellChangeCount++;
+}
+
+void SpatialHashGrid::Clear()
+{
+	m_entries.clear();
+	m_cells.clear();
+	m_freeList = INVALID_HANDLE;
+	m_count = 0;
+}
+
+template<typename F>
+bool SpatialHashGrid::ForEachInCell(const array<int32_t, 3>& coordinate, const XMFLOAT3& center, F&& callback) const
+{
+	const auto it = m_cells.find(GetCellKey(coordinate));
+	if (it == m_cells.end()) return true;
+
+	for (uint32_t handle = it->second; handle != INVALID_HANDLE; handle = m_entries[handle].next)
+	{
+		if (!callback(handle, GetDistanceSquared(m_entries[handle].position, center))) return false;
+	}
+
+	return true;
+}
+
+size_t SpatialHashGrid::QueryRadius(const XMVECTOR& center, float radius, span<Neighbor> results, uint32_t ignoredHandle) const
+{
+	if (results.empty() || m_count == 0) return 0;
+
+	XMFLOAT3 centerPosition = {};
+	XMStoreFloat3(&centerPosition, center);
+
+	const float radiusSquared = radius * radius;
+	const array<int32_t, 3> minimum = GetCellCoordinate({ centerPosition.x - radius, centerPosition.y - radius, centerPosition.z - radius });
+	const array<int32_t, 3> maximum = GetCellCoordinate({ centerPosition.x + radius, centerPosition.y + radius, centerPosition.z + radius });
+
+	size_t count = 0;
+	for (int32_t x = minimum[0]; x <= maximum[0]; ++x)
+	{
+		for (int32_t y = minimum[1]; y <= maximum[1]; ++y)
+		{
+			for (int32_t z = minimum[2]; z <= maximum[2]; ++z)
+			{
+				const bool isFull = !ForEachInCell
+				(
+					{ x, y, z }, centerPosition,
+					[&](uint32_t handle, float distanceSquared)
+					{
+						if (handle == ignoredHandle || distanceSquared > radiusSquared) return true;
+
+						results[count++] = { .handle = handle, .distanceSquared = distanceSquared };
+						return count < results.size();
+					}
+				);
+				if (isFull) return count;
+			}
+		}
+	}
+
+	return count;
+}
+
+size_t SpatialHashGrid::QueryNearest(const XMVECTOR& center, float maxRadius, span<Neighbor> results, uint32_t ignoredHandle) const
+{
+	if (results.empty() || m_count == 0) return 0;
+
+	XMFLOAT3 centerPosition = {};
+	XMStoreFloat3(&centerPosition, center);
+
+	const float maxRadiusSquared = maxRadius * maxRadius;
+	const array<int32_t, 3> centerCell = GetCellCoordinate(centerPosition);
+	const int32_t maxRing = static_cast<int32_t>(ceilf(maxRadius * m_inverseCellSize));
+
+	// 가까운 순서를 유지하며 삽입 // 버퍼가 차 있으면 가장 먼 항목을 밀어냄
+	size_t count = 0;
+	const auto insert = [&](uint32_t handle, float distanceSquared)
+		{
+			if (handle == ignoredHandle || distanceSquared > maxRadiusSquared) return true;
+			if (count == results.size() && distanceSquared >= results[count - 1].distanceSquared) return true;
+
+			size_t index = count < results.size() ? count++ : count - 1;
+			for (; index > 0 && results[index - 1].distanceSquared > distanceSquared; --index) results[index] = results[index - 1];
+			results[index] = { .handle = handle, .distanceSquared = distanceSquared };
+
+			return true;
+		};
+
+	for (int32_t ring = 0; ring <= maxRing; ++ring)
+	{
+		const int32_t yRing = m_isPlanar ? 0 : ring;
+		for (int32_t dx = -ring; dx <= ring; ++dx)
+		{
+			for (int32_t dy = -yRing; dy <= yRing; ++dy)
+			{
+				for (int32_t dz = -ring; dz <= ring; ++dz)
+				{
+					// 이번 겹의 셀만 // 안쪽 셀은 이전 겹에서 검사함
+					if (max({ abs(dx), abs(dy), abs(dz) }) != ring) continue;
+
+					ForEachInCell({ centerCell[0] + dx, centerCell[1] + dy, centerCell[2] + dz }, centerPosition, insert);
+				}
+			}
+		}
+
+		// 검사한 셀 범위 밖 항목은 중심에서 범위 경계까지 거리보다 멀리 있음
+		if (count < results.size()) continue;
+
+		const auto getBoundaryDistance = [&](size_t axis, float position)
+			{
+				const float lower = position - static_cast<float>(centerCell[axis] - ring) * m_cellSize;
+				const float upper = static_cast<float>(centerCell[axis] + ring + 1) * m_cellSize - position;
+				return min(lower, upper);
+			};
+		float boundaryDistance = min(getBoundaryDistance(0, centerPosition.x), getBoundaryDistance(2, centerPosition.z));
+		if (!m_isPlanar) boundaryDistance = min(boundaryDistance, getBoundaryDistance(1, centerPosition.y));
+
+		if (results[count - 1].distanceSquared <= boundaryDistance * boundaryDistance) break;
+	}
+
+	return count;
+}
+
+array<int32_t, 3> SpatialHashGrid::GetCellCoordinate(const XMFLOAT3& position) const
+{
+	return
+	{
+		static_cast<int32_t>(floorf(position.x * m_inverseCellSize)),
+		m_isPlanar ? 0 : static_cast<int32_t>(floorf(position.y * m_inverseCellSize)),
+		static_cast<int32_t>(floorf(position.z * m_inverseCellSize))
+	};
+}
+
+uint64_t SpatialHashGrid::GetCellKey(const array<int32_t, 3>& coordinate)
+{
+	// 축마다 21비트 // 셀 좌표 ±100만까지 충돌 없음
+	constexpr uint64_t MASK = (1ull << 21) - 1;
+	return ((static_cast<uint64_t>(coordinate[0]) & MASK) << 42) | ((static_cast<uint64_t>(coordinate[1]) & MASK) << 21) | (static_cast<uint64_t>(coordinate[2]) & MASK);
+}
+
+void SpatialHashGrid::LinkToCell(uint32_t handle)
+{
+	Entry& entry = m_entries[handle];
+
+	auto [it, isInserted] = m_cells.try_emplace(entry.cellKey, handle);
+	entry.previous = INVALID_HANDLE;
+	entry.next = isInserted ? INVALID_HANDLE : it->second;
+	if (!isInserted)
+	{
+		m_entries[it->second].previous = handle;
+		it->second = handle;
+	}
+}
+
+void SpatialHashGrid::UnlinkFromCell(uint32_t handle)
+{
+	const Entry& entry = m_entries[handle];
+
+	if (entry.next != INVALID_HANDLE) m_entries[entry.next].previous = entry.previous;
+
+	if (entry.previous != INVALID_HANDLE)
+	{
+		m_entries[entry.previous].next = entry.next;
+		return;
+	}
+
+	// 셀의 첫 항목 // 마지막 항목이었으면 셀 삭제
+	if (entry.next == INVALID_HANDLE) m_cells.erase(entry.cellKey);
+	else m_cells[entry.cellKey] = entry.next;
+}
+
+float SpatialHashGrid::GetDistanceSquared(const XMFLOAT3& a, const XMFLOAT3& b) const
+{
+	const float dx = a.x - b.x;
+	const float dy = m_isPlanar ? 0.0f : a.y - b.y;
+	const float dz = a.z - b.z;
+
+	return dx * dx + dy * dy + dz * dz;
+}
+
+void SpatialHashGrid::RunMicrobenchmarks()
+{
+	cout << "[공간 해시 마이크로벤치마크] 적 분리 검색 // 전수 검사 대비 평면 격자" << endl;
+
+	constexpr float SEPARATION_RADIUS = 0.8f;
+	constexpr size_t NEAREST_COUNT = 8;
+	constexpr size_t BUFFER_CAPACITY = 64;
+
+	for (const size_t pointCount : { 100, 1000, 10000 })
+	{
+		// 적 밀도를 일정하게 유지 // 점 1개당 약 1제곱미터
+		const float halfSize = sqrtf(static_cast<float>(pointCount)) * 0.5f;
+
+		mt19937 engine(MICROBENCHMARK_SEED);
+		uniform_real_distribution<float> position(-halfSize, halfSize);
+
+		vector<XMVECTOR> points(pointCount);
+		for (XMVECTOR& point : points) point = XMVectorSet(position(engine), 0.0f, position(engine), 1.0f);
+
+		SpatialHashGrid grid(SEPARATION_RADIUS, true);
+		vector<uint32_t> handles(pointCount);
+		const double buildElapsed = MeasureMilliseconds([&]() { for (size_t i = 0; i < pointCount; ++i) handles[i] = grid.Insert(points[i], nullptr); });
+
+		// 모든 점이 반경 안 이웃을 찾음 // ApplySeparation과 같은 형태
+		size_t bruteForceNeighbors = 0;
+		const double bruteForceElapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t i = 0; i < pointCount; ++i)
+				{
+					for (size_t j = 0; j < pointCount; ++j)
+					{
+						if (i == j) continue;
+						if (XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(points[i], points[j]))) <= SEPARATION_RADIUS * SEPARATION_RADIUS) bruteForceNeighbors++;
+					}
+				}
+			});
+
+		array<Neighbor, BUFFER_CAPACITY> neighbors = {};
+		size_t gridNeighbors = 0;
+		const double gridElapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t i = 0; i < pointCount; ++i) gridNeighbors += grid.QueryRadius(points[i], SEPARATION_RADIUS, neighbors, handles[i]);
+			});
+		if (bruteForceNeighbors != gridNeighbors) cerr << "반경 조회 결과 불일치: 전수 " << bruteForceNeighbors << ", 격자 " << gridNeighbors << endl;
+
+		const double nearestElapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t i = 0; i < pointCount; ++i) grid.QueryNearest(points[i], halfSize, span(neighbors.data(), NEAREST_COUNT), handles[i]);
+			});
+
+		// 한 프레임 이동 갱신 // 적 이동 속도
+		const size_t cellChangeCount = grid.GetCellChangeCount();
+		const double moveElapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t i = 0; i < pointCount; ++i)
+				{
+					points[i] = XMVectorAdd(points[i], XMVectorSet(0.05f, 0.0f, 0.0f, 0.0f));
+					grid.Move(handles[i], points[i]);
+				}
+			});
+
+		cout << "점 " << pointCount << "개 (셀 " << grid.GetCellCount() << "개, 생성 " << buildElapsed << " ms)" << endl;
+		cout << "  반경 조회 전체: 전수 " << bruteForceElapsed << " ms, 격자 " << gridElapsed << " ms (" << bruteForceElapsed / gridElapsed << "배)" << endl;
+		cout << "  가까운 " << NEAREST_COUNT << "개 조회 전체: " << nearestElapsed << " ms" << endl;
+		cout << "  이동 갱신: " << moveElapsed << " ms, 셀 변경 " << grid.GetCellChangeCount() - cellChangeCount << "개" << endl;
+	}
+}
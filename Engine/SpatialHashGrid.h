@@ -0,0 +1,87 @@
+#pragma once
+
+// 균일 공간 해시 격자 // 점 단위 이웃 검색
+// 항목마다 위치를 셀 크기로 나눈 정수 좌표를 해시 키로 셀 목록에 연결 // 이동은 셀이 바뀔 때만 목록을 옮김
+// 평면 모드면 y를 무시하고 xz 평면에서 거리 계산
+// 스레드 안전하지 않음 // 갱신과 조회를 동시에 하면 안 됨
+class SpatialHashGrid
+{
+public:
+	static constexpr uint32_t INVALID_HANDLE = std::numeric_limits<uint32_t>::max();
+
+	// 조회 결과
+	struct Neighbor
+	{
+		uint32_t handle = INVALID_HANDLE;
+		float distanceSquared = 0.0f;
+	};
+
+private:
+	struct Entry
+	{
+		DirectX::XMFLOAT3 position = {};
+		void* userData = nullptr;
+		uint64_t cellKey = 0;
+
+		uint32_t previous = INVALID_HANDLE; // 같은 셀의 이전 항목
+		uint32_t next = INVALID_HANDLE; // 같은 셀의 다음 항목 // 빈 항목이면 다음 빈 항목
+		bool isUsed = false;
+	};
+
+	float m_cellSize = 1.0f;
+	float m_inverseCellSize = 1.0f;
+	bool m_isPlanar = false;
+
+	std::vector<Entry> m_entries = {}; // 항목 풀 // 핸들은 인덱스
+	uint32_t m_freeList = INVALID_HANDLE;
+	size_t m_count = 0;
+	std::unordered_map<uint64_t, uint32_t> m_cells = {}; // 셀 키, 첫 항목 // 빈 셀은 지움
+
+	size_t m_cellChangeCount = 0; // Move에서 셀이 바뀐 누적 횟수
+
+public:
+	explicit SpatialHashGrid(float cellSize = 1.0f, bool isPlanar = false) : m_isPlanar(isPlanar) { SetCellSize(cellSize); }
+	~SpatialHashGrid() = default;
+	SpatialHashGrid(const SpatialHashGrid&) = default;
+	SpatialHashGrid& operator=(const SpatialHashGrid&) = default;
+	SpatialHashGrid(SpatialHashGrid&&) = default;
+	SpatialHashGrid& operator=(SpatialHashGrid&&) = default;
+
+	// 셀 크기 변경 // 모든 항목을 새 셀에 다시 연결 // 주로 검색 반경과 같게 설정
+	void SetCellSize(float cellSize);
+	float GetCellSize() const { return m_cellSize; }
+
+	// 항목 추가 후 핸들 반환 // 핸들은 제거 전까지 유지
+	uint32_t Insert(const DirectX::XMVECTOR& position, void* userData);
+	void Remove(uint32_t handle);
+	// 위치 갱신 // 셀이 바뀌었을 때만 셀 목록을 옮김
+	void Move(uint32_t handle, const DirectX::XMVECTOR& position);
+	void Clear();
+
+	void* GetUserData(uint32_t handle) const { return m_entries[handle].userData; }
+	DirectX::XMVECTOR GetPosition(uint32_t handle) const { return DirectX::XMLoadFloat3(&m_entries[handle].position); }
+	size_t GetCount() const { return m_count; }
+	size_t GetCellCount() const { return m_cells.size(); }
+	size_t GetCellChangeCount() const { return m_cellChangeCount; }
+
+	// 조회 // 결과는 호출자 버퍼에 기록하고 기록한 개수 반환 // ignoredHandle은 결과에서 제외 (자기 자신 등)
+	// 반경 안 항목 // 순서 없음 // 버퍼가 차면 중단
+	size_t QueryRadius(const DirectX::XMVECTOR& center, float radius, std::span<Neighbor> results, uint32_t ignoredHandle = INVALID_HANDLE) const;
+	// maxRadius 안에서 가까운 순서로 최대 results.size()개 // 중심 셀부터 한 겹씩 넓혀 가며 더 가까운 항목이 있을 수 없으면 중단
+	size_t QueryNearest(const DirectX::XMVECTOR& center, float maxRadius, std::span<Neighbor> results, uint32_t ignoredHandle = INVALID_HANDLE) const;
+
+	// 적 분리 검색 형태로 100 ~ 10000개에서 전수 검사와 격자 조회 비교 결과를 콘솔에 출력
+	static void RunMicrobenchmarks();
+
+private:
+	std::array<int32_t, 3> GetCellCoordinate(const DirectX::XMFLOAT3& position) const;
+	static uint64_t GetCellKey(const std::array<int32_t, 3>& coordinate);
+
+	void LinkToCell(uint32_t handle);
+	void UnlinkFromCell(uint32_t handle);
+
+	float GetDistanceSquared(const DirectX::XMFLOAT3& a, const DirectX::XMFLOAT3& b) const;
+	// 셀 하나의 항목마다 callback(handle, distanceSquared) 호출 // false를 반환하면 중단
+	template<typename F>
+	bool ForEachInCell(const std::array<int32_t, 3>& coordinate, const DirectX::XMFLOAT3& center, F&& callback) const;
+};
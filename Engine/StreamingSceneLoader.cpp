@@ -0,0 +1,296 @@
+#include "stdafx.h"
+#include "StreamingSceneLoader.h"
+
+#include "SceneBase.h"
+#include "GameObjectBase.h"
+#include "ComponentBase.h"
+
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib") // GetProcessMemoryInfo
+
+using namespace std;
+
+namespace
+{
+	size_t GetWorkingSetBytes()
+	{
+		PROCESS_MEMORY_COUNTERS memoryCounters = {};
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters))) return 0;
+
+		return memoryCounters.WorkingSetSize;
+	}
+}
+
+bool StreamingSceneLoader::LoadScene(const filesystem::path& sceneFilePath, SceneBase& scene, StreamingLoadStats* stats)
+{
+	SceneLoadData loadData = {};
+	if (!ReadScene(sceneFilePath, loadData, stats)) return false;
+
+	// 모든 게임 오브젝트 생성에 성공한 경우에만 씬 교체
+	scene.CommitLoadData(loadData);
+
+	return true;
+}
+
+bool StreamingSceneLoader::ReadScene(const filesystem::path& sceneFilePath, SceneLoadData& loadData, StreamingLoadStats* stats, atomic<float>* progress)
+{
+	ifstream file(sceneFilePath, ios::binary | ios::ate);
+	if (!file.is_open())
+	{
+		cerr << "씬 파일을 열 수 없습니다: " << sceneFilePath.string() << endl;
+		return false;
+	}
+
+	const chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+	StreamingSceneLoader loader;
+	loader.m_stream = &file;
+	loader.m_streamSize = file.tellg();
+	loader.m_progress = progress;
+	loader.m_startWorkingSetBytes = GetWorkingSetBytes();
+	file.seekg(0, ios::beg);
+
+	if (!nlohmann::json::sax_parse(file, &loader) || !loader.m_frames.empty()) return false;
+
+	loadData.sceneSettings = move(loader.m_sceneSettings);
+	loadData.rootGameObjects = move(loader.m_rootGameObjects);
+
+	loader.m_stats.elapsedMilliseconds = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+	loader.SampleWorkingSet();
+
+	if (stats) *stats = loader.m_stats;
+
+	return true;
+}
+
+bool StreamingSceneLoader::start_object(size_t)
+{
+	// 필드 값 내부의 객체
+	if (!m_values.empty() || (!m_frames.empty() && m_frames.back() != Frame::GameObjectArray && m_frames.back() != Frame::ComponentArray))
+	{
+		nlohmann::json* value = StoreValue(nlohmann::json::object());
+		if (!value) return false;
+
+		m_values.push_back(value);
+		return true;
+	}
+
+	if (m_frames.empty())
+	{
+		m_frames.push_back(Frame::Scene);
+	}
+	else if (m_frames.back() == Frame::GameObjectArray)
+	{
+		m_frames.push_back(Frame::GameObject);
+		m_pendingGameObjects.emplace_back();
+	}
+	else
+	{
+		m_frames.push_back(Frame::Component);
+		m_pendingComponent = nlohmann::json::object();
+	}
+
+	return true;
+}
+
+bool StreamingSceneLoader::key(string_t& value)
+{
+	m_key = move(value);
+
+	return true;
+}
+
+bool StreamingSceneLoader::end_object()
+{
+	if (!m_values.empty())
+	{
+		m_values.pop_back();
+		return true;
+	}
+
+	if (m_frames.empty()) return false;
+
+	const Frame frame = m_frames.back();
+	m_frames.pop_back();
+
+	switch (frame)
+	{
+	case Frame::Component:
+		return BuildComponent();
+
+	case Frame::GameObject:
+		return BuildGameObject();
+
+	default:
+		return true;
+	}
+}
+
+bool StreamingSceneLoader::start_array(size_t)
+{
+	// 게임 오브젝트, 컴포넌트 배열은 값으로 저장하지 않고 구조 위치만 기록
+	if (m_values.empty() && !m_frames.empty())
+	{
+		const Frame frame = m_frames.back();
+
+		if (frame == Frame::Scene && m_key == "rootGameObjects")
+		{
+			m_frames.push_back(Frame::GameObjectArray);
+			return true;
+		}
+		if (frame == Frame::GameObject && m_key == "childGameObjects")
+		{
+			m_frames.push_back(Frame::GameObjectArray);
+			return true;
+		}
+		if (frame == Frame::GameObject && m_key == "components")
+		{
+			m_frames.push_back(Frame::ComponentArray);
+			return true;
+		}
+	}
+
+	nlohmann::json* value = StoreValue(nlohmann::json::array());
+	if (!value) return false;
+
+	m_values.push_back(value);
+	return true;
+}
+
+bool StreamingSceneLoader::end_array()
+{
+	if (!m_values.empty())
+	{
+		m_values.pop_back();
+		return true;
+	}
+
+	if (m_frames.empty()) return false;
+
+	m_frames.pop_back();
+	return true;
+}
+
+bool StreamingSceneLoader::parse_error(size_t position, const std::string& lastToken, const nlohmann::detail::exception& exception)
+{
+	cerr << "씬 JSON 파싱 오류 (위치 " << position << ", 토큰 '" << lastToken << "'): " << exception.what() << endl;
+
+	return false;
+}
+
+nlohmann::json* StreamingSceneLoader::StoreValue(nlohmann::json&& value)
+{
+	// 필드 값 내부
+	if (!m_values.empty())
+	{
+		nlohmann::json& parent = *m_values.back();
+		if (parent.is_array())
+		{
+			parent.push_back(move(value));
+			return &parent.back();
+		}
+
+		nlohmann::json& field = parent[m_key];
+		field = move(value);
+		return &field;
+	}
+
+	if (m_frames.empty()) return nullptr;
+
+	nlohmann::json* fields = nullptr;
+	switch (m_frames.back())
+	{
+	case Frame::Scene:
+		fields = &m_sceneSettings;
+		break;
+
+	case Frame::GameObject:
+		fields = &m_pendingGameObjects.back().fields;
+		break;
+
+	case Frame::Component:
+		fields = &m_pendingComponent;
+		break;
+
+	default:
+		// 게임 오브젝트, 컴포넌트 배열에는 객체만 올 수 있음
+		cerr << "씬 JSON 구조 오류: 게임 오브젝트 또는 컴포넌트 배열에 객체가 아닌 값이 있습니다." << endl;
+		return nullptr;
+	}
+
+	nlohmann::json& field = (*fields)[m_key];
+	field = move(value);
+	return &field;
+}
+
+bool StreamingSceneLoader::BuildComponent()
+{
+	if (m_pendingGameObjects.empty() || !m_pendingComponent.contains("type")) return false;
+
+	unique_ptr<ComponentBase> component = TypeRegistry::GetInstance().CreateComponent(m_pendingComponent["type"].get<std::string>());
+
+	// 키 단위 역직렬화 // 처리하지 못한 필드가 있거나 필드가 없으면 마이그레이션되지 않은 컴포넌트로 보고 Deserialize(json) 사용
+	bool isFieldDeserialized = false;
+	for (const auto& [fieldKey, fieldValue] : m_pendingComponent.items())
+	{
+		if (fieldKey == "type") continue;
+
+		isFieldDeserialized = component->DeserializeField(fieldKey, fieldValue);
+		if (!isFieldDeserialized) break;
+	}
+	if (!isFieldDeserialized)
+	{
+		static_cast<Base*>(component.get())->BaseDeserialize(m_pendingComponent);
+		m_stats.fallbackComponentCount++;
+	}
+
+	m_pendingGameObjects.back().components.push_back(move(component));
+	m_stats.componentCount++;
+
+	return true;
+}
+
+bool StreamingSceneLoader::BuildGameObject()
+{
+	if (m_pendingGameObjects.empty()) return false;
+
+	PendingGameObject pending = move(m_pendingGameObjects.back());
+	m_pendingGameObjects.pop_back();
+
+	if (!pending.fields.contains("type")) return false;
+
+	unique_ptr<GameObjectBase> gameObject = TypeRegistry::GetInstance().CreateGameObject(pending.fields["type"].get<std::string>());
+
+	// GameObjectBase::BaseDeserialize와 같은 순서 // 트랜스폼, 파생 클래스 데이터, 컴포넌트, 자식
+	gameObject->DeserializeTransform(pending.fields);
+	gameObject->Deserialize(pending.fields);
+
+	for (unique_ptr<ComponentBase>& component : pending.components) gameObject->AttachComponent(move(component));
+
+	for (unique_ptr<GameObjectBase>& childGameObject : pending.childGameObjects) gameObject->AttachChild(move(childGameObject));
+
+	gameObject->SetDirty();
+	m_stats.gameObjectCount++;
+
+	if (m_pendingGameObjects.empty())
+	{
+		m_rootGameObjects.push_back(move(gameObject));
+		SampleWorkingSet();
+
+		// 파일을 읽은 위치 기준 진행률
+		if (m_progress && m_streamSize > 0)
+		{
+			const streamoff position = m_stream->tellg();
+			if (position >= 0) m_progress->store(static_cast<float>(position) / static_cast<float>(m_streamSize));
+		}
+	}
+	else m_pendingGameObjects.back().childGameObjects.push_back(move(gameObject));
+
+	return true;
+}
+
+void StreamingSceneLoader::SampleWorkingSet()
+{
+	const size_t workingSetBytes = GetWorkingSetBytes();
+	if (workingSetBytes > m_startWorkingSetBytes) m_stats.peakWorkingSetGrowthBytes = max(m_stats.peakWorkingSetGrowthBytes, workingSetBytes - m_startWorkingSetBytes);
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+class SceneBase;
+class GameObjectBase;
+class ComponentBase;
+struct SceneLoadData;
+
+struct StreamingLoadStats
+{
+	size_t gameObjectCount = 0; // 생성한 게임 오브젝트 수
+	size_t componentCount = 0; // 생성한 컴포넌트 수
+	size_t fallbackComponentCount = 0; // Deserialize(json)로 대체 처리한 컴포넌트 수
+	double elapsedMilliseconds = 0.0; // 파싱 및 생성 시간
+	size_t peakWorkingSetGrowthBytes = 0; // 로드 시작 대비 프로세스 작업 집합 최대 증가량 // 루트 게임 오브젝트 생성마다 표본 // 다른 스레드의 할당도 포함
+};
+
+// JSON 이벤트를 받아 전체 JSON 트리 없이 게임 오브젝트와 컴포넌트를 바로 생성하는 씬 로더
+// JSON 키는 정렬되어 저장되므로 "type"이 항상 마지막에 온다 // 게임 오브젝트와 컴포넌트 하나 분량의 필드만 임시 보관 후 객체 닫힘 이벤트에서 생성
+class StreamingSceneLoader : public nlohmann::json_sax<nlohmann::json>
+{
+	enum class Frame
+	{
+		Scene,
+		GameObjectArray,
+		GameObject,
+		ComponentArray,
+		Component
+	};
+
+	struct PendingGameObject
+	{
+		nlohmann::json fields = nlohmann::json::object(); // 이름, 트랜스폼, 파생 클래스 필드
+		std::vector<std::unique_ptr<ComponentBase>> components = {}; // 생성 완료된 컴포넌트 배열
+		std::vector<std::unique_ptr<GameObjectBase>> childGameObjects = {}; // 생성 완료된 자식 게임 오브젝트 배열
+	};
+
+	std::vector<Frame> m_frames = {}; // 씬 구조 위치 스택
+	std::vector<nlohmann::json*> m_values = {}; // 읽는 중인 필드 값 내부의 객체, 배열 스택
+	std::string m_key = {}; // 마지막으로 읽은 키
+
+	nlohmann::json m_sceneSettings = nlohmann::json::object(); // 게임 오브젝트를 제외한 씬 데이터
+	std::vector<PendingGameObject> m_pendingGameObjects = {}; // 생성 대기 중인 게임 오브젝트 스택
+	nlohmann::json m_pendingComponent = nlohmann::json::object(); // 생성 대기 중인 컴포넌트 필드
+	std::vector<std::unique_ptr<GameObjectBase>> m_rootGameObjects = {}; // 생성 완료된 루트 게임 오브젝트 배열
+
+	StreamingLoadStats m_stats = {};
+
+	std::istream* m_stream = nullptr; // 읽는 중인 파일 스트림 // 진행률 계산용
+	std::streamoff m_streamSize = 0; // 파일 크기
+	std::atomic<float>* m_progress = nullptr; // 진행률(0~1) 기록 위치 // 루트 게임 오브젝트 생성 시 갱신
+	size_t m_startWorkingSetBytes = 0; // 로드 시작 시 작업 집합 크기
+
+public:
+	StreamingSceneLoader() = default;
+	~StreamingSceneLoader() override = default;
+	StreamingSceneLoader(const StreamingSceneLoader&) = delete;
+	StreamingSceneLoader& operator=(const StreamingSceneLoader&) = delete;
+	StreamingSceneLoader(StreamingSceneLoader&&) = delete;
+	StreamingSceneLoader& operator=(StreamingSceneLoader&&) = delete;
+
+	// JSON 씬 파일을 스트리밍으로 로드 // 파싱 실패 시 씬을 건드리지 않고 false 반환 // 초기화는 호출하지 않음
+	static bool LoadScene(const std::filesystem::path& sceneFilePath, SceneBase& scene, StreamingLoadStats* stats = nullptr);
+	// JSON 씬 파일을 씬에 반영하지 않고 읽기 // 백그라운드 스레드에서 호출 가능
+	static bool ReadScene(const std::filesystem::path& sceneFilePath, SceneLoadData& loadData, StreamingLoadStats* stats = nullptr, std::atomic<float>* progress = nullptr);
+
+	bool null() override { return PutValue(nullptr); }
+	bool boolean(bool value) override { return PutValue(value); }
+	bool number_integer(number_integer_t value) override { return PutValue(value); }
+	bool number_unsigned(number_unsigned_t value) override { return PutValue(value); }
+	bool number_float(number_float_t value, const string_t&) override { return PutValue(value); }
+	bool string(string_t& value) override { return PutValue(std::move(value)); }
+	bool binary(binary_t& value) override { return PutValue(nlohmann::json::binary(std::move(value))); }
+
+	bool start_object(std::size_t) override;
+	bool key(string_t& value) override;
+	bool end_object() override;
+
+	bool start_array(std::size_t) override;
+	bool end_array() override;
+
+	bool parse_error(std::size_t position, const std::string& lastToken, const nlohmann::detail::exception& exception) override;
+
+private:
+	// 현재 위치에 값 저장 // 저장된 값의 포인터 반환
+	nlohmann::json* StoreValue(nlohmann::json&& value);
+	bool PutValue(nlohmann::json&& value) { return StoreValue(std::move(value)) != nullptr; }
+
+	// 보관한 필드로 컴포넌트 생성 // 키 단위 역직렬화를 지원하지 않으면 Deserialize(json)로 대체
+	bool BuildComponent();
+	// 보관한 필드와 생성 완료된 컴포넌트, 자식으로 게임 오브젝트 생성
+	bool BuildGameObject();
+	// 현재 작업 집합 크기로 최대 증가량 갱신
+	void SampleWorkingSet();
+};
@@ -0,0 +1,232 @@
+#include "stdafx.h"
+#include "Telemetry.h"
+
+using namespace std;
+
+size_t Telemetry::RegisterCounter(const string& name)
+{
+	lock_guard<mutex> lock(m_registerMutex);
+
+	const size_t counterCount = m_counterCount.load(memory_order_relaxed);
+	for (size_t i = 0; i < counterCount; ++i) if (m_counters[i].name == name) return i;
+
+	if (counterCount == MAX_COUNTER_COUNT)
+	{
+		cerr << "텔레메트리 카운터 한도 초과: " << name << endl;
+		return INVALID_ID;
+	}
+
+	m_counters[counterCount].name = name;
+	m_counterCount.store(counterCount + 1, memory_order_release);
+
+	return counterCount;
+}
+
+size_t Telemetry::RegisterHistogram(const string& name)
+{
+	lock_guard<mutex> lock(m_registerMutex);
+
+	const size_t histogramCount = m_histogramCount.load(memory_order_relaxed);
+	for (size_t i = 0; i < histogramCount; ++i) if (m_histograms[i].name == name) return i;
+
+	if (histogramCount == MAX_HISTOGRAM_COUNT)
+	{
+		cerr << "텔레메트리 히스토그램 한도 초과: " << name << endl;
+		return INVALID_ID;
+	}
+
+	m_histograms[histogramCount].name = name;
+	m_histogramCount.store(histogramCount + 1, memory_order_release);
+
+	return histogramCount;
+}
+
+void Telemetry::AddSample(size_t id, uint64_t value)
+{
+	if (id >= MAX_HISTOGRAM_COUNT) return;
+
+	Histogram& histogram = m_histograms[id];
+	histogram.count.fetch_add(1, memory_order_relaxed);
+	histogram.sum.fetch_add(value, memory_order_relaxed);
+
+	uint64_t currentMax = histogram.max.load(memory_order_relaxed);
+	while (value > currentMax && !histogram.max.compare_exchange_weak(currentMax, value, memory_order_relaxed));
+
+	// 값의 비트 길이로 칸 결정
+	size_t bucket = 0;
+	for (uint64_t remaining = value; remaining > 0; remaining >>= 1) ++bucket;
+	histogram.buckets[min(bucket, HISTOGRAM_BUCKET_COUNT - 1)].fetch_add(1, memory_order_relaxed);
+}
+
+void Telemetry::EndFrame()
+{
+	const size_t counterCount = m_counterCount.load(memory_order_acquire);
+	const size_t histogramCount = m_histogramCount.load(memory_order_acquire);
+
+	for (size_t i = 0; i < counterCount; ++i)
+	{
+		Counter& counter = m_counters[i];
+		counter.lastFrameValue = counter.value.exchange(0, memory_order_relaxed);
+		counter.totalValue += counter.lastFrameValue;
+	}
+
+	for (size_t i = 0; i < histogramCount; ++i)
+	{
+		Histogram& histogram = m_histograms[i];
+		HistogramSnapshot& snapshot = histogram.lastFrame;
+		snapshot.count = histogram.count.exchange(0, memory_order_relaxed);
+		snapshot.sum = histogram.sum.exchange(0, memory_order_relaxed);
+		snapshot.max = histogram.max.exchange(0, memory_order_relaxed);
+		for (size_t j = 0; j < HISTOGRAM_BUCKET_COUNT; ++j) snapshot.buckets[j] = histogram.buckets[j].exchange(0, memory_order_relaxed);
+	}
+
+	if (!m_capturePath.empty())
+	{
+		FrameRecord& record = m_frameRecords.emplace_back();
+		record.counters.resize(counterCount);
+		for (size_t i = 0; i < counterCount; ++i) record.counters[i] = m_counters[i].lastFrameValue;
+		record.histograms.resize(histogramCount);
+		for (size_t i = 0; i < histogramCount; ++i) record.histograms[i] = m_histograms[i].lastFrame;
+	}
+
+	m_frameCount++;
+}
+
+void Telemetry::StartCapture(const filesystem::path& filePath)
+{
+	m_capturePath = filePath;
+	m_frameRecords.clear();
+}
+
+bool Telemetry::Finalize()
+{
+	if (m_capturePath.empty()) return true;
+
+	ofstream file(m_capturePath);
+	if (!file)
+	{
+		cerr << "텔레메트리 파일 열기 실패: " << m_capturePath.string() << endl;
+		return false;
+	}
+
+	const bool isWritten = m_capturePath.extension() == ".json" ? WriteJSON(file) : WriteCSV(file);
+	cout << "텔레메트리 저장: " << m_capturePath.string() << " (" << m_frameRecords.size() << "프레임)" << endl;
+
+	m_capturePath.clear();
+	m_frameRecords.clear();
+
+	return isWritten;
+}
+
+uint64_t Telemetry::GetLastFrameValue(const string& counterName) const
+{
+	const size_t counterCount = m_counterCount.load(memory_order_acquire);
+	for (size_t i = 0; i < counterCount; ++i) if (m_counters[i].name == counterName) return m_counters[i].lastFrameValue;
+
+	return 0;
+}
+
+#ifdef _DEBUG
+void Telemetry::RenderImGui()
+{
+	ImGui::Begin("Telemetry");
+
+	ImGui::Text("Frame %llu", m_frameCount);
+
+	if (ImGui::BeginTable("Counters", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+	{
+		ImGui::TableSetupColumn("Counter");
+		ImGui::TableSetupColumn("Last Frame");
+		ImGui::TableSetupColumn("Per Frame Avg");
+		ImGui::TableHeadersRow();
+
+		const size_t counterCount = m_counterCount.load(memory_order_acquire);
+		for (size_t i = 0; i < counterCount; ++i)
+		{
+			const Counter& counter = m_counters[i];
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::Text("%s", counter.name.c_str());
+			ImGui::TableNextColumn(); ImGui::Text("%llu", counter.lastFrameValue);
+			ImGui::TableNextColumn(); ImGui::Text("%.2f", m_frameCount > 0 ? static_cast<double>(counter.totalValue) / m_frameCount : 0.0);
+		}
+
+		ImGui::EndTable();
+	}
+
+	const size_t histogramCount = m_histogramCount.load(memory_order_acquire);
+	for (size_t i = 0; i < histogramCount; ++i)
+	{
+		const Histogram& histogram = m_histograms[i];
+		const HistogramSnapshot& snapshot = histogram.lastFrame;
+
+		ImGui::Separator();
+		ImGui::Text("%s: %llu samples, mean %.2f, max %llu", histogram.name.c_str(), snapshot.count, snapshot.GetMean(), snapshot.max);
+
+		array<float, HISTOGRAM_BUCKET_COUNT> buckets = {};
+		for (size_t j = 0; j < HISTOGRAM_BUCKET_COUNT; ++j) buckets[j] = static_cast<float>(snapshot.buckets[j]);
+		ImGui::PushID(static_cast<int>(i));
+		ImGui::PlotHistogram("##Buckets", buckets.data(), static_cast<int>(buckets.size()), 0, "log2 buckets", 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f));
+		ImGui::PopID();
+	}
+
+	ImGui::End();
+}
+#endif
+
+bool Telemetry::WriteCSV(ofstream& file) const
+{
+	const size_t counterCount = m_counterCount.load(memory_order_acquire);
+	const size_t histogramCount = m_histogramCount.load(memory_order_acquire);
+
+	// 헤더 // 히스토그램은 표본 수, 평균, 최댓값 열
+	file << "frame";
+	for (size_t i = 0; i < counterCount; ++i) file << "," << m_counters[i].name;
+	for (size_t i = 0; i < histogramCount; ++i) file << "," << m_histograms[i].name << ".count," << m_histograms[i].name << ".mean," << m_histograms[i].name << ".max";
+	file << "\n";
+
+	for (size_t frame = 0; frame < m_frameRecords.size(); ++frame)
+	{
+		const FrameRecord& record = m_frameRecords[frame];
+
+		file << frame;
+		for (size_t i = 0; i < counterCount; ++i) file << "," << (i < record.counters.size() ? record.counters[i] : 0);
+		for (size_t i = 0; i < histogramCount; ++i)
+		{
+			const HistogramSnapshot snapshot = i < record.histograms.size() ? record.histograms[i] : HistogramSnapshot{};
+			file << "," << snapshot.count << "," << snapshot.GetMean() << "," << snapshot.max;
+		}
+		file << "\n";
+	}
+
+	return static_cast<bool>(file);
+}
+
+bool Telemetry::WriteJSON(ofstream& file) const
+{
+	const size_t counterCount = m_counterCount.load(memory_order_acquire);
+	const size_t histogramCount = m_histogramCount.load(memory_order_acquire);
+
+	nlohmann::json frames = nlohmann::json::array();
+	for (const FrameRecord& record : m_frameRecords)
+	{
+		nlohmann::json frameData = {};
+		for (size_t i = 0; i < counterCount; ++i) frameData["counters"][m_counters[i].name] = i < record.counters.size() ? record.counters[i] : 0;
+		for (size_t i = 0; i < histogramCount; ++i)
+		{
+			const HistogramSnapshot snapshot = i < record.histograms.size() ? record.histograms[i] : HistogramSnapshot{};
+			frameData["histograms"][m_histograms[i].name] =
+			{
+				{ "count", snapshot.count },
+				{ "mean", snapshot.GetMean() },
+				{ "max", snapshot.max },
+				{ "buckets", snapshot.buckets }
+			};
+		}
+		frames.push_back(move(frameData));
+	}
+
+	file << nlohmann::json{ { "frames", move(frames) } }.dump();
+
+	return static_cast<bool>(file);
+}
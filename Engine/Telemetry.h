@@ -0,0 +1,115 @@
+#pragma once
+
+// 이름 붙인 카운터에 값 더하기 // 이름별 ID는 처음 호출 시 한 번만 등록
+#define TELEMETRY_COUNT(name, value) \
+	do \
+	{ \
+		static const size_t telemetryCounterId = Telemetry::GetInstance().RegisterCounter(name); \
+		Telemetry::GetInstance().AddCounter(telemetryCounterId, static_cast<uint64_t>(value)); \
+	} while (false)
+
+// 이름 붙인 히스토그램에 표본 추가 // 이름별 ID는 처음 호출 시 한 번만 등록
+#define TELEMETRY_SAMPLE(name, value) \
+	do \
+	{ \
+		static const size_t telemetryHistogramId = Telemetry::GetInstance().RegisterHistogram(name); \
+		Telemetry::GetInstance().AddSample(telemetryHistogramId, static_cast<uint64_t>(value)); \
+	} while (false)
+
+// 프레임 단위 엔진 카운터, 히스토그램 레지스트리
+// 값은 프레임 동안 원자적으로 누적되고 EndFrame에서 직전 프레임 값으로 옮긴 뒤 초기화 // 병렬 프레임 단계의 작업자 스레드에서도 기록 가능
+// 수집 중이면 프레임별 값을 모아 종료 시 CSV 또는 JSON(확장자로 구분)으로 저장
+class Telemetry : public Singleton<Telemetry>
+{
+	friend class Singleton<Telemetry>;
+
+public:
+	static constexpr size_t MAX_COUNTER_COUNT = 128; // 등록 가능한 카운터 수 // 기록 중 재할당하지 않도록 고정 크기
+	static constexpr size_t MAX_HISTOGRAM_COUNT = 32; // 등록 가능한 히스토그램 수
+	static constexpr size_t HISTOGRAM_BUCKET_COUNT = 16; // 0번은 0, i번은 [2^(i-1), 2^i) // 마지막 칸은 그 이상 전부
+	static constexpr size_t INVALID_ID = std::numeric_limits<size_t>::max(); // 등록 한도 초과 시 반환 // 기록 무시
+
+	// 히스토그램 한 프레임 요약
+	struct HistogramSnapshot
+	{
+		uint64_t count = 0; // 표본 수
+		uint64_t sum = 0; // 표본 합
+		uint64_t max = 0; // 최댓값
+		std::array<uint64_t, HISTOGRAM_BUCKET_COUNT> buckets = {};
+
+		double GetMean() const { return count > 0 ? static_cast<double>(sum) / count : 0.0; }
+	};
+
+private:
+	struct Counter
+	{
+		std::string name = {};
+		std::atomic<uint64_t> value = 0; // 이번 프레임 누적값
+		uint64_t lastFrameValue = 0; // 직전 프레임 값
+		uint64_t totalValue = 0; // 실행 전체 누적값
+	};
+
+	struct Histogram
+	{
+		std::string name = {};
+		std::atomic<uint64_t> count = 0;
+		std::atomic<uint64_t> sum = 0;
+		std::atomic<uint64_t> max = 0;
+		std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKET_COUNT> buckets = {};
+		HistogramSnapshot lastFrame = {}; // 직전 프레임 요약
+	};
+
+	// 수집 중 한 프레임 기록 // 나중에 등록된 항목은 앞 프레임에서 0으로 저장
+	struct FrameRecord
+	{
+		std::vector<uint64_t> counters = {};
+		std::vector<HistogramSnapshot> histograms = {};
+	};
+
+	std::mutex m_registerMutex = {}; // 등록 보호 // 기록은 잠금 없음
+	std::array<Counter, MAX_COUNTER_COUNT> m_counters = {};
+	std::atomic<size_t> m_counterCount = 0;
+	std::array<Histogram, MAX_HISTOGRAM_COUNT> m_histograms = {};
+	std::atomic<size_t> m_histogramCount = 0;
+
+	uint64_t m_frameCount = 0; // 종료한 프레임 수
+
+	std::filesystem::path m_capturePath = {}; // 비어 있으면 수집하지 않음
+	std::vector<FrameRecord> m_frameRecords = {};
+
+public:
+	~Telemetry() = default;
+	Telemetry(const Telemetry&) = delete;
+	Telemetry& operator=(const Telemetry&) = delete;
+	Telemetry(Telemetry&&) = delete;
+	Telemetry& operator=(Telemetry&&) = delete;
+
+	// 이름으로 등록 // 이미 있으면 기존 ID 반환 // 한도를 넘으면 INVALID_ID
+	size_t RegisterCounter(const std::string& name);
+	size_t RegisterHistogram(const std::string& name);
+
+	void AddCounter(size_t id, uint64_t value) { if (id < MAX_COUNTER_COUNT) m_counters[id].value.fetch_add(value, std::memory_order_relaxed); }
+	void AddSample(size_t id, uint64_t value);
+
+	// 프레임 종료 시 호출 // 이번 프레임 값을 직전 프레임 값으로 옮기고 초기화, 수집 중이면 기록
+	void EndFrame();
+
+	// 프레임별 값 수집 시작 // 확장자가 .json이면 JSON, 그 외는 CSV
+	void StartCapture(const std::filesystem::path& filePath);
+	// 수집한 값 저장 // 수집 중이 아니면 아무것도 안 함 // 실패하면 false
+	bool Finalize();
+
+	// 직전 프레임 값 // 없는 이름이면 0
+	uint64_t GetLastFrameValue(const std::string& counterName) const;
+
+	#ifdef _DEBUG
+	// 직전 프레임 카운터, 히스토그램 창
+	void RenderImGui();
+	#endif
+
+private:
+	Telemetry() = default;
+
+	bool WriteCSV(std::ofstream& file) const;
+	bool WriteJSON(std::ofstream& file) const;
+};
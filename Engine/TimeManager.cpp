@@ -11,8 +11,8 @@ void TimeManager::UpdateTime()
 	m_currentTime = timeGetTime();
 
 	constexpr float millisecondsToSeconds = 1.0f / 1000.0f;
-	m_deltaTime = static_cast<float>(m_currentTime - m_previousTime) * millisecondsToSeconds * m_timeScale;
-	m_deltaNoneScaleTime = static_cast<float>(m_currentTime - m_previousTime) * millisecondsToSeconds;
+	m_deltaNoneScaleTime = m_fixedDeltaTime > 0.0f ? m_fixedDeltaTime : static_cast<float>(m_currentTime - m_previousTime) * millisecondsToSeconds;
+	m_deltaTime = m_deltaNoneScaleTime * m_timeScale;
 	m_totalTime += m_deltaTime;
 	m_previousTime = m_currentTime;
 }
\ No newline at end of file
@@ -12,6 +12,7 @@ class TimeManager : public Singleton<TimeManager>
 	float m_totalTime = 0.0f; // 총 경과 시간 // 초 단위
 
 	float m_deltaNoneScaleTime = 0.0f;
+	float m_fixedDeltaTime = 0.0f; // 고정 델타 타임 // 0보다 크면 실제 경과 시간 대신 사용 // 헤드리스 실행, 재현용
 public:
 	~TimeManager() = default;
 	TimeManager(const TimeManager&) = delete;
@@ -25,6 +26,9 @@ public:
 	void UpdateTime();
 
 	void SetTimeScale(float timeScale) { m_timeScale = timeScale; }
+	// 고정 델타 타임 설정 // 0이면 실제 경과 시간 사용
+	void SetFixedDeltaTime(float fixedDeltaTime) { m_fixedDeltaTime = fixedDeltaTime; }
+	float GetFixedDeltaTime() const { return m_fixedDeltaTime; }
 	// 델타 타임 얻기
 	float& GetDeltaTime() { return m_deltaTime; }
 	float GetTotalTime() const { return m_totalTime; }
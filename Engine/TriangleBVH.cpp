@@ -0,0 +1,420 @@
+#include "stdafx.h"
+#include "TriangleBVH.h"
+
+#include "Microbenchmark.h"
+#include "ResourceManager.h"
+
+using namespace std;
+using namespace DirectX;
+
+REGISTER_MICROBENCHMARK(TriangleBVH, TriangleBVH::RunMicrobenchmarks)
+
+void TriangleBVH::TrianglePacket::Set(size_t lane, uint32_t triangle, const XMFLOAT3& v0, const XMFLOAT3& v1, const XMFLOAT3& v2)
+{
+	triangles[lane] = triangle;
+
+	const array<float, 3> vertexComponents = { v0.x, v0.y, v0.z };
+	const array<float, 3> edge1Components = { v1.x - v0.x, v1.y - v0.y, v1.z - v0.z };
+	const array<float, 3> edge2Components = { v2.x - v0.x, v2.y - v0.y, v2.z - v0.z };
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		vertex[axis].m128_f32[lane] = vertexComponents[axis];
+		edge1[axis].m128_f32[lane] = edge1Components[axis];
+		edge2[axis].m128_f32[lane] = edge2Components[axis];
+	}
+}
+
+void TriangleBVH::TrianglePacket::Get(size_t lane, _Out_ XMVECTOR& v0, _Out_ XMVECTOR& v1, _Out_ XMVECTOR& v2) const
+{
+	v0 = XMVectorSet(vertex[0].m128_f32[lane], vertex[1].m128_f32[lane], vertex[2].m128_f32[lane], 0.0f);
+	v1 = XMVectorAdd(v0, XMVectorSet(edge1[0].m128_f32[lane], edge1[1].m128_f32[lane], edge1[2].m128_f32[lane], 0.0f));
+	v2 = XMVectorAdd(v0, XMVectorSet(edge2[0].m128_f32[lane], edge2[1].m128_f32[lane], edge2[2].m128_f32[lane], 0.0f));
+}
+
+XMVECTOR TriangleBVH::TrianglePacket::Intersect(FXMVECTOR origin, FXMVECTOR direction, float maxDistance) const
+{
+	// 묄러-트룸보어 // 행렬식 부호와 관계없이 검사하므로 양면
+	const XMVECTOR directionX = XMVectorSplatX(direction);
+	const XMVECTOR directionY = XMVectorSplatY(direction);
+	const XMVECTOR directionZ = XMVectorSplatZ(direction);
+
+	// p = 방향 x 모서리2
+	const XMVECTOR pX = XMVectorNegativeMultiplySubtract(directionZ, edge2[1], XMVectorMultiply(directionY, edge2[2]));
+	const XMVECTOR pY = XMVectorNegativeMultiplySubtract(directionX, edge2[2], XMVectorMultiply(directionZ, edge2[0]));
+	const XMVECTOR pZ = XMVectorNegativeMultiplySubtract(directionY, edge2[0], XMVectorMultiply(directionX, edge2[1]));
+
+	const XMVECTOR determinant = XMVectorMultiplyAdd(edge1[2], pZ, XMVectorMultiplyAdd(edge1[1], pY, XMVectorMultiply(edge1[0], pX)));
+	const XMVECTOR inverseDeterminant = XMVectorReciprocal(determinant);
+
+	// s = 시작점 - 꼭짓점
+	const XMVECTOR sX = XMVectorSubtract(XMVectorSplatX(origin), vertex[0]);
+	const XMVECTOR sY = XMVectorSubtract(XMVectorSplatY(origin), vertex[1]);
+	const XMVECTOR sZ = XMVectorSubtract(XMVectorSplatZ(origin), vertex[2]);
+
+	const XMVECTOR u = XMVectorMultiply(XMVectorMultiplyAdd(sZ, pZ, XMVectorMultiplyAdd(sY, pY, XMVectorMultiply(sX, pX))), inverseDeterminant);
+
+	// q = s x 모서리1
+	const XMVECTOR qX = XMVectorNegativeMultiplySubtract(sZ, edge1[1], XMVectorMultiply(sY, edge1[2]));
+	const XMVECTOR qY = XMVectorNegativeMultiplySubtract(sX, edge1[2], XMVectorMultiply(sZ, edge1[0]));
+	const XMVECTOR qZ = XMVectorNegativeMultiplySubtract(sY, edge1[0], XMVectorMultiply(sX, edge1[1]));
+
+	const XMVECTOR v = XMVectorMultiply(XMVectorMultiplyAdd(directionZ, qZ, XMVectorMultiplyAdd(directionY, qY, XMVectorMultiply(directionX, qX))), inverseDeterminant);
+	const XMVECTOR distance = XMVectorMultiply(XMVectorMultiplyAdd(edge2[2], qZ, XMVectorMultiplyAdd(edge2[1], qY, XMVectorMultiply(edge2[0], qX))), inverseDeterminant);
+
+	// 평행하거나 빈 레인, 삼각형 밖, 뒤쪽, 최대 거리보다 먼 충돌 제외 // NaN은 모든 비교가 거짓이므로 함께 걸러짐
+	XMVECTOR isHit = XMVectorGreater(XMVectorAbs(determinant), XMVectorReplicate(1e-12f));
+	isHit = XMVectorAndInt(isHit, XMVectorGreaterOrEqual(u, XMVectorZero()));
+	isHit = XMVectorAndInt(isHit, XMVectorGreaterOrEqual(v, XMVectorZero()));
+	isHit = XMVectorAndInt(isHit, XMVectorLessOrEqual(XMVectorAdd(u, v), g_XMOne));
+	isHit = XMVectorAndInt(isHit, XMVectorGreaterOrEqual(distance, XMVectorZero()));
+	isHit = XMVectorAndInt(isHit, XMVectorLessOrEqual(distance, XMVectorReplicate(maxDistance)));
+
+	return XMVectorSelect(g_XMInfinity, distance, isHit);
+}
+
+void TriangleBVH::Build(span<const XMFLOAT3> positions, span<const uint32_t> indices)
+{
+	Clear();
+
+	vector<BuildTriangle> triangles = {};
+	triangles.reserve(indices.size() / 3);
+	for (uint32_t triangle = 0; triangle < indices.size() / 3; ++triangle)
+	{
+		const XMVECTOR v0 = XMLoadFloat3(&positions[indices[triangle * 3]]);
+		const XMVECTOR v1 = XMLoadFloat3(&positions[indices[triangle * 3 + 1]]);
+		const XMVECTOR v2 = XMLoadFloat3(&positions[indices[triangle * 3 + 2]]);
+
+		BuildTriangle buildTriangle = { .triangle = triangle };
+		XMStoreFloat3(&buildTriangle.minimum, XMVectorMin(v0, XMVectorMin(v1, v2)));
+		XMStoreFloat3(&buildTriangle.maximum, XMVectorMax(v0, XMVectorMax(v1, v2)));
+		XMStoreFloat3(&buildTriangle.centroid, XMVectorScale(XMVectorAdd(v0, XMVectorAdd(v1, v2)), 1.0f / 3.0f));
+		triangles.push_back(buildTriangle);
+	}
+	if (triangles.empty()) return;
+
+	m_triangleCount = triangles.size();
+	// 잎 하나에 삼각형 하나일 때 노드 수 상한
+	m_nodes.reserve(triangles.size() * 2 - 1);
+	m_packets.reserve((triangles.size() + RAY_PACKET_WIDTH - 1) / RAY_PACKET_WIDTH);
+
+	BuildNode(triangles, 0, positions, indices);
+
+	m_nodes.shrink_to_fit();
+	m_packets.shrink_to_fit();
+}
+
+void TriangleBVH::Clear()
+{
+	m_nodes.clear();
+	m_packets.clear();
+	m_triangleCount = 0;
+}
+
+uint32_t TriangleBVH::BuildNode(span<BuildTriangle> triangles, size_t depth, span<const XMFLOAT3> positions, span<const uint32_t> indices)
+{
+	const uint32_t nodeIndex = static_cast<uint32_t>(m_nodes.size());
+	m_nodes.emplace_back();
+
+	XMVECTOR minimum = XMVectorReplicate(numeric_limits<float>::max());
+	XMVECTOR maximum = XMVectorReplicate(-numeric_limits<float>::max());
+	XMVECTOR centroidMinimum = minimum;
+	XMVECTOR centroidMaximum = maximum;
+	for (const BuildTriangle& triangle : triangles)
+	{
+		minimum = XMVectorMin(minimum, XMLoadFloat3(&triangle.minimum));
+		maximum = XMVectorMax(maximum, XMLoadFloat3(&triangle.maximum));
+		centroidMinimum = XMVectorMin(centroidMinimum, XMLoadFloat3(&triangle.centroid));
+		centroidMaximum = XMVectorMax(centroidMaximum, XMLoadFloat3(&triangle.centroid));
+	}
+	XMStoreFloat3(&m_nodes[nodeIndex].minimum, minimum);
+	XMStoreFloat3(&m_nodes[nodeIndex].maximum, maximum);
+
+	// 상자 겉넓이의 절반 // SAH 비용은 비율만 쓰므로 절반이어도 됨
+	const auto getHalfArea = [](const XMVECTOR& boxMinimum, const XMVECTOR& boxMaximum)
+		{
+			XMFLOAT3 size = {};
+			XMStoreFloat3(&size, XMVectorMax(XMVectorSubtract(boxMaximum, boxMinimum), XMVectorZero()));
+			return size.x * size.y + size.y * size.z + size.z * size.x;
+		};
+
+	// 삼각형 묶음 하나에 들어가면 나누지 않음
+	size_t splitCount = 0;
+	if (triangles.size() > RAY_PACKET_WIDTH && depth < MAX_DEPTH)
+	{
+		XMFLOAT3 centroidMinimumValue = {};
+		XMFLOAT3 centroidExtent = {};
+		XMStoreFloat3(&centroidMinimumValue, centroidMinimum);
+		XMStoreFloat3(&centroidExtent, XMVectorSubtract(centroidMaximum, centroidMinimum));
+
+		// 축마다 무게 중심을 구간에 나눠 담고 구간 경계마다 양쪽 비용 계산 // 비용 = 넓이 * 삼각형 수
+		float bestCost = numeric_limits<float>::max();
+		size_t bestAxis = 0;
+		size_t bestBin = 0;
+		const auto getBin = [&](const BuildTriangle& triangle, size_t axis)
+			{
+				const float offset = (&triangle.centroid.x)[axis] - (&centroidMinimumValue.x)[axis];
+				return min(BIN_COUNT - 1, static_cast<size_t>(offset * static_cast<float>(BIN_COUNT) / (&centroidExtent.x)[axis]));
+			};
+
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			if ((&centroidExtent.x)[axis] <= 0.0f) continue;
+
+			array<size_t, BIN_COUNT> binCounts = {};
+			array<XMVECTOR, BIN_COUNT> binMinimums = {};
+			array<XMVECTOR, BIN_COUNT> binMaximums = {};
+			binMinimums.fill(XMVectorReplicate(numeric_limits<float>::max()));
+			binMaximums.fill(XMVectorReplicate(-numeric_limits<float>::max()));
+			for (const BuildTriangle& triangle : triangles)
+			{
+				const size_t bin = getBin(triangle, axis);
+				binCounts[bin]++;
+				binMinimums[bin] = XMVectorMin(binMinimums[bin], XMLoadFloat3(&triangle.minimum));
+				binMaximums[bin] = XMVectorMax(binMaximums[bin], XMLoadFloat3(&triangle.maximum));
+			}
+
+			// 오른쪽부터 누적한 비용 // rightCosts[i]는 구간 i + 1부터 끝까지
+			array<float, BIN_COUNT - 1> rightCosts = {};
+			size_t rightCount = 0;
+			XMVECTOR rightMinimum = XMVectorReplicate(numeric_limits<float>::max());
+			XMVECTOR rightMaximum = XMVectorReplicate(-numeric_limits<float>::max());
+			for (size_t bin = BIN_COUNT - 1; bin > 0; --bin)
+			{
+				rightCount += binCounts[bin];
+				rightMinimum = XMVectorMin(rightMinimum, binMinimums[bin]);
+				rightMaximum = XMVectorMax(rightMaximum, binMaximums[bin]);
+				rightCosts[bin - 1] = rightCount == 0 ? 0.0f : getHalfArea(rightMinimum, rightMaximum) * static_cast<float>(rightCount);
+			}
+
+			size_t leftCount = 0;
+			XMVECTOR leftMinimum = XMVectorReplicate(numeric_limits<float>::max());
+			XMVECTOR leftMaximum = XMVectorReplicate(-numeric_limits<float>::max());
+			for (size_t bin = 0; bin < BIN_COUNT - 1; ++bin)
+			{
+				leftCount += binCounts[bin];
+				leftMinimum = XMVectorMin(leftMinimum, binMinimums[bin]);
+				leftMaximum = XMVectorMax(leftMaximum, binMaximums[bin]);
+				if (leftCount == 0 || leftCount == triangles.size()) continue;
+
+				const float cost = getHalfArea(leftMinimum, leftMaximum) * static_cast<float>(leftCount) + rightCosts[bin];
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestBin = bin;
+				}
+			}
+		}
+
+		// 노드 검사 비용을 삼각형 하나로 보고 잎으로 둘 때보다 싸거나 잎이 너무 크면 나눔
+		const float leafCost = getHalfArea(minimum, maximum) * static_cast<float>(triangles.size());
+		const float splitCost = getHalfArea(minimum, maximum) + bestCost;
+		if (bestCost < numeric_limits<float>::max() && (splitCost < leafCost || triangles.size() > MAX_LEAF_TRIANGLE_COUNT))
+		{
+			splitCount = static_cast<size_t>(partition(triangles.begin(), triangles.end(), [&](const BuildTriangle& triangle) { return getBin(triangle, bestAxis) <= bestBin; }) - triangles.begin());
+		}
+		else if (triangles.size() > MAX_LEAF_TRIANGLE_COUNT)
+		{
+			// 무게 중심이 모두 같음 // 아무렇게나 절반으로 나눔
+			splitCount = triangles.size() / 2;
+		}
+	}
+
+	if (splitCount == 0)
+	{
+		m_nodes[nodeIndex].offset = static_cast<uint32_t>(m_packets.size());
+		m_nodes[nodeIndex].packetCount = static_cast<uint32_t>((triangles.size() + RAY_PACKET_WIDTH - 1) / RAY_PACKET_WIDTH);
+		for (size_t i = 0; i < triangles.size(); ++i)
+		{
+			if (i % RAY_PACKET_WIDTH == 0) m_packets.emplace_back();
+
+			const uint32_t triangle = triangles[i].triangle;
+			m_packets.back().Set(i % RAY_PACKET_WIDTH, triangle, positions[indices[triangle * 3]], positions[indices[triangle * 3 + 1]], positions[indices[triangle * 3 + 2]]);
+		}
+
+		return nodeIndex;
+	}
+
+	// 왼쪽 자식은 바로 다음 노드
+	BuildNode(triangles.first(splitCount), depth + 1, positions, indices);
+	const uint32_t rightIndex = BuildNode(triangles.subspan(splitCount), depth + 1, positions, indices);
+	m_nodes[nodeIndex].offset = rightIndex;
+
+	return nodeIndex;
+}
+
+float TriangleBVH::IntersectNode(const Node& node, const XMVECTOR& origin, const XMVECTOR& inverseDirection, float maxDistance)
+{
+	const XMVECTOR t1 = XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&node.minimum), origin), inverseDirection);
+	const XMVECTOR t2 = XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&node.maximum), origin), inverseDirection);
+	const XMVECTOR nearT = XMVectorMin(t1, t2);
+	const XMVECTOR farT = XMVectorMax(t1, t2);
+
+	// 시작점 뒤쪽 구간은 무시
+	const XMVECTOR entry = XMVectorMax(XMVectorMax(XMVectorSplatX(nearT), XMVectorSplatY(nearT)), XMVectorMax(XMVectorSplatZ(nearT), XMVectorZero()));
+	const XMVECTOR exit = XMVectorMin(XMVectorMin(XMVectorSplatX(farT), XMVectorSplatY(farT)), XMVectorSplatZ(farT));
+
+	const float entryDistance = XMVectorGetX(entry);
+	if (entryDistance > XMVectorGetX(exit) || entryDistance > maxDistance) return numeric_limits<float>::infinity();
+
+	return entryDistance;
+}
+
+bool TriangleBVH::Raycast(const XMVECTOR& origin, const XMVECTOR& direction, float maxDistance, _Out_ Hit& hit) const
+{
+	hit = {};
+	if (m_nodes.empty()) return false;
+
+	const XMVECTOR inverseDirection = GetSafeReciprocal(direction);
+	float closestDistance = maxDistance;
+
+	// 노드 인덱스, 진입 거리 // 가까운 자식을 나중에 넣어 먼저 검사 // 더 가까운 충돌을 찾으면 먼 노드는 꺼낼 때 건너뜀
+	array<pair<uint32_t, float>, MAX_DEPTH + 2> stack = {};
+	size_t stackSize = 0;
+
+	const float rootDistance = IntersectNode(m_nodes[0], origin, inverseDirection, closestDistance);
+	if (isinf(rootDistance)) return false;
+	stack[stackSize++] = { 0, rootDistance };
+
+	while (stackSize > 0)
+	{
+		const auto [nodeIndex, entryDistance] = stack[--stackSize];
+		if (entryDistance > closestDistance) continue;
+
+		const Node& node = m_nodes[nodeIndex];
+		if (node.packetCount > 0)
+		{
+			for (uint32_t packetIndex = node.offset; packetIndex < node.offset + node.packetCount; ++packetIndex)
+			{
+				const TrianglePacket& packet = m_packets[packetIndex];
+				const XMVECTOR distances = packet.Intersect(origin, direction, closestDistance);
+				const float distance = GetMinimumLane(distances);
+				if (isinf(distance) || (hit.triangle != INVALID_TRIANGLE && distance >= closestDistance)) continue;
+
+				closestDistance = distance;
+				hit = { .distance = distance, .triangle = packet.triangles[countr_zero(GetLaneMask(XMVectorEqual(distances, XMVectorReplicate(distance))))] };
+			}
+			continue;
+		}
+
+		uint32_t nearIndex = nodeIndex + 1;
+		uint32_t farIndex = node.offset;
+		float nearDistance = IntersectNode(m_nodes[nearIndex], origin, inverseDirection, closestDistance);
+		float farDistance = IntersectNode(m_nodes[farIndex], origin, inverseDirection, closestDistance);
+		if (farDistance < nearDistance)
+		{
+			swap(nearIndex, farIndex);
+			swap(nearDistance, farDistance);
+		}
+
+		if (!isinf(farDistance)) stack[stackSize++] = { farIndex, farDistance };
+		if (!isinf(nearDistance)) stack[stackSize++] = { nearIndex, nearDistance };
+	}
+
+	return hit.triangle != INVALID_TRIANGLE;
+}
+
+BoundingBox TriangleBVH::GetBounds() const
+{
+	if (m_nodes.empty()) return BoundingBox({}, {});
+
+	BoundingBox bounds = {};
+	BoundingBox::CreateFromPoints(bounds, XMLoadFloat3(&m_nodes[0].minimum), XMLoadFloat3(&m_nodes[0].maximum));
+
+	return bounds;
+}
+
+void TriangleBVH::RunMicrobenchmarks()
+{
+	const auto getRaysPerSecond = [](size_t rayCount, double elapsed) { return static_cast<double>(rayCount) / (elapsed * 0.001); };
+
+	constexpr size_t RAY_COUNT = 20000;
+	constexpr size_t BRUTE_FORCE_TRIANGLE_TESTS = 50000000; // 전수 검사는 광선 수를 줄여 이 정도 검사만 수행
+	const array<const char*, 3> modelFileNames = { "temple.fbx", "greenhouse_wall.fbx", "greenhouse_wood.fbx" };
+
+	cout << "[삼각형 BVH 마이크로벤치마크] 레벨 모델 정밀 광선 검사" << endl;
+
+	for (const char* modelFileName : modelFileNames)
+	{
+		// 메쉬 콜라이더와 같은 입력 // 모델 로더로 읽고 ResourceManager::GetTriangleBVH처럼 삼각형을 합침
+		// 렌더러 초기화 전이므로 GPU 버퍼는 만들지 않음 // 모델 로더는 실패하면 종료하므로 파일부터 확인
+		if (!filesystem::exists(string("../Asset/Model/") + modelFileName))
+		{
+			cerr << "모델 " << modelFileName << " 을(를) 찾을 수 없습니다." << endl;
+			continue;
+		}
+		const Model* model = ResourceManager::GetInstance().LoadModel(modelFileName);
+		if (model->type != ModelType::Static) continue;
+
+		vector<XMFLOAT3> positions = {};
+		vector<uint32_t> indices = {};
+		ResourceManager::GatherTriangles(*model, positions, indices);
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0) continue;
+
+		TriangleBVH bvh;
+		const double buildElapsed = MeasureMilliseconds([&]() { bvh.Build(positions, indices); });
+
+		// 절반은 모델 밖 구면에서 안쪽으로 (사격), 절반은 상자 안에서 무작위 방향 (시야 확인)
+		const BoundingBox bounds = bvh.GetBounds();
+		const XMVECTOR center = XMLoadFloat3(&bounds.Center);
+		const XMVECTOR extents = XMLoadFloat3(&bounds.Extents);
+		const float radius = XMVectorGetX(XMVector3Length(extents)) * 1.5f;
+
+		mt19937 engine(MICROBENCHMARK_SEED);
+		uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		const auto getRandomInBounds = [&]() { return XMVectorMultiplyAdd(XMVectorSet(unit(engine), unit(engine), unit(engine), 0.0f), extents, center); };
+		const auto getRandomDirection = [&]() { return XMVector3Normalize(XMVectorSet(unit(engine), unit(engine), unit(engine), 0.0f)); };
+
+		vector<Ray> rays(RAY_COUNT);
+		for (size_t i = 0; i < RAY_COUNT; ++i)
+		{
+			if (i % 2 == 0)
+			{
+				rays[i].origin = XMVectorMultiplyAdd(getRandomDirection(), XMVectorReplicate(radius), center);
+				rays[i].direction = XMVector3Normalize(XMVectorSubtract(getRandomInBounds(), rays[i].origin));
+			}
+			else
+			{
+				rays[i].origin = getRandomInBounds();
+				rays[i].direction = getRandomDirection();
+			}
+		}
+
+		vector<float> bvhDistances(RAY_COUNT, numeric_limits<float>::max());
+		const double bvhElapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t i = 0; i < RAY_COUNT; ++i)
+				{
+					Hit hit = {};
+					if (bvh.Raycast(rays[i].origin, rays[i].direction, rays[i].maxDistance, hit)) bvhDistances[i] = hit.distance;
+				}
+			});
+
+		const size_t bruteForceRayCount = clamp(BRUTE_FORCE_TRIANGLE_TESTS / triangleCount, static_cast<size_t>(16), RAY_COUNT);
+		size_t mismatchCount = 0;
+		const double bruteForceElapsed = MeasureMilliseconds([&]()
+			{
+				for (size_t i = 0; i < bruteForceRayCount; ++i)
+				{
+					float closestDistance = numeric_limits<float>::max();
+					for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+					{
+						float distance = 0.0f;
+						const XMVECTOR v0 = XMLoadFloat3(&positions[indices[triangle * 3]]);
+						const XMVECTOR v1 = XMLoadFloat3(&positions[indices[triangle * 3 + 1]]);
+						const XMVECTOR v2 = XMLoadFloat3(&positions[indices[triangle * 3 + 2]]);
+						if (TriangleTests::Intersects(rays[i].origin, rays[i].direction, v0, v1, v2, distance) && distance < closestDistance) closestDistance = distance;
+					}
+					if (abs(closestDistance - bvhDistances[i]) > 0.001f * max(1.0f, closestDistance) && (closestDistance < numeric_limits<float>::max() || bvhDistances[i] < numeric_limits<float>::max())) mismatchCount++;
+				}
+			});
+
+		const size_t hitCount = static_cast<size_t>(count_if(bvhDistances.begin(), bvhDistances.end(), [](float distance) { return distance < numeric_limits<float>::max(); }));
+		const double bruteForceRaysPerSecond = getRaysPerSecond(bruteForceRayCount, bruteForceElapsed);
+		const double bvhRaysPerSecond = getRaysPerSecond(RAY_COUNT, bvhElapsed);
+		cout << modelFileName << ": 삼각형 " << triangleCount << "개, 노드 " << bvh.GetNodeCount() << "개, " << bvh.GetMemoryBytes() / 1024 << "KB, 빌드 " << buildElapsed << "ms, 충돌 " << hitCount * 100 / RAY_COUNT << "%" << endl;
+		cout << "  전수 검사 " << bruteForceRaysPerSecond / 1000000.0 << " M광선/초, BVH " << bvhRaysPerSecond / 1000000.0 << " M광선/초 (" << bvhRaysPerSecond / bruteForceRaysPerSecond << "배)" << endl;
+		if (mismatchCount > 0) cerr << modelFileName << " 결과 불일치: 광선 " << bruteForceRayCount << "개 중 " << mismatchCount << "개" << endl;
+	}
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include "RayPacket.h"
+
+// 정적 삼각형 메쉬 경계 볼륨 계층 // 레벨 지오메트리 정밀 광선 검사용
+// 구간 SAH로 한 번 빌드한 뒤 바꾸지 않음 // 빌드 후에는 읽기만 하므로 여러 스레드에서 동시에 검사해도 됨
+// 노드는 32바이트 깊이 우선 배치 // 왼쪽 자식은 바로 다음 노드
+// 잎의 삼각형은 4개씩 SoA로 묶어 광선 하나와 한 번에 검사 // 양면 검사
+// 좌표는 빌드에 넘긴 정점의 좌표계 (메쉬 로컬)
+class TriangleBVH
+{
+public:
+	static constexpr uint32_t INVALID_TRIANGLE = std::numeric_limits<uint32_t>::max();
+
+	// 광선 검사 결과
+	struct Hit
+	{
+		float distance = std::numeric_limits<float>::max();
+		uint32_t triangle = INVALID_TRIANGLE; // 빌드에 넘긴 인덱스 배열 기준 삼각형 번호
+	};
+
+private:
+	static constexpr size_t BIN_COUNT = 16; // 축마다 SAH 후보 구간 수
+	static constexpr size_t MAX_LEAF_TRIANGLE_COUNT = 16; // 나누는 비용이 더 커도 이보다 많으면 나눔
+	static constexpr size_t MAX_DEPTH = 48; // 이보다 깊으면 잎으로 만듦 // 검사 스택 크기
+
+	// 내부 노드는 offset이 오른쪽 자식, packetCount가 0 // 잎은 offset이 첫 삼각형 묶음, packetCount가 묶음 수
+	struct Node
+	{
+		DirectX::XMFLOAT3 minimum = {};
+		uint32_t offset = 0;
+		DirectX::XMFLOAT3 maximum = {};
+		uint32_t packetCount = 0;
+	};
+	static_assert(sizeof(Node) == 32);
+
+	// 삼각형 4개 SoA // 꼭짓점 하나와 그 꼭짓점에서 나가는 두 모서리 // 채우지 않은 레인은 모서리가 0이라 항상 충돌 아님
+	struct TrianglePacket
+	{
+		std::array<DirectX::XMVECTOR, 3> vertex = {};
+		std::array<DirectX::XMVECTOR, 3> edge1 = {};
+		std::array<DirectX::XMVECTOR, 3> edge2 = {};
+		std::array<uint32_t, RAY_PACKET_WIDTH> triangles = { INVALID_TRIANGLE, INVALID_TRIANGLE, INVALID_TRIANGLE, INVALID_TRIANGLE };
+
+		void Set(size_t lane, uint32_t triangle, const DirectX::XMFLOAT3& v0, const DirectX::XMFLOAT3& v1, const DirectX::XMFLOAT3& v2);
+		// 레인의 세 꼭짓점
+		void Get(size_t lane, _Out_ DirectX::XMVECTOR& v0, _Out_ DirectX::XMVECTOR& v1, _Out_ DirectX::XMVECTOR& v2) const;
+		// 광선 하나와 삼각형 4개 // 레인별 거리, 충돌 아니면 무한대 // 방향은 정규화하지 않아도 되며 거리는 방향 길이 단위
+		DirectX::XMVECTOR Intersect(DirectX::FXMVECTOR origin, DirectX::FXMVECTOR direction, float maxDistance) const;
+	};
+
+	std::vector<Node> m_nodes = {};
+	std::vector<TrianglePacket> m_packets = {};
+	size_t m_triangleCount = 0;
+
+public:
+	TriangleBVH() = default;
+	~TriangleBVH() = default;
+	TriangleBVH(const TriangleBVH&) = default;
+	TriangleBVH& operator=(const TriangleBVH&) = default;
+	TriangleBVH(TriangleBVH&&) = default;
+	TriangleBVH& operator=(TriangleBVH&&) = default;
+
+	// 삼각형 목록으로 빌드 // 기존 계층은 버림 // indices는 3개씩 삼각형 하나
+	void Build(std::span<const DirectX::XMFLOAT3> positions, std::span<const uint32_t> indices);
+	void Clear();
+
+	// 가장 가까운 충돌 // maxDistance보다 먼 충돌은 무시 // 충돌이 있으면 hit 갱신 후 true
+	// 방향은 정규화하지 않아도 됨 // 거리는 방향 길이 단위이므로 월드 광선을 로컬로 옮겨 넘기면 월드 거리 그대로
+	bool Raycast(const DirectX::XMVECTOR& origin, const DirectX::XMVECTOR& direction, float maxDistance, _Out_ Hit& hit) const;
+	// 경계 상자가 box와 겹치는 삼각형마다 callback(v0, v1, v2) 호출 // 꼭짓점은 XMVECTOR
+	template<typename F>
+	void QueryTriangles(const DirectX::BoundingBox& box, F&& callback) const;
+
+	bool IsEmpty() const { return m_nodes.empty(); }
+	// 모든 삼각형을 감싸는 상자 // 비었으면 원점
+	DirectX::BoundingBox GetBounds() const;
+	size_t GetTriangleCount() const { return m_triangleCount; }
+	size_t GetNodeCount() const { return m_nodes.size(); }
+	size_t GetMemoryBytes() const { return m_nodes.size() * sizeof(Node) + m_packets.size() * sizeof(TrianglePacket); }
+
+	// 배포 레벨 모델마다 빌드 시간과 전수 검사, 계층 검사의 초당 광선 수 비교 결과를 콘솔에 출력
+	static void RunMicrobenchmarks();
+
+private:
+	struct BuildTriangle
+	{
+		DirectX::XMFLOAT3 minimum = {};
+		DirectX::XMFLOAT3 maximum = {};
+		DirectX::XMFLOAT3 centroid = {};
+		uint32_t triangle = 0;
+	};
+
+	// triangles[first, first + count)로 노드 하나를 만들고 자식을 깊이 우선으로 이어 빌드 후 노드 인덱스 반환
+	uint32_t BuildNode(std::span<BuildTriangle> triangles, size_t depth, std::span<const DirectX::XMFLOAT3> positions, std::span<const uint32_t> indices);
+
+	// 노드 상자 진입 거리 // 지나지 않거나 maxDistance보다 멀면 무한대
+	static float IntersectNode(const Node& node, const DirectX::XMVECTOR& origin, const DirectX::XMVECTOR& inverseDirection, float maxDistance);
+};
+
+template<typename F>
+void TriangleBVH::QueryTriangles(const DirectX::BoundingBox& box, F&& callback) const
+{
+	if (m_nodes.empty()) return;
+
+	const DirectX::XMVECTOR boxMinimum = DirectX::XMVectorSubtract(DirectX::XMLoadFloat3(&box.Center), DirectX::XMLoadFloat3(&box.Extents));
+	const DirectX::XMVECTOR boxMaximum = DirectX::XMVectorAdd(DirectX::XMLoadFloat3(&box.Center), DirectX::XMLoadFloat3(&box.Extents));
+	const auto overlaps = [&](const DirectX::XMVECTOR& minimum, const DirectX::XMVECTOR& maximum) { return DirectX::XMVector3LessOrEqual(minimum, boxMaximum) && DirectX::XMVector3GreaterOrEqual(maximum, boxMinimum); };
+
+	std::array<uint32_t, MAX_DEPTH + 2> stack = {};
+	size_t stackSize = 0;
+	stack[stackSize++] = 0;
+	while (stackSize > 0)
+	{
+		const uint32_t nodeIndex = stack[--stackSize];
+		const Node& node = m_nodes[nodeIndex];
+		if (!overlaps(DirectX::XMLoadFloat3(&node.minimum), DirectX::XMLoadFloat3(&node.maximum))) continue;
+
+		if (node.packetCount == 0)
+		{
+			stack[stackSize++] = node.offset;
+			stack[stackSize++] = nodeIndex + 1;
+			continue;
+		}
+
+		for (uint32_t packetIndex = node.offset; packetIndex < node.offset + node.packetCount; ++packetIndex)
+		{
+			const TrianglePacket& packet = m_packets[packetIndex];
+			for (size_t lane = 0; lane < RAY_PACKET_WIDTH; ++lane)
+			{
+				if (packet.triangles[lane] == INVALID_TRIANGLE) continue;
+
+				DirectX::XMVECTOR v0 = {};
+				DirectX::XMVECTOR v1 = {};
+				DirectX::XMVECTOR v2 = {};
+				packet.Get(lane, v0, v1, v2);
+				if (overlaps(DirectX::XMVectorMin(v0, DirectX::XMVectorMin(v1, v2)), DirectX::XMVectorMax(v0, DirectX::XMVectorMax(v1, v2)))) callback(v0, v1, v2);
+			}
+		}
+	}
+}
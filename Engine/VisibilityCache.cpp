@@ -0,0 +1,272 @@
+#include "stdafx.h"
+#include "VisibilityCache.h"
+
+#include "DynamicAABBTree.h"
+#include "Microbenchmark.h"
+
+#include "Telemetry.h"
+
+using namespace std;
+using namespace DirectX;
+
+REGISTER_MICROBENCHMARK(VisibilityCache, VisibilityCache::RunMicrobenchmarks)
+
+void VisibilityCache::BeginQuery(const BoundingFrustum& frustum)
+{
+	array<XMVECTOR, PLANE_COUNT> planes = {};
+	frustum.GetPlanes(&planes[0], &planes[1], &planes[2], &planes[3], &planes[4], &planes[5]);
+	for (size_t i = 0; i < PLANE_COUNT; ++i) XMStoreFloat4(&m_planes[i], planes[i]);
+
+	if (m_shouldRebase)
+	{
+		m_referencePlanes = m_planes;
+		m_referenceOrigin = frustum.Origin;
+		m_referenceIndex++;
+		m_shouldRebase = false;
+		m_statistics.rebaseCount++;
+	}
+
+	// 평면 i에서 점 p까지 거리 변화 |Δn·(p - o) + Δd(o)| <= |Δn|·|p - o| + |Δd(o)| // o는 기준 원점
+	const XMVECTOR origin = XMLoadFloat3(&m_referenceOrigin);
+	XMVECTOR normalDrift = XMVectorZero();
+	XMVECTOR offsetDrift = XMVectorZero();
+	for (size_t i = 0; i < PLANE_COUNT; ++i)
+	{
+		const XMVECTOR reference = XMLoadFloat4(&m_referencePlanes[i]);
+		normalDrift = XMVectorMax(normalDrift, XMVector3Length(XMVectorSubtract(planes[i], reference)));
+		offsetDrift = XMVectorMax(offsetDrift, XMVectorAbs(XMVectorSubtract(XMPlaneDotCoord(planes[i], origin), XMPlaneDotCoord(reference, origin))));
+	}
+	m_normalDrift = XMVectorGetX(normalDrift);
+	m_offsetDrift = XMVectorGetX(offsetDrift);
+
+	m_queryIndex++;
+	m_cursor = 0;
+	m_queryObjectCount = 0;
+	m_queryHitCount = 0;
+	m_queryDriftMissCount = 0;
+	m_queryTouchedCount = 0;
+}
+
+void VisibilityCache::EndQuery()
+{
+	if (m_queryTouchedCount < m_entries.size())
+	{
+		erase_if(m_entries, [&](const Entry& entry) { return entry.queryIndex != m_queryIndex; });
+
+		m_indices.clear();
+		for (uint32_t i = 0; i < m_entries.size(); ++i) m_indices.emplace(m_entries[i].key, i);
+	}
+
+	// 절두체가 기준에서 많이 벗어나 다시 검사하는 대상이 늘었으면 다음 조회부터 현재 절두체 기준으로 여유를 다시 잼
+	if (static_cast<float>(m_queryDriftMissCount) > static_cast<float>(m_queryObjectCount) * REBASE_TEST_RATIO) m_shouldRebase = true;
+
+	m_statistics.queryCount++;
+	m_statistics.objectCount += m_queryObjectCount;
+	m_statistics.hitCount += m_queryHitCount;
+
+	TELEMETRY_COUNT("Visibility.Queries", 1);
+	TELEMETRY_COUNT("Visibility.Objects", m_queryObjectCount);
+	TELEMETRY_COUNT("Visibility.CacheHits", m_queryHitCount);
+}
+
+void VisibilityCache::Clear()
+{
+	m_entries.clear();
+	m_indices.clear();
+	m_shouldRebase = true;
+}
+
+bool VisibilityCache::Lookup(const void* key, const BoundingSphere& bounds, uint32_t version, _Out_ Entry*& entry)
+{
+	m_queryObjectCount++;
+
+	if (m_cursor >= m_entries.size() || m_entries[m_cursor].key != key)
+	{
+		const auto [it, isInserted] = m_indices.try_emplace(key, static_cast<uint32_t>(m_entries.size()));
+		if (isInserted) m_entries.push_back({ .key = key });
+		m_cursor = it->second;
+	}
+	entry = &m_entries[m_cursor++];
+
+	if (entry->queryIndex != m_queryIndex)
+	{
+		entry->queryIndex = m_queryIndex;
+		m_queryTouchedCount++;
+	}
+
+	if (entry->referenceIndex != m_referenceIndex) return false;
+	if (entry->bounds.Radius != bounds.Radius || !XMVector3Equal(XMLoadFloat3(&entry->bounds.Center), XMLoadFloat3(&bounds.Center))) return false;
+	if (entry->isExact && entry->version != version) return false;
+	if (entry->margin < m_normalDrift * entry->referenceDistance + m_offsetDrift)
+	{
+		m_queryDriftMissCount++;
+		return false;
+	}
+
+	m_queryHitCount++;
+
+	return true;
+}
+
+ContainmentType VisibilityCache::Retest(_Inout_ Entry& entry, const BoundingSphere& bounds, uint32_t version) const
+{
+	const XMVECTOR center = XMLoadFloat3(&bounds.Center);
+
+	// 평면은 바깥을 향하므로 모든 평면 거리가 -반지름 이하면 안, 한 평면이라도 반지름 이상이면 밖
+	float insideMargin = numeric_limits<float>::max();
+	float outsideMargin = -numeric_limits<float>::max();
+	for (const XMFLOAT4& plane : m_planes)
+	{
+		const float distance = XMVectorGetX(XMPlaneDotCoord(XMLoadFloat4(&plane), center));
+		insideMargin = min(insideMargin, -distance - bounds.Radius);
+		outsideMargin = max(outsideMargin, distance - bounds.Radius);
+	}
+
+	ContainmentType containment = INTERSECTS;
+	float margin = 0.0f;
+	if (outsideMargin > 0.0f)
+	{
+		containment = DISJOINT;
+		margin = outsideMargin;
+	}
+	else if (insideMargin >= 0.0f)
+	{
+		containment = CONTAINS;
+		margin = insideMargin;
+	}
+
+	// 여유는 현재 절두체에서 잰 값 // 기준 절두체에서 현재까지 평면이 움직였을 수 있는 거리만큼 줄여 기준 절두체 대비 여유로 기록
+	const float referenceDistance = XMVectorGetX(XMVector3Length(XMVectorSubtract(center, XMLoadFloat3(&m_referenceOrigin))));
+	entry.bounds = bounds;
+	entry.version = version;
+	entry.margin = margin - (m_normalDrift * referenceDistance + m_offsetDrift);
+	entry.referenceDistance = referenceDistance;
+	entry.referenceIndex = m_referenceIndex;
+	entry.isExact = containment == INTERSECTS;
+
+	return containment;
+}
+
+void VisibilityCache::RunMicrobenchmarks()
+{
+	constexpr size_t FRAME_COUNT = 1200;
+	constexpr float DELTA_TIME = 1.0f / 60.0f;
+	constexpr float WORLD_HALF_SIZE = 100.0f;
+	constexpr size_t PROP_COUNT = 3000;
+	constexpr size_t ENEMY_COUNT = 300;
+	constexpr size_t SPAWN_POINT_COUNT = 50;
+	constexpr float WALK_SPEED = 5.0f; // 플레이어 이동 속도
+	constexpr float ENEMY_SPEED = 4.0f;
+	constexpr float FAT_MARGIN = DynamicAABBTree::DEFAULT_FAT_MARGIN; // 적 경계는 브로드페이즈 넓힌 상자처럼 벗어날 때만 갱신
+
+	mt19937 engine(MICROBENCHMARK_SEED);
+	uniform_real_distribution<float> position(-WORLD_HALF_SIZE, WORLD_HALF_SIZE);
+	uniform_real_distribution<float> propRadius(0.5f, 3.0f);
+	uniform_real_distribution<float> angle(-XM_PI, XM_PI);
+
+	// 정적 소품, 생성 지점 // 경계가 바뀌지 않음
+	vector<BoundingSphere> props(PROP_COUNT);
+	for (BoundingSphere& prop : props)
+	{
+		const float radius = propRadius(engine);
+		prop = BoundingSphere({ position(engine), radius, position(engine) }, radius);
+	}
+	vector<BoundingSphere> spawnPoints(SPAWN_POINT_COUNT);
+	for (BoundingSphere& spawnPoint : spawnPoints) spawnPoint = BoundingSphere({ position(engine), 0.0f, position(engine) }, 0.0f);
+
+	// 적 // 프레임마다 조금씩 방향을 틀며 걷고 넓힌 구를 벗어날 때만 경계 갱신 // 버전은 프레임마다 바뀜
+	struct EnemyFrame
+	{
+		BoundingSphere exact = {};
+		BoundingSphere fat = {};
+	};
+	vector<EnemyFrame> enemyFrames(FRAME_COUNT * ENEMY_COUNT);
+	{
+		uniform_real_distribution<float> turn(-2.0f, 2.0f);
+		for (size_t i = 0; i < ENEMY_COUNT; ++i)
+		{
+			XMFLOAT3 center = { position(engine), 1.0f, position(engine) };
+			float heading = angle(engine);
+			BoundingSphere fat(center, 1.0f + FAT_MARGIN);
+			for (size_t frame = 0; frame < FRAME_COUNT; ++frame)
+			{
+				heading += turn(engine) * DELTA_TIME;
+				center.x = clamp(center.x + sin(heading) * ENEMY_SPEED * DELTA_TIME, -WORLD_HALF_SIZE, WORLD_HALF_SIZE);
+				center.z = clamp(center.z + cos(heading) * ENEMY_SPEED * DELTA_TIME, -WORLD_HALF_SIZE, WORLD_HALF_SIZE);
+
+				const BoundingSphere exact(center, 1.0f);
+				if (fat.Contains(exact) != CONTAINS) fat = BoundingSphere(center, 1.0f + FAT_MARGIN);
+				enemyFrames[frame * ENEMY_COUNT + i] = { .exact = exact, .fat = fat };
+			}
+		}
+	}
+
+	// 카메라 // 앞으로 걸으며 좌우로 천천히 둘러보고 3초마다 0.25초 동안 120도 돌아봄
+	vector<BoundingFrustum> frustums(FRAME_COUNT);
+	{
+		const BoundingFrustum localFrustum(XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.0f / 9.0f, 0.1f, 250.0f));
+		XMVECTOR cameraPosition = XMVectorSet(-WORLD_HALF_SIZE * 0.5f, 1.6f, -WORLD_HALF_SIZE * 0.5f, 1.0f);
+		float baseYaw = XM_PIDIV4;
+		for (size_t frame = 0; frame < FRAME_COUNT; ++frame)
+		{
+			const float time = static_cast<float>(frame) * DELTA_TIME;
+			if (fmod(time, 3.0f) > 2.75f) baseYaw += XMConvertToRadians(120.0f) / 0.25f * DELTA_TIME;
+			const float yaw = baseYaw + 0.6f * sin(0.7f * time);
+			const float pitch = 0.1f * sin(1.3f * time);
+
+			const XMVECTOR forward = XMVectorSet(sin(yaw), 0.0f, cos(yaw), 0.0f);
+			cameraPosition = XMVectorClamp(XMVectorMultiplyAdd(forward, XMVectorReplicate(WALK_SPEED * DELTA_TIME), cameraPosition), XMVectorReplicate(-WORLD_HALF_SIZE), XMVectorReplicate(WORLD_HALF_SIZE));
+			localFrustum.Transform(frustums[frame], XMMatrixRotationRollPitchYaw(pitch, yaw, 0.0f) * XMMatrixTranslationFromVector(cameraPosition));
+		}
+	}
+
+	cout << "[가시성 캐시 마이크로벤치마크] " << FRAME_COUNT << "프레임, 정적 소품 " << PROP_COUNT << "개, 움직이는 적 " << ENEMY_COUNT << "개, 생성 지점 " << SPAWN_POINT_COUNT << "개" << endl;
+
+	// 조회하는 쪽마다 캐시 하나 // 키는 대상 번호 // 전수 검사와 결과가 다르면 틀린 것
+	size_t mismatchCount = 0;
+	size_t visibleCount = 0;
+	array<VisibilityCache, 3> caches = {};
+	const auto runFrame = [&](size_t frame, bool isCached, bool isVerified)
+		{
+			const BoundingFrustum& frustum = frustums[frame];
+			const auto query = [&](VisibilityCache& cache, const auto& getBounds, const auto& getExact, size_t count, uint32_t version)
+				{
+					if (isCached) cache.BeginQuery(frustum);
+					for (size_t i = 0; i < count; ++i)
+					{
+						const BoundingSphere& exact = getExact(i);
+						const auto exactTest = [&]() { return frustum.Intersects(exact); };
+						const bool isVisible = isCached ? cache.IsVisible(reinterpret_cast<const void*>(i), getBounds(i), version, exactTest) : exactTest();
+						visibleCount += isVisible;
+						if (isVerified && isVisible != exactTest()) mismatchCount++;
+					}
+					if (isCached) cache.EndQuery();
+				};
+
+			const span<const EnemyFrame> enemies(&enemyFrames[frame * ENEMY_COUNT], ENEMY_COUNT);
+			query(caches[0], [&](size_t i) -> const BoundingSphere& { return props[i]; }, [&](size_t i) -> const BoundingSphere& { return props[i]; }, PROP_COUNT, 0);
+			query(caches[1], [&](size_t i) -> const BoundingSphere& { return enemies[i].fat; }, [&](size_t i) -> const BoundingSphere& { return enemies[i].exact; }, ENEMY_COUNT, static_cast<uint32_t>(frame) + 1);
+			query(caches[2], [&](size_t i) -> const BoundingSphere& { return spawnPoints[i]; }, [&](size_t i) -> const BoundingSphere& { return spawnPoints[i]; }, SPAWN_POINT_COUNT, 0);
+		};
+
+	const double bruteForceElapsed = MeasureMilliseconds([&]() { for (size_t frame = 0; frame < FRAME_COUNT; ++frame) runFrame(frame, false, false); });
+	const size_t bruteForceVisibleCount = visibleCount;
+	visibleCount = 0;
+	const double cachedElapsed = MeasureMilliseconds([&]() { for (size_t frame = 0; frame < FRAME_COUNT; ++frame) runFrame(frame, true, false); });
+	const size_t cachedVisibleCount = visibleCount;
+
+	// 통계는 시간 잰 조회만 // 검증은 새 캐시로 다시 돌림
+	const array<Statistics, 3> statistics = { caches[0].GetStatistics(), caches[1].GetStatistics(), caches[2].GetStatistics() };
+	caches = {};
+	for (size_t frame = 0; frame < FRAME_COUNT; ++frame) runFrame(frame, true, true);
+
+	cout << "프레임당: 전수 " << bruteForceElapsed * 1000.0 / FRAME_COUNT << "us, 캐시 " << cachedElapsed * 1000.0 / FRAME_COUNT << "us (" << bruteForceElapsed / cachedElapsed << "배)" << endl;
+	constexpr array<const char*, 3> NAMES = { "정적 소품", "움직이는 적", "생성 지점" };
+	for (size_t i = 0; i < statistics.size(); ++i)
+	{
+		const Statistics& statistic = statistics[i];
+		cout << "  " << NAMES[i] << ": 적중률 " << statistic.GetHitRate() * 100.0 << "%, 프레임당 다시 검사 " << static_cast<double>(statistic.objectCount - statistic.hitCount) / FRAME_COUNT
+			<< "개, 정밀 검사 " << static_cast<double>(statistic.exactTestCount) / FRAME_COUNT << "개, 기준 절두체 이동 " << statistic.rebaseCount << "회" << endl;
+	}
+	cout << "보이는 대상 합: 전수 " << bruteForceVisibleCount << ", 캐시 " << cachedVisibleCount << ", 전수 검사와 다른 결과 " << mismatchCount << "개" << endl;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+// 절두체 가시성 조회 캐시 // 조회하는 쪽마다 하나씩 두고 프레임마다 같은 대상 묶음을 조회
+// 대상마다 감싸는 구와 마지막 결과, 그때 절두체 평면에서 떨어진 거리(여유)를 기억
+// 절두체는 기준 절두체에서 얼마나 벗어났는지만 계산 // 평면이 움직인 거리가 여유보다 작으면 구가 여전히 완전히 안이나 밖이므로 다시 검사하지 않음
+// 구가 평면에 걸치면 호출자의 정밀 검사 결과를 쓰고 절두체와 버전이 그대로일 때만 재사용
+// 절두체가 벗어나 다시 검사한 대상이 절반을 넘으면 다음 조회에서 기준 절두체를 현재 절두체로 옮김
+// 항목은 조회 순서대로 저장 // 지난 조회와 같은 순서로 조회하면 해시 검색 없이 다음 항목을 씀
+// 스레드 안전하지 않음
+class VisibilityCache
+{
+public:
+	// 누적 통계
+	struct Statistics
+	{
+		size_t queryCount = 0;
+		size_t objectCount = 0; // 조회한 대상 수 합
+		size_t hitCount = 0; // 다시 검사하지 않은 대상 수 합
+		size_t exactTestCount = 0; // 정밀 검사 호출 수 합
+		size_t rebaseCount = 0; // 기준 절두체를 옮긴 횟수
+
+		double GetHitRate() const { return objectCount > 0 ? static_cast<double>(hitCount) / objectCount : 0.0; }
+	};
+
+private:
+	static constexpr size_t PLANE_COUNT = 6;
+	static constexpr float REBASE_TEST_RATIO = 0.5f; // 한 조회에서 절두체가 벗어나 다시 검사한 비율이 이보다 크면 기준 절두체를 옮김
+
+	struct Entry
+	{
+		const void* key = nullptr;
+		DirectX::BoundingSphere bounds = {};
+		uint32_t version = 0;
+		float margin = 0.0f; // 기준 절두체 평면이 이만큼 움직이기 전까지 결과 유지 // 음수면 다시 검사
+		float referenceDistance = 0.0f; // 구 중심과 기준 절두체 원점 사이 거리
+		uint32_t referenceIndex = 0; // 여유를 잰 기준 절두체 번호 // 0이면 검사한 적 없음
+		uint32_t queryIndex = 0; // 마지막으로 조회된 조회 번호
+		bool isVisible = false;
+		bool isExact = false; // 평면에 걸쳐 정밀 검사로 얻은 결과인지 여부
+	};
+
+	std::vector<Entry> m_entries = {};
+	std::unordered_map<const void*, uint32_t> m_indices = {}; // 키, m_entries 내 인덱스
+
+	std::array<DirectX::XMFLOAT4, PLANE_COUNT> m_referencePlanes = {}; // 바깥을 향하는 정규화된 평면
+	DirectX::XMFLOAT3 m_referenceOrigin = {};
+	uint32_t m_referenceIndex = 0; // 기준 절두체를 옮길 때마다 증가
+	bool m_shouldRebase = true;
+
+	// 현재 조회
+	std::array<DirectX::XMFLOAT4, PLANE_COUNT> m_planes = {};
+	float m_normalDrift = 0.0f; // 기준 평면 대비 법선 변화량 최댓값 // 원점에서 멀어질수록 평면 이동 거리에 곱해짐
+	float m_offsetDrift = 0.0f; // 기준 원점에서 잰 평면 거리 변화량 최댓값
+	uint32_t m_queryIndex = 0;
+	size_t m_cursor = 0; // 다음으로 조회될 것으로 기대하는 항목 인덱스
+	size_t m_queryObjectCount = 0;
+	size_t m_queryHitCount = 0;
+	size_t m_queryDriftMissCount = 0; // 여유보다 절두체가 더 움직여 다시 검사한 대상 수
+	size_t m_queryTouchedCount = 0; // 이번 조회에서 처음 조회된 항목 수 // 항목 수보다 적으면 조회되지 않은 항목 제거
+
+	Statistics m_statistics = {};
+
+public:
+	VisibilityCache() = default;
+	~VisibilityCache() = default;
+	VisibilityCache(const VisibilityCache&) = default;
+	VisibilityCache& operator=(const VisibilityCache&) = default;
+	VisibilityCache(VisibilityCache&&) = default;
+	VisibilityCache& operator=(VisibilityCache&&) = default;
+
+	// 조회 시작 // 월드 좌표계 절두체
+	void BeginQuery(const DirectX::BoundingFrustum& frustum);
+	// 대상 가시성 // key는 대상마다 고유 // bounds는 대상을 감싸는 월드 좌표계 구
+	// 해제된 대상의 주소를 다른 대상이 재사용해도 bounds가 다르면 다시 검사하지만, bounds와 version까지 같으면 이전 결과를 씀
+	// 대상을 해제할 수 있으면 해제된 뒤 첫 조회 전에 Clear하거나, 생성마다 달라지는 version을 함께 넘김
+	// version은 bounds 안에서 대상 모양이 바뀌면 달라지는 값 // 구가 평면에 걸칠 때만 비교
+	// 구가 평면에 걸치고 캐시가 무효면 exactTest()로 정밀 검사
+	template<typename F>
+	bool IsVisible(const void* key, const DirectX::BoundingSphere& bounds, uint32_t version, F&& exactTest);
+	// 조회 끝 // 이번 조회에서 조회되지 않은 대상은 캐시에서 제거
+	void EndQuery();
+
+	void Clear();
+
+	const Statistics& GetStatistics() const { return m_statistics; }
+	void ResetStatistics() { m_statistics = {}; }
+
+	// 걷고 둘러보는 카메라로 정적 물체, 움직이는 적, 생성 지점을 매 프레임 조회할 때 전수 검사와 캐시 조회 비교 결과를 콘솔에 출력
+	static void RunMicrobenchmarks();
+
+private:
+	// 캐시가 유효하면 entry를 기록하고 true
+	bool Lookup(const void* key, const DirectX::BoundingSphere& bounds, uint32_t version, _Out_ Entry*& entry);
+	// 현재 절두체로 구를 다시 분류하고 항목 갱신 // 걸치면 INTERSECTS
+	DirectX::ContainmentType Retest(_Inout_ Entry& entry, const DirectX::BoundingSphere& bounds, uint32_t version) const;
+};
+
+template<typename F>
+bool VisibilityCache::IsVisible(const void* key, const DirectX::BoundingSphere& bounds, uint32_t version, F&& exactTest)
+{
+	Entry* entry = nullptr;
+	if (Lookup(key, bounds, version, entry)) return entry->isVisible;
+
+	const DirectX::ContainmentType containment = Retest(*entry, bounds, version);
+	if (containment == DirectX::INTERSECTS)
+	{
+		entry->isVisible = exactTest();
+		m_statistics.exactTestCount++;
+	}
+	else entry->isVisible = containment == DirectX::CONTAINS;
+
+	return entry->isVisible;
+}
@@ -4,6 +4,8 @@
 #include "Renderer.h"
 #include "InputManager.h"
 #include "ResourceManager.h"
+#include "RenderBackend.h"
+#include "InputRecorder.h"
 
 using namespace std;
 
@@ -123,7 +125,8 @@ void WindowManager::Initialize(const wchar_t* windowTitle, int width, int height
 	// 인풋매니저 초기화
 	InputManager::GetInstance().Initialize(m_hWnd);
 
-	ShowWindow(m_hWnd, SW_SHOW);
+	// 헤드리스 모드는 창을 표시하지 않음 // 입력, ImGui용 핸들만 사용
+	if (!RenderBackend::GetInstance().IsHeadless()) ShowWindow(m_hWnd, SW_SHOW);
 
 	ResourceManager& rm = ResourceManager::GetInstance();
 	rm.LoadLUTTexture();
@@ -146,6 +149,9 @@ bool WindowManager::ProcessMessages()
 		DispatchMessage(&msg);
 	}
 
+	// 재생 중이면 기록된 이번 프레임 입력 적용
+	InputRecorder::GetInstance().BeginFrame();
+
 	#ifdef _DEBUG
 	// ImGui Win32 새 프레임 시작
 	ImGui_ImplWin32_NewFrame();
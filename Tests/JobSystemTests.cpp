@@ -0,0 +1,174 @@
+#include "stdafx.h"
+#include "JobSystem.h"
+
+using namespace std;
+
+// 작업 시스템 테스트 // 작업자 4개로 초기화한 뒤 각 테스트를 메인 스레드에서 차례로 실행
+// 교착은 ctest 제한 시간으로, 데이터 경쟁은 AURORA_TESTS_TSAN 빌드로 검출
+
+namespace
+{
+	constexpr size_t WORKER_COUNT = 4;
+
+	atomic<size_t> s_failureCount = 0; // 작업자 스레드에서도 기록
+
+	// 조건이 거짓이면 실패 기록 후 계속 진행
+	#define CHECK(condition) do { if (!(condition)) { cerr << "실패: " << __FILE__ << ":" << __LINE__ << " " << #condition << endl; ++s_failureCount; } } while (false)
+
+	// 바깥 병렬 반복의 각 구간 안에서 다시 병렬 반복 // 작업자 안의 ParallelFor가 내부 구간을 기다리는 동안 다른 작업을 대신 실행해야 함
+	void TestNestedParallelFor(JobSystem& jobSystem)
+	{
+		constexpr size_t OUTER_COUNT = 64;
+		constexpr size_t INNER_COUNT = 1000;
+
+		vector<atomic<uint32_t>> innerCounts(OUTER_COUNT);
+		jobSystem.ParallelFor(OUTER_COUNT, 1, [&](size_t i)
+			{
+				jobSystem.ParallelFor(INNER_COUNT, 0, [&](size_t) { innerCounts[i].fetch_add(1, memory_order_relaxed); });
+			});
+
+		for (const atomic<uint32_t>& innerCount : innerCounts) CHECK(innerCount.load() == INNER_COUNT);
+
+		// 예약된 작업 안에서 시작한 병렬 반복
+		constexpr size_t JOB_COUNT = 32;
+		atomic<uint32_t> total = 0;
+		JobCounter counter;
+		for (size_t i = 0; i < JOB_COUNT; ++i) jobSystem.Schedule([&]() { jobSystem.ParallelFor(INNER_COUNT, 0, [&](size_t) { total.fetch_add(1, memory_order_relaxed); }); }, &counter);
+		jobSystem.Wait(counter);
+
+		CHECK(total.load() == JOB_COUNT * INNER_COUNT);
+	}
+
+	// 연속 작업 사슬은 예약 순서대로 하나씩 실행 // 여러 작업에 걸린 연속 작업은 모두 끝난 뒤 실행
+	void TestScheduleAfterChain(JobSystem& jobSystem)
+	{
+		constexpr size_t CHAIN_LENGTH = 256;
+
+		vector<unique_ptr<JobCounter>> links(CHAIN_LENGTH);
+		for (unique_ptr<JobCounter>& link : links) link = make_unique<JobCounter>();
+
+		atomic<size_t> nextIndex = 0;
+		const auto step = [&](size_t index) { CHECK(nextIndex.fetch_add(1) == index); };
+
+		// 연결하는 동안 앞 작업이 이미 끝났을 수도 있음 // 그래도 각 작업은 앞 작업이 끝난 뒤에만 실행
+		jobSystem.Schedule([&]() { step(0); }, links[0].get());
+		for (size_t i = 1; i < CHAIN_LENGTH; ++i) jobSystem.ScheduleAfter(*links[i - 1], [&, i]() { step(i); }, links[i].get());
+
+		jobSystem.Wait(*links.back());
+		CHECK(nextIndex.load() == CHAIN_LENGTH);
+
+		// 여러 작업에 걸린 연속 작업
+		constexpr size_t FAN_IN_COUNT = 100;
+		atomic<uint32_t> finishedCount = 0;
+		uint32_t observedCount = 0;
+		JobCounter dependency;
+		JobCounter continuation;
+		for (size_t i = 0; i < FAN_IN_COUNT; ++i) jobSystem.Schedule([&]() { this_thread::yield(); finishedCount.fetch_add(1); }, &dependency);
+		jobSystem.ScheduleAfter(dependency, [&]() { observedCount = finishedCount.load(); }, &continuation);
+		jobSystem.Wait(continuation);
+
+		CHECK(observedCount == FAN_IN_COUNT);
+
+		// 이미 끝난 카운터에 건 연속 작업은 바로 예약
+		bool isExecuted = false;
+		JobCounter immediate;
+		jobSystem.ScheduleAfter(dependency, [&]() { isExecuted = true; }, &immediate);
+		jobSystem.Wait(immediate);
+
+		CHECK(isExecuted);
+	}
+
+	// 작업자 수보다 많은 작업이 각자 안에서 Wait // 대기 중인 작업자가 다른 작업을 대신 실행하지 않으면 교착
+	void TestWaitFromWorker(JobSystem& jobSystem)
+	{
+		constexpr size_t OUTER_COUNT = WORKER_COUNT * 8;
+		constexpr size_t INNER_COUNT = 16;
+
+		atomic<uint32_t> innerTotal = 0;
+		atomic<uint32_t> workerWaitCount = 0;
+		JobCounter counter;
+		for (size_t i = 0; i < OUTER_COUNT; ++i)
+		{
+			jobSystem.Schedule([&]()
+				{
+					JobCounter innerCounter;
+					for (size_t j = 0; j < INNER_COUNT; ++j) jobSystem.Schedule([&]() { innerTotal.fetch_add(1, memory_order_relaxed); }, &innerCounter);
+					jobSystem.Wait(innerCounter);
+
+					CHECK(innerCounter.IsDone());
+					if (JobSystem::GetCurrentWorkerIndex() != JobSystem::NOT_WORKER) workerWaitCount.fetch_add(1);
+				}, &counter);
+		}
+		jobSystem.Wait(counter);
+
+		CHECK(innerTotal.load() == OUTER_COUNT * INNER_COUNT);
+		// 메인 스레드가 Wait 중 대신 실행한 작업을 빼도 작업자 안의 Wait이 한 번은 있어야 함
+		CHECK(workerWaitCount.load() > 0);
+	}
+
+	// 작업자에서 예약한 메인 스레드 작업은 메인 스레드에서만 실행 // Wait, ExecuteMainThreadJobs, Finalize가 모두 비움
+	void TestScheduleOnMainThread(JobSystem& jobSystem)
+	{
+		constexpr size_t JOB_COUNT = 64;
+
+		// 메인 스레드의 Wait이 작업자가 예약한 메인 스레드 작업을 실행
+		atomic<uint32_t> mainThreadCount = 0;
+		atomic<uint32_t> otherThreadCount = 0;
+		const auto onMainThread = [&]() { (jobSystem.IsMainThread() ? mainThreadCount : otherThreadCount).fetch_add(1); };
+
+		JobCounter counter;
+		for (size_t i = 0; i < JOB_COUNT; ++i) jobSystem.Schedule([&]() { jobSystem.ScheduleOnMainThread(onMainThread, &counter); }, &counter);
+		jobSystem.Wait(counter);
+
+		CHECK(mainThreadCount.load() == JOB_COUNT);
+		CHECK(otherThreadCount.load() == 0);
+
+		// 카운터 없이 예약한 작업은 프레임 시작의 ExecuteMainThreadJobs에서 실행
+		mainThreadCount = 0;
+		JobCounter scheduled;
+		for (size_t i = 0; i < JOB_COUNT; ++i) jobSystem.Schedule([&]() { jobSystem.ScheduleOnMainThread(onMainThread); }, &scheduled);
+		jobSystem.Wait(scheduled);
+		jobSystem.ExecuteMainThreadJobs();
+
+		CHECK(mainThreadCount.load() == JOB_COUNT);
+		CHECK(otherThreadCount.load() == 0);
+
+		// 실행 중인 메인 스레드 작업이 예약한 작업은 다음 호출에서 실행
+		uint32_t drainedCount = 0;
+		jobSystem.ScheduleOnMainThread([&]() { ++drainedCount; jobSystem.ScheduleOnMainThread([&]() { ++drainedCount; }); });
+		jobSystem.ExecuteMainThreadJobs();
+		CHECK(drainedCount == 1);
+		jobSystem.ExecuteMainThreadJobs();
+		CHECK(drainedCount == 2);
+	}
+}
+
+int main()
+{
+	JobSystem& jobSystem = JobSystem::GetInstance();
+	jobSystem.Initialize(WORKER_COUNT);
+	CHECK(jobSystem.GetWorkerCount() == WORKER_COUNT);
+
+	const pair<const char*, void(*)(JobSystem&)> tests[] =
+	{
+		{ "NestedParallelFor", TestNestedParallelFor },
+		{ "ScheduleAfterChain", TestScheduleAfterChain },
+		{ "WaitFromWorker", TestWaitFromWorker },
+		{ "ScheduleOnMainThread", TestScheduleOnMainThread },
+	};
+
+	for (const auto& [name, test] : tests)
+	{
+		const size_t failureCount = s_failureCount.load();
+		test(jobSystem);
+		cout << (s_failureCount == failureCount ? "[통과] " : "[실패] ") << name << endl;
+	}
+
+	// 종료 시 남은 메인 스레드 작업 실행
+	bool isDrainedOnFinalize = false;
+	jobSystem.ScheduleOnMainThread([&]() { isDrainedOnFinalize = true; });
+	jobSystem.Finalize();
+	CHECK(isDrainedOnFinalize);
+
+	return s_failureCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// 테스트 빌드용 미리 컴파일된 헤더 대체 // 작업 시스템이 쓰는 표준 라이브러리와 싱글톤만 포함
+// DirectX, ImGui 등 Windows 전용 의존성 없이 Engine 소스를 g++, clang으로 빌드하기 위함
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Singleton.h"